@@ -0,0 +1,124 @@
+//
+// 并发跳表的多线程基准测试：对比 SkipList + 读写锁 与无锁的 ConcurrentSkipList 在不同读线程数下的吞吐
+//
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <mutex>
+#include <random>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "util.h"
+#include "skipList.h"
+#include "ConcurrentSkipList.h"
+
+static std::string keyOf(size_t i) {
+  char buf[32];
+  snprintf(buf, sizeof(buf), "key%012zu", i);
+  return buf;
+}
+
+// SkipList 本身只有写操作加锁，读写并发时需要外部的读写锁，与 KvServer 的用法一致
+struct LockedSkipList {
+  explicit LockedSkipList(int maxLevel) : list(maxLevel) {}
+  bool get(const std::string &key, std::string &value) {
+    std::shared_lock<std::shared_mutex> lg(mtx);
+    return list.search_element(key, value);
+  }
+  void put(const std::string &key, std::string value) {
+    std::unique_lock<std::shared_mutex> lg(mtx);
+    list.insert_set_element(key, std::move(value));
+  }
+  void del(const std::string &key) {
+    std::unique_lock<std::shared_mutex> lg(mtx);
+    list.delete_element(key);
+  }
+  std::shared_mutex mtx;
+  SkipList<std::string, std::string> list;
+};
+
+struct LockFreeSkipList {
+  explicit LockFreeSkipList(int maxLevel) : list(maxLevel) {}
+  bool get(const std::string &key, std::string &value) { return list.search_element(key, value); }
+  void put(const std::string &key, std::string value) { list.insert_set_element(key, std::move(value)); }
+  void del(const std::string &key) { list.delete_element(key); }
+  ConcurrentSkipList<std::string, std::string> list;
+};
+
+/*
+runCase 函数
+主要功能：readers 个读线程随机查找，writers 个写线程随机写入和删除，运行 seconds 秒，输出读写的总吞吐
+*/
+template <typename Store>
+static void runCase(const std::string &name, Store &store, const std::vector<std::string> &keys, int readers,
+                    int writers, double seconds) {
+  std::atomic<bool> stop{false};
+  std::atomic<long long> reads{0};
+  std::atomic<long long> writes{0};
+  std::vector<std::thread> threads;
+  for (int t = 0; t < readers; ++t) {
+    threads.emplace_back([&, t]() -> void {
+      std::mt19937_64 rng(t + 1);
+      std::string value;
+      long long count = 0;
+      while (!stop.load(std::memory_order_relaxed)) {
+        store.get(keys[rng() % keys.size()], value);
+        ++count;
+      }
+      reads += count;
+    });
+  }
+  for (int t = 0; t < writers; ++t) {
+    threads.emplace_back([&, t]() -> void {
+      std::mt19937_64 rng(1000 + t);
+      long long count = 0;
+      while (!stop.load(std::memory_order_relaxed)) {
+        const std::string &key = keys[rng() % keys.size()];
+        if (rng() % 2) {
+          store.put(key, std::string(64, 'w'));
+        } else {
+          store.del(key);
+        }
+        ++count;
+      }
+      writes += count;
+    });
+  }
+  std::this_thread::sleep_for(std::chrono::duration<double>(seconds));
+  stop = true;
+  for (auto &t : threads) t.join();
+
+  std::cout << name << " readers " << readers << ", writers " << writers << ": "
+            << reads / seconds / 1e6 << " Mreads/s (" << (readers > 0 ? reads / seconds / 1e6 / readers : 0)
+            << " per reader), " << writes / seconds / 1e6 << " Mwrites/s" << std::endl;
+}
+
+int main(int argc, char **argv) {
+  size_t keyCount = argc > 1 ? atoll(argv[1]) : 200000;
+  int maxThreads = argc > 2 ? atoi(argv[2]) : static_cast<int>(std::thread::hardware_concurrency());
+  double seconds = argc > 3 ? atof(argv[3]) : 2.0;
+  maxThreads = std::max(maxThreads, 1);
+
+  std::vector<std::string> keys;
+  keys.reserve(keyCount);
+  for (size_t i = 0; i < keyCount; ++i) keys.push_back(keyOf(i));
+
+  LockedSkipList locked(18);
+  LockFreeSkipList lockFree(18);
+  for (const auto &key : keys) {
+    locked.put(key, std::string(64, 'v'));
+    lockFree.put(key, std::string(64, 'v'));
+  }
+  std::cout << keyCount << " keys, up to " << maxThreads << " threads, " << seconds << "s per case" << std::endl;
+
+  for (int readers = 1; readers <= maxThreads; readers *= 2) {
+    runCase("SkipList + shared_mutex", locked, keys, readers, 0, seconds);
+    runCase("ConcurrentSkipList     ", lockFree, keys, readers, 0, seconds);
+    runCase("SkipList + shared_mutex", locked, keys, readers, 1, seconds);
+    runCase("ConcurrentSkipList     ", lockFree, keys, readers, 1, seconds);
+  }
+  return 0;
+}
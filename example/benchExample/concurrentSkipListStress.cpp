@@ -0,0 +1,199 @@
+//
+// ConcurrentSkipList 的多线程压力测试：写线程并发插入、覆盖、追加、删除，读线程同时无锁查找，结束后检查跳表的最终内容
+//
+
+#include <atomic>
+#include <iostream>
+#include <map>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include "util.h"
+#include "ConcurrentSkipList.h"
+
+static std::string keyOf(size_t i) {
+  char buf[32];
+  snprintf(buf, sizeof(buf), "key%08zu", i);
+  return buf;
+}
+
+// 值总是以 "键=" 开头，读线程据此检查读到的值属于这个键（读到已释放或者被改坏的值时对不上）
+static std::string valueOf(const std::string &key, uint64_t version) { return key + "=" + std::to_string(version); }
+
+static bool belongsTo(const std::string &key, const std::string &value) {
+  return value.size() > key.size() && value.compare(0, key.size(), key) == 0 && value[key.size()] == '=';
+}
+
+/*
+runOwnedKeys 函数
+主要功能：writers 个写线程，第 t 个线程只写编号模 writers 等于 t 的键，相邻的键属于不同的线程，
+        插入和删除在同一段链表上交错进行；每个写线程用自己的 std::map 记录期望的内容。
+        readers 个读线程同时随机查找和范围扫描，检查读到的值属于对应的键、扫描结果有序
+        结束后逐个比较跳表和所有写线程期望内容的并集，以及 size()
+*/
+static bool runOwnedKeys(int writers, int readers, size_t keyCount, int opsPerWriter) {
+  ConcurrentSkipList<std::string, std::string> list(16);
+  std::vector<std::map<std::string, std::string>> expected(writers);
+  std::atomic<bool> stop{false};
+  std::atomic<long long> readErrors{0};
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < writers; ++t) {
+    threads.emplace_back([&, t] {
+      std::mt19937_64 rng(t + 1);
+      auto &mine = expected[t];
+      for (int i = 0; i < opsPerWriter; ++i) {
+        size_t n = rng() % (keyCount / writers) * writers + t;
+        std::string key = keyOf(n);
+        switch (rng() % 5) {
+          case 0: {   // 只插入新键
+            std::string value = valueOf(key, i);
+            bool inserted = list.insert_element(key, value) == 0;
+            if (inserted != (mine.count(key) == 0)) readErrors.fetch_add(1);
+            mine.emplace(key, value);
+            break;
+          }
+          case 1: {   // 插入或覆盖
+            std::string value = valueOf(key, i);
+            list.insert_set_element(key, std::string(value));
+            mine[key] = value;
+            break;
+          }
+          case 2: {   // 追加，键不存在时以追加的内容为值
+            auto it = mine.find(key);
+            std::string suffix = it == mine.end() ? valueOf(key, i) : "+";
+            list.append_element(key, suffix);
+            mine[key] += suffix;
+            break;
+          }
+          default: {    // 删除
+            bool existed = list.delete_element(key);
+            if (existed != (mine.erase(key) == 1)) readErrors.fetch_add(1);
+            break;
+          }
+        }
+      }
+    });
+  }
+  for (int r = 0; r < readers; ++r) {
+    threads.emplace_back([&, r] {
+      std::mt19937_64 rng(100 + r);
+      std::string value;
+      std::vector<std::string> keys;
+      std::vector<std::string> values;
+      std::string next;
+      while (!stop.load(std::memory_order_relaxed)) {
+        std::string key = keyOf(rng() % keyCount);
+        if (list.search_element(key, value) && !belongsTo(key, value)) readErrors.fetch_add(1);
+
+        list.scan_elements(key, std::string(), false, 32, &keys, &values, &next);
+        for (size_t i = 0; i < keys.size(); ++i) {
+          if (!belongsTo(keys[i], values[i]) || (i > 0 && !(keys[i - 1] < keys[i]))) readErrors.fetch_add(1);
+        }
+      }
+    });
+  }
+  for (int t = 0; t < writers; ++t) threads[t].join();
+  stop.store(true);
+  for (size_t i = writers; i < threads.size(); ++i) threads[i].join();
+
+  // 期望内容的并集，各线程的键互不相交
+  std::map<std::string, std::string> all;
+  for (auto &mine : expected) all.insert(mine.begin(), mine.end());
+
+  bool ok = readErrors.load() == 0;
+  if (!ok) std::cout << "  " << readErrors.load() << " inconsistent results during the run" << std::endl;
+  if (list.size() != static_cast<int>(all.size())) {
+    std::cout << "  size " << list.size() << ", expected " << all.size() << std::endl;
+    ok = false;
+  }
+  std::string value;
+  for (const auto &[key, want] : all) {
+    if (!list.search_element(key, value) || value != want) {
+      std::cout << "  wrong value for " << key << std::endl;
+      ok = false;
+      break;
+    }
+  }
+  // 分页扫描整个跳表，与期望内容逐个比较，确认没有多余的（已删除却还能遍历到的）键
+  std::vector<std::string> keys;
+  std::vector<std::string> values;
+  std::string cursor;
+  auto it = all.begin();
+  bool more = true;
+  while (ok && more) {
+    std::string next;
+    more = list.scan_elements(cursor, std::string(), false, 100, &keys, &values, &next);
+    for (size_t i = 0; i < keys.size(); ++i, ++it) {
+      if (it == all.end() || it->first != keys[i] || it->second != values[i]) {
+        std::cout << "  scan mismatch at " << keys[i] << std::endl;
+        ok = false;
+        break;
+      }
+    }
+    cursor = std::move(next);
+  }
+  if (ok && it != all.end()) {
+    std::cout << "  scan stopped before " << it->first << std::endl;
+    ok = false;
+  }
+
+  std::cout << writers << " writers + " << readers << " readers, " << keyCount << " keys, " << opsPerWriter
+            << " ops/writer: " << (ok ? "ok" : "FAILED") << std::endl;
+  return ok;
+}
+
+/*
+runSharedKeys 函数
+主要功能：所有线程争用同一组键
+    1. 同时 insert_element 同一批新键，每个键恰好有一个线程插入成功
+    2. 同时向同一组键追加，追加是拷贝后CAS换上的，结束时每个值的长度等于所有线程追加的总长度，一次也不能丢
+*/
+static bool runSharedKeys(int threadCount, int keyCount, int appendsPerThread) {
+  ConcurrentSkipList<std::string, std::string> list(16);
+  std::atomic<int> inserted{0};
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < threadCount; ++t) {
+    threads.emplace_back([&, t] {
+      for (int k = 0; k < keyCount; ++k) {
+        if (list.insert_element(keyOf(k), std::string()) == 0) inserted.fetch_add(1);
+      }
+      std::mt19937_64 rng(t + 1);
+      for (int i = 0; i < appendsPerThread; ++i) {
+        list.append_element(keyOf(rng() % keyCount), std::string("x"));
+      }
+    });
+  }
+  for (auto &t : threads) t.join();
+
+  bool ok = inserted.load() == keyCount && list.size() == keyCount;
+  if (!ok) std::cout << "  inserted " << inserted.load() << ", size " << list.size() << ", expected " << keyCount
+                     << std::endl;
+  size_t total = 0;
+  std::string value;
+  for (int k = 0; k < keyCount; ++k) {
+    if (list.search_element(keyOf(k), value)) total += value.size();
+  }
+  if (total != static_cast<size_t>(threadCount) * appendsPerThread) {
+    std::cout << "  appended " << total << " bytes, expected " << static_cast<size_t>(threadCount) * appendsPerThread
+              << std::endl;
+    ok = false;
+  }
+  std::cout << threadCount << " threads on " << keyCount << " shared keys: " << (ok ? "ok" : "FAILED") << std::endl;
+  return ok;
+}
+
+int main(int argc, char **argv) {
+  int opsPerWriter = argc > 1 ? atoi(argv[1]) : 200000;
+  int rounds = argc > 2 ? atoi(argv[2]) : 3;
+
+  bool ok = true;
+  for (int i = 0; i < rounds; ++i) {
+    ok = runOwnedKeys(4, 2, 4096, opsPerWriter) && ok;    // 键少，插入和删除集中在同一段链表上
+    ok = runOwnedKeys(4, 2, 200000, opsPerWriter) && ok;
+    ok = runSharedKeys(4, 16, opsPerWriter / 10) && ok;
+  }
+  return ok ? 0 : 1;
+}
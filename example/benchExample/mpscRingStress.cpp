@@ -0,0 +1,94 @@
+//
+// MpscRing 的多生产者压力测试：4个生产者混合使用 Push 和 PushBatch 写入，消费者检查每个生产者的元素按写入顺序到达、不丢不重
+//
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <thread>
+#include <vector>
+#include "MpscRing.h"
+
+struct Item {
+  int producer = -1;
+  uint64_t seq = 0;
+};
+
+/*
+runRound 函数
+主要功能：容量为 capacity 的队列上，producers 个生产者各写入 perProducer 个元素，单个消费者取出并检查：
+    1. 同一个生产者的元素序号从0开始连续递增（写入顺序不被打乱，没有丢失或重复）
+    2. 取出的元素总数等于写入的总数
+注意：容量取得很小，让生产者频繁遇到队列满、跨越环形数组的边界，以及批量写入只占到部分槽位的情况
+*/
+static bool runRound(size_t capacity, int producers, uint64_t perProducer) {
+  MpscRing<Item> ring(capacity);
+  std::atomic<int> running{producers};
+
+  std::vector<std::thread> threads;
+  for (int p = 0; p < producers; ++p) {
+    threads.emplace_back([&ring, &running, p, perProducer] {
+      std::mt19937_64 rng(p + 1);
+      uint64_t seq = 0;
+      std::vector<Item> batch;
+      while (seq < perProducer) {
+        if (rng() % 2 == 0) {
+          ring.Push(Item{p, seq++});
+          continue;
+        }
+        batch.clear();
+        uint64_t n = std::min<uint64_t>(1 + rng() % 100, perProducer - seq);    // 有的批次比队列容量还大
+        for (uint64_t i = 0; i < n; ++i) batch.push_back(Item{p, seq++});
+        ring.PushBatch(batch);
+      }
+      running.fetch_sub(1, std::memory_order_release);
+    });
+  }
+
+  std::vector<uint64_t> expected(producers, 0);
+  std::vector<Item> items;
+  uint64_t received = 0;
+  bool ok = true;
+  while (true) {
+    bool finished = running.load(std::memory_order_acquire) == 0;   // 先读标志再取数据，标志为0时取空就说明全部收到了
+    if (!ring.timeOutPopAll(10, &items)) {
+      if (finished) break;
+      continue;
+    }
+    for (const Item &item : items) {
+      if (item.producer < 0 || item.producer >= producers || item.seq != expected[item.producer]) {
+        if (ok) {
+          std::cout << "  out of order: producer " << item.producer << " seq " << item.seq << ", expected "
+                    << (item.producer >= 0 && item.producer < producers ? expected[item.producer] : 0) << std::endl;
+        }
+        ok = false;
+        continue;
+      }
+      ++expected[item.producer];
+    }
+    received += items.size();
+  }
+  for (auto &t : threads) t.join();
+
+  if (received != perProducer * producers) {
+    std::cout << "  received " << received << " of " << perProducer * producers << std::endl;
+    ok = false;
+  }
+  std::cout << "capacity " << capacity << ", " << producers << " producers x " << perProducer << ": "
+            << (ok ? "ok" : "FAILED") << std::endl;
+  return ok;
+}
+
+int main(int argc, char **argv) {
+  uint64_t perProducer = argc > 1 ? atoll(argv[1]) : 1000000;
+  int rounds = argc > 2 ? atoi(argv[2]) : 3;
+
+  bool ok = true;
+  for (int i = 0; i < rounds; ++i) {
+    ok = runRound(16, 4, perProducer) && ok;
+    ok = runRound(1024, 4, perProducer) && ok;
+  }
+  return ok ? 0 : 1;
+}
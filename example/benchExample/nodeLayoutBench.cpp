@@ -0,0 +1,163 @@
+//
+// 跳表节点布局的基准测试：对比原先"节点 + 指针数组 + 键的堆内存"分开分配的布局与内存池中连续布局（带前缀指纹）的内存占用和查找延迟
+//
+
+#include <malloc.h>
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include "util.h"
+#include "skipList.h"
+
+/*
+LegacySkipList 类模板
+主要功能：原先的节点布局，只保留插入和查找，作为对比基准
+    节点用 new 分配，指针数组再 new[] 一次，std::string 的键超过 SSO 长度时还有一块堆内存
+*/
+template <typename K, typename V>
+class LegacySkipList {
+  struct LegacyNode {
+    LegacyNode(K k, V v, int level) : key(std::move(k)), value(std::move(v)), node_level(level) {
+      forward = new LegacyNode *[level + 1]();
+    }
+    ~LegacyNode() { delete[] forward; }
+    K key;
+    V value;
+    int node_level;
+    LegacyNode **forward;
+  };
+
+public:
+  explicit LegacySkipList(int maxLevel) : m_maxLevel(maxLevel), m_header(new LegacyNode(K(), V(), maxLevel)) {}
+
+  ~LegacySkipList() {
+    LegacyNode *node = m_header;
+    while (node != nullptr) {
+      LegacyNode *next = node->forward[0];
+      delete node;
+      node = next;
+    }
+  }
+
+  void insert(const K &key, const V &value) {
+    LegacyNode *update[m_maxLevel + 1];
+    LegacyNode *current = m_header;
+    for (int i = m_level; i >= 0; i--) {
+      while (current->forward[i] != nullptr && current->forward[i]->key < key) current = current->forward[i];
+      update[i] = current;
+    }
+    int level = 0;
+    while (rand() % 2 && level < m_maxLevel) level++;
+    for (int i = m_level + 1; i <= level; i++) update[i] = m_header;
+    m_level = std::max(m_level, level);
+    auto *node = new LegacyNode(key, value, level);
+    for (int i = 0; i <= level; i++) {
+      node->forward[i] = update[i]->forward[i];
+      update[i]->forward[i] = node;
+    }
+  }
+
+  bool search(const K &key, V &value) {
+    LegacyNode *current = m_header;
+    for (int i = m_level; i >= 0; i--) {
+      while (current->forward[i] != nullptr && current->forward[i]->key < key) current = current->forward[i];
+    }
+    current = current->forward[0];
+    if (current != nullptr && current->key == key) {
+      value = current->value;
+      return true;
+    }
+    return false;
+  }
+
+private:
+  int m_maxLevel;
+  int m_level = 0;
+  LegacyNode *m_header;
+};
+
+static size_t heapInUse() { return mallinfo2().uordblks + mallinfo2().hblkhd; }
+
+static std::string keyOf(size_t i, size_t length) {
+  char buf[32];
+  snprintf(buf, sizeof(buf), "key%012zu", i);
+  std::string key(buf);
+  key.resize(std::max(length, key.size()), '#');    // 补齐到指定长度，前缀保证唯一
+  return key;
+}
+
+// 前8个字节各不相同的键，例如 "user:3f9a1c..."，大部分比较只比较前缀指纹
+static std::string randomKeyOf(std::mt19937_64 &rng) {
+  char buf[32];
+  snprintf(buf, sizeof(buf), "user:%016llx", static_cast<unsigned long long>(rng()));
+  return buf;
+}
+
+/*
+runCase 函数
+主要功能：插入所有键，统计插入前后堆内存的差值；然后随机查找 lookups 次，输出平均和 p99 延迟
+*/
+template <typename Store>
+static void runCase(const std::string &name, const std::vector<std::string> &keys, int lookups) {
+  std::vector<std::string> order(keys);
+  std::shuffle(order.begin(), order.end(), std::mt19937_64(1));
+
+  size_t before = heapInUse();
+  auto *store = new Store(18);
+  for (const auto &key : order) store->insert(key, std::string(8, 'v'));   // 短值，只比较节点本身
+  size_t bytes = heapInUse() - before;
+
+  std::mt19937_64 rng(2);
+  std::vector<double> latencies;
+  latencies.reserve(lookups);
+  std::string value;
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < lookups; ++i) {
+    const std::string &key = keys[rng() % keys.size()];
+    auto begin = std::chrono::steady_clock::now();
+    store->search(key, value);
+    latencies.push_back(std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - begin).count());
+  }
+  double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  std::sort(latencies.begin(), latencies.end());
+  delete store;
+
+  std::cout << name << ": " << static_cast<double>(bytes) / keys.size() << " bytes/key, " << lookups / seconds / 1e6
+            << " Mlookups/s, p50 " << latencies[latencies.size() / 2] << " ns, p99 "
+            << latencies[latencies.size() * 99 / 100] << " ns" << std::endl;
+}
+
+// 当前的 SkipList 包一层，接口与 LegacySkipList 一致
+struct ArenaSkipList {
+  explicit ArenaSkipList(int maxLevel) : list(maxLevel) {}
+  void insert(const std::string &key, const std::string &value) { list.upsert(key, value); }
+  bool search(const std::string &key, std::string &value) { return list.search_element(key, value); }
+  SkipList<std::string, std::string> list;
+};
+
+int main(int argc, char **argv) {
+  size_t keyCount = argc > 1 ? atoll(argv[1]) : 500000;
+  int lookups = argc > 2 ? atoi(argv[2]) : 1000000;
+
+  for (size_t keyLength : {15, 24, 48}) {   // 15 字节以内的键原先靠 SSO 不用额外分配，更长的键原先还有一块堆内存
+    std::vector<std::string> keys;
+    keys.reserve(keyCount);
+    for (size_t i = 0; i < keyCount; ++i) keys.push_back(keyOf(i, keyLength));
+    std::cout << keyCount << " keys of " << keyLength << " bytes, " << lookups << " lookups" << std::endl;
+    runCase<LegacySkipList<std::string, std::string>>("  legacy layout", keys, lookups);
+    runCase<ArenaSkipList>("  arena layout ", keys, lookups);
+  }
+
+  // keyOf 生成的键前8个字节大量相同，指纹经常相等；这里再测一组前缀分散的键
+  std::mt19937_64 rng(3);
+  std::vector<std::string> keys;
+  keys.reserve(keyCount);
+  for (size_t i = 0; i < keyCount; ++i) keys.push_back(randomKeyOf(rng));
+  std::cout << keyCount << " random keys of " << keys[0].size() << " bytes, " << lookups << " lookups" << std::endl;
+  runCase<LegacySkipList<std::string, std::string>>("  legacy layout", keys, lookups);
+  runCase<ArenaSkipList>("  arena layout ", keys, lookups);
+  return 0;
+}
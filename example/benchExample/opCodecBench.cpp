@@ -0,0 +1,134 @@
+//
+// Op编码的微基准测试：对比新的紧凑二进制编码与原来的boost文本归档
+//
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "util.h"
+
+// 旧的编码方式：boost文本归档
+static std::string boostEncode(const Op &op) {
+  std::stringstream ss;
+  boost::archive::text_oarchive oa(ss);
+  oa << op;
+  return ss.str();
+}
+
+/*
+LegacyOp 结构体
+主要功能：最初版本的 Op 及其boost序列化布局（Operation/Key/Value/ClientId/RequestId，ClientId 为字符串，类版本0），
+        用来生成旧节点持久化的日志，检查新版本仍然能解析
+*/
+struct LegacyOp {
+  std::string Operation;
+  std::string Key;
+  std::string Value;
+  std::string ClientId;
+  int RequestId = 0;
+
+  template <class Archive>
+  void serialize(Archive &ar, const unsigned int /*version*/) {
+    ar &Operation;
+    ar &Key;
+    ar &Value;
+    ar &ClientId;
+    ar &RequestId;
+  }
+};
+
+/*
+checkLegacyDecode 函数
+主要功能：旧格式的日志经过 parseFromString 解析后各字段与写入时一致，返回是否通过
+*/
+static bool checkLegacyDecode() {
+  LegacyOp legacy;
+  legacy.Operation = "Put";
+  legacy.Key = "k";
+  legacy.Value = "v";
+  legacy.ClientId = "123456";
+  legacy.RequestId = 7;
+  std::stringstream ss;
+  {
+    boost::archive::text_oarchive oa(ss);
+    oa << legacy;
+  }
+
+  Op parsed;
+  bool ok = parsed.parseFromString(ss.str()) && parsed.Operation == legacy.Operation && parsed.Key == legacy.Key &&
+            parsed.Value == legacy.Value && parsed.Keys.empty() && parsed.Values.empty() &&
+            parsed.ClientId == Op::LegacyClientId(legacy.ClientId) && parsed.RequestId == legacy.RequestId;
+  std::cout << "legacy boost archive {" << ss.str() << "}: " << (ok ? "ok" : "FAILED") << std::endl;
+  return ok;
+}
+
+/*
+runCase 函数
+主要功能：对同一个Op分别用两种编码各做 rounds 次编码+解码，输出每次操作的耗时和编码后的字节数
+*/
+static void runCase(const std::string &name, const Op &op, int rounds) {
+  using Clock = std::chrono::steady_clock;
+
+  std::string boostData = boostEncode(op);
+  std::string binaryData = op.asString();
+
+  size_t sink = 0;  // 防止编译器把循环优化掉
+  auto start = Clock::now();
+  for (int i = 0; i < rounds; ++i) {
+    std::string data = boostEncode(op);
+    Op parsed;
+    parsed.parseFromBoostString(data);
+    sink += parsed.Key.size();
+  }
+  double boostNs = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / rounds;
+
+  start = Clock::now();
+  for (int i = 0; i < rounds; ++i) {
+    std::string data = op.asString();
+    Op parsed;
+    parsed.parseFromString(data);
+    sink += parsed.Key.size();
+  }
+  double binaryNs = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / rounds;
+
+  std::cout << name << ":\n"
+            << "  boost text : " << boostData.size() << " bytes/op, " << boostNs << " ns/op (encode+decode)\n"
+            << "  binary     : " << binaryData.size() << " bytes/op, " << binaryNs << " ns/op (encode+decode)\n"
+            << "  speedup " << boostNs / binaryNs << "x, size " << 100.0 * binaryData.size() / boostData.size()
+            << "%  (sink " << sink << ")" << std::endl;
+}
+
+int main(int argc, char **argv) {
+  int rounds = argc > 1 ? atoi(argv[1]) : 200000;
+
+  if (!checkLegacyDecode()) {
+    return 1;
+  }
+
+  Op put;
+  put.Operation = "Put";
+  put.Key = "user:000123456";
+  put.Value = std::string(32, 'v');
+  put.ClientId = 4096;   // 会话ID是注册会话那条日志的索引
+  put.Timestamp = 1724800000000;
+  put.RequestId = 1024;
+  runCase("Put (14B key, 32B value)", put, rounds);
+
+  Op get = put;
+  get.Operation = "Get";
+  get.Value.clear();
+  runCase("Get (14B key)", get, rounds);
+
+  Op multiPut;
+  multiPut.Operation = "MultiPut";
+  multiPut.ClientId = put.ClientId;
+  multiPut.RequestId = 1025;
+  for (int i = 0; i < 16; ++i) {
+    multiPut.Keys.push_back("user:" + std::to_string(1000000 + i));
+    multiPut.Values.push_back(std::string(32, 'a' + i));
+  }
+  runCase("MultiPut (16 pairs)", multiPut, rounds / 10);
+
+  return 0;
+}
@@ -0,0 +1,148 @@
+//
+// 热点键读缓存的基准测试：Zipfian 分布的读请求下，对比直接查跳表与经过 CLOCK / TinyLFU 缓存的延迟分布和命中率
+//
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <mutex>
+#include <random>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "HotKeyCache.h"
+#include "util.h"
+#include "skipList.h"
+
+/*
+ZipfianGenerator 类
+主要功能：按 Zipfian 分布生成 [0, n) 的整数，0 最热；预先计算累积分布，采样时二分查找
+*/
+class ZipfianGenerator {
+public:
+  ZipfianGenerator(size_t n, double theta) : m_cdf(n) {
+    double sum = 0;
+    for (size_t i = 0; i < n; ++i) {
+      sum += 1.0 / std::pow(static_cast<double>(i + 1), theta);
+      m_cdf[i] = sum;
+    }
+    for (auto &c : m_cdf) c /= sum;
+  }
+
+  size_t Next(std::mt19937_64 &rng) {
+    double u = std::uniform_real_distribution<double>(0.0, 1.0)(rng);
+    return std::lower_bound(m_cdf.begin(), m_cdf.end(), u) - m_cdf.begin();
+  }
+
+private:
+  std::vector<double> m_cdf;
+};
+
+static std::string keyOf(size_t i) {
+  char buf[32];
+  snprintf(buf, sizeof(buf), "key%012zu", i);
+  return buf;
+}
+
+struct BenchResult {
+  std::vector<double> latencies;    // 每次读的耗时（纳秒）
+  double seconds = 0;
+};
+
+/*
+runCase 函数
+主要功能：threads 个线程各执行 ops 次操作，其中 writeRatio 比例是写（独占锁，写跳表并使缓存失效），其余是读（共享锁）
+        与 KvServer 一样，读缓存的查找和填充都在共享锁内
+*/
+static BenchResult runCase(SkipList<std::string, SegmentedValue> &store, HotKeyCache *cache, const std::vector<std::string> &keys,
+                           ZipfianGenerator &zipf, int threads, int ops, double writeRatio) {
+  std::shared_mutex storeMtx;
+  std::vector<std::vector<double>> latencies(threads);
+  auto start = std::chrono::steady_clock::now();
+  std::vector<std::thread> workers;
+  for (int t = 0; t < threads; ++t) {
+    workers.emplace_back([&, t]() -> void {
+      std::mt19937_64 rng(t * 7919 + 1);
+      std::uniform_real_distribution<double> coin(0.0, 1.0);
+      std::string value;
+      latencies[t].reserve(ops);
+      for (int i = 0; i < ops; ++i) {
+        const std::string &key = keys[zipf.Next(rng)];
+        if (coin(rng) < writeRatio) {
+          std::unique_lock<std::shared_mutex> lg(storeMtx);
+          if (cache != nullptr) cache->Invalidate(key);
+          store.insert_set_element(key, std::string(100, 'w'));
+          continue;
+        }
+        auto begin = std::chrono::steady_clock::now();
+        {
+          std::shared_lock<std::shared_mutex> lg(storeMtx);
+          if (cache == nullptr || !cache->Lookup(key, &value)) {
+            if (store.search_element(key, value) && cache != nullptr) {
+              cache->Insert(key, value);
+            }
+          }
+        }
+        latencies[t].push_back(std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - begin).count());
+      }
+    });
+  }
+  for (auto &w : workers) w.join();
+
+  BenchResult result;
+  result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  for (auto &l : latencies) result.latencies.insert(result.latencies.end(), l.begin(), l.end());
+  std::sort(result.latencies.begin(), result.latencies.end());
+  return result;
+}
+
+static void report(const std::string &name, const BenchResult &result, HotKeyCache *cache) {
+  auto percentile = [&](double p) -> double {
+    if (result.latencies.empty()) return 0;
+    return result.latencies[std::min(result.latencies.size() - 1, static_cast<size_t>(p * result.latencies.size()))];
+  };
+  std::cout << name << ": " << result.latencies.size() / result.seconds / 1e6 << " Mreads/s, p50 " << percentile(0.5)
+            << " ns, p99 " << percentile(0.99) << " ns, p999 " << percentile(0.999) << " ns";
+  if (cache != nullptr) {
+    HotKeyCache::Stats stats = cache->GetStats();
+    std::cout << ", hitRate " << stats.HitRate() << ", admissions " << stats.admissions << ", rejections "
+              << stats.rejections << ", invalidations " << stats.invalidations;
+  }
+  std::cout << std::endl;
+}
+
+int main(int argc, char **argv) {
+  size_t keyCount = argc > 1 ? atoll(argv[1]) : 200000;
+  int threads = argc > 2 ? atoi(argv[2]) : 4;
+  int ops = argc > 3 ? atoi(argv[3]) : 500000;
+  double theta = argc > 4 ? atof(argv[4]) : 0.99;
+  double writeRatio = argc > 5 ? atof(argv[5]) : 0.01;
+  size_t capacity = argc > 6 ? atoll(argv[6]) : keyCount / 100;   // 默认缓存1%的键
+
+  std::vector<std::string> keys;
+  keys.reserve(keyCount);
+  for (size_t i = 0; i < keyCount; ++i) keys.push_back(keyOf(i));
+  std::shuffle(keys.begin(), keys.end(), std::mt19937_64(42));    // 热点键分散在跳表各处
+
+  SkipList<std::string, SegmentedValue> store(18);
+  for (const auto &key : keys) store.insert_set_element(key, std::string(100, 'v'));
+  ZipfianGenerator zipf(keyCount, theta);
+
+  std::cout << keyCount << " keys, " << threads << " threads x " << ops << " ops, zipf theta " << theta
+            << ", write ratio " << writeRatio << ", cache capacity " << capacity << std::endl;
+
+  report("skiplist only ", runCase(store, nullptr, keys, zipf, threads, ops, writeRatio), nullptr);
+
+  ReadCachePolicy policy;
+  policy.capacity = capacity;
+  policy.tinyLfu = false;
+  HotKeyCache clockCache(policy);
+  report("CLOCK cache   ", runCase(store, &clockCache, keys, zipf, threads, ops, writeRatio), &clockCache);
+
+  policy.tinyLfu = true;
+  HotKeyCache lfuCache(policy);
+  report("TinyLFU cache ", runCase(store, &lfuCache, keys, zipf, threads, ops, writeRatio), &lfuCache);
+  return 0;
+}
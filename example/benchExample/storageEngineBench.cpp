@@ -0,0 +1,308 @@
+//
+// 存储引擎的基准测试：跳表和B+树通过同一个 KvStorageEngine 接口，对比批量加载、写入、点查延迟、范围扫描和内存占用；
+// 测量之前先做一遍差分测试，确认两个引擎对同样的操作给出同样的结果
+//
+
+#include <malloc.h>
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "util.h"
+#include "KvStorageEngine.h"
+
+static size_t heapInUse() { return mallinfo2().uordblks + mallinfo2().hblkhd; }
+
+static double secondsSince(std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+static std::string keyOf(size_t i) {
+  char buf[32];
+  snprintf(buf, sizeof(buf), "key%012zu", i);
+  return buf;
+}
+
+// 前8个字节各不相同的键，与 nodeLayoutBench 相同
+static std::string randomKeyOf(std::mt19937_64 &rng) {
+  char buf[32];
+  snprintf(buf, sizeof(buf), "user:%016llx", static_cast<unsigned long long>(rng()));
+  return buf;
+}
+
+/*
+sameContents 函数
+主要功能：分页扫描两个引擎的全部内容逐个比较，页大小不是叶子节点容量的整数倍，翻页的位置落在叶子节点中间
+*/
+static bool sameContents(KvStorageEngine &a, KvStorageEngine &b, const char *when) {
+  if (a.Size() != b.Size()) {
+    std::cout << "  " << when << ": size " << a.Size() << " vs " << b.Size() << std::endl;
+    return false;
+  }
+  std::vector<std::string> keysA, valuesA, keysB, valuesB;
+  std::string cursor;
+  std::string nextA, nextB;
+  while (true) {
+    bool moreA = a.Scan(cursor, "", false, 1000, &keysA, &valuesA, &nextA);
+    bool moreB = b.Scan(cursor, "", false, 1000, &keysB, &valuesB, &nextB);
+    if (moreA != moreB || keysA != keysB || valuesA != valuesB || (moreA && nextA != nextB)) {
+      std::cout << "  " << when << ": contents differ after " << (cursor.empty() ? "<begin>" : cursor) << std::endl;
+      return false;
+    }
+    if (!moreA) return true;
+    cursor = nextA;
+  }
+}
+
+// 按 KvServer::dumpKVData 的方式制作快照
+static std::string snapshotOf(KvStorageEngine &engine) {
+  SkipListDump<std::string, SegmentedValue> dumper;
+  engine.DumpTo(&dumper);
+  std::stringstream ss;
+  boost::archive::text_oarchive oa(ss);
+  oa << dumper;
+  return ss.str();
+}
+
+// 按 KvServer::loadKVData 的方式把快照装进一个新的引擎
+static std::unique_ptr<KvStorageEngine> restoreFrom(const std::string &snapshot, StorageEngineType type) {
+  SkipListDump<std::string, SegmentedValue> dumper;
+  std::stringstream iss(snapshot);
+  boost::archive::text_iarchive ia(iss);
+  ia >> dumper;
+  StorageEnginePolicy policy;
+  policy.type = type;
+  auto engine = KvStorageEngine::Create(policy);
+  engine->BulkLoad(std::move(dumper.keyDumpVt_), std::move(dumper.valDumpVt_));
+  return engine;
+}
+
+/*
+checkEquivalence 函数
+主要功能：差分测试，同一串随机操作同时作用在跳表和B+树上，每一步比较两者的返回值
+    1. 操作：Put、Append、MultiPut、FindOrInsert 后原地追加、Delete、Get、Find，以及随机起点、终点和页大小的 Scan，
+       页大小可以超过叶子节点的容量，扫描会跨越叶子节点的边界
+    2. 键空间有限，前40%的步数以写入为主，树长高、节点分裂；中间40%以删除为主，几乎删空，
+       叶子节点和内部节点借位、合并，树变矮；最后20%写入和删除交替，在合并过的树上重新长高
+    3. 每隔 snapshotEvery 步做一次快照往返：两个引擎各自导出快照，快照必须完全相同；
+       跳表的快照装进新的B+树、B+树的快照装进新的跳表，与原来的内容比较后替换原引擎继续，之后的操作落在批量建成的树上
+*/
+static bool checkEquivalence(int steps, size_t keySpace, int snapshotEvery) {
+  StorageEnginePolicy policy;
+  policy.type = StorageEngineType::SkipList;
+  auto skipList = KvStorageEngine::Create(policy);
+  policy.type = StorageEngineType::BPlusTree;
+  auto bplusTree = KvStorageEngine::Create(policy);
+
+  std::mt19937_64 rng(4);
+  auto randomKey = [&rng, keySpace] { return keyOf(rng() % keySpace); };
+  auto randomValue = [&rng] { return std::string(rng() % 24, static_cast<char>('a' + rng() % 26)); };
+
+  std::string valueA, valueB, nextA, nextB;
+  std::vector<std::string> keysA, valuesA, keysB, valuesB;
+  for (int step = 0; step < steps; ++step) {
+    int writePercent = 60;
+    int deletePercent = 25;
+    if (step >= steps * 4 / 10 && step < steps * 8 / 10) {
+      writePercent = 0;
+      deletePercent = 60;
+    } else if (step >= steps * 8 / 10) {
+      writePercent = 40;
+      deletePercent = 30;
+    }
+    int dice = static_cast<int>(rng() % 100);
+    std::string key = randomKey();
+    bool same = true;
+    const char *op = "";
+    if (dice < writePercent) {
+      switch (rng() % 4) {
+        case 0: {
+          op = "Put";
+          std::string value = randomValue();
+          same = skipList->Put(key, value) == bplusTree->Put(key, value);
+          break;
+        }
+        case 1: {
+          op = "Append";
+          std::string suffix = randomValue();
+          skipList->Append(key, suffix);
+          bplusTree->Append(key, suffix);
+          break;
+        }
+        case 2: {
+          op = "MultiPut";
+          std::vector<std::string> keys, values;
+          for (size_t n = 1 + rng() % 8; n > 0; --n) {
+            keys.push_back(randomKey());
+            values.push_back(randomValue());
+          }
+          skipList->MultiPut(keys, values);
+          bplusTree->MultiPut(keys, values);
+          break;
+        }
+        default: {
+          op = "FindOrInsert";
+          auto a = skipList->FindOrInsert(key);
+          auto b = bplusTree->FindOrInsert(key);
+          same = a.second == b.second && a.first->equals(b.first->str());
+          a.first->append("!");
+          b.first->append("!");
+          break;
+        }
+      }
+    } else if (dice < writePercent + deletePercent) {
+      op = "Delete";
+      same = skipList->Delete(key) == bplusTree->Delete(key);
+    } else if (dice < writePercent + deletePercent + 5) {
+      op = "Get";
+      valueA.clear();
+      valueB.clear();
+      same = skipList->Get(key, &valueA) == bplusTree->Get(key, &valueB) && valueA == valueB;
+    } else if (dice < writePercent + deletePercent + 10) {
+      op = "Find";
+      SegmentedValue *a = skipList->Find(key);
+      SegmentedValue *b = bplusTree->Find(key);
+      same = (a == nullptr) == (b == nullptr) && (a == nullptr || a->equals(b->str()));
+    } else {
+      op = "Scan";
+      std::string end = randomKey();
+      bool hasEnd = rng() % 2 == 0;
+      size_t limit = 1 + rng() % 200;
+      bool moreA = skipList->Scan(key, end, hasEnd, limit, &keysA, &valuesA, &nextA);
+      bool moreB = bplusTree->Scan(key, end, hasEnd, limit, &keysB, &valuesB, &nextB);
+      same = moreA == moreB && keysA == keysB && valuesA == valuesB && (!moreA || nextA == nextB);
+    }
+    if (!same || skipList->Size() != bplusTree->Size()) {
+      std::cout << "  step " << step << ": " << op << " " << key << " differs" << std::endl;
+      return false;
+    }
+
+    if ((step + 1) % snapshotEvery == 0) {
+      std::string snapshotA = snapshotOf(*skipList);
+      std::string snapshotB = snapshotOf(*bplusTree);
+      if (snapshotA != snapshotB) {
+        std::cout << "  step " << step << ": snapshots differ" << std::endl;
+        return false;
+      }
+      auto restoredTree = restoreFrom(snapshotA, StorageEngineType::BPlusTree);
+      auto restoredList = restoreFrom(snapshotB, StorageEngineType::SkipList);
+      if (!sameContents(*skipList, *restoredTree, "skiplist snapshot -> bplustree") ||
+          !sameContents(*bplusTree, *restoredList, "bplustree snapshot -> skiplist")) {
+        return false;
+      }
+      skipList = std::move(restoredList);
+      bplusTree = std::move(restoredTree);
+    }
+  }
+  return sameContents(*skipList, *bplusTree, "end");
+}
+
+/*
+runCase 函数
+主要功能：对一个引擎依次测量
+    1. BulkLoad：安装快照的路径，键按快照中的顺序（有序）装入空引擎，统计耗时和堆内存的增量
+    2. Put：在另一个空引擎中按随机顺序逐个写入
+    3. Get：随机点查 lookups 次，输出吞吐以及 p50 / p99 延迟
+    4. Scan：从随机起点每次取 scanLimit 个，输出每秒取出的键数
+*/
+static void runCase(StorageEngineType type, const std::vector<std::string> &sortedKeys, int lookups, int scans,
+                    size_t scanLimit) {
+  StorageEnginePolicy policy;
+  policy.type = type;
+  std::vector<std::string> values(sortedKeys.size(), std::string(16, 'v'));
+
+  // 1. 批量加载
+  size_t before = heapInUse();
+  auto loaded = KvStorageEngine::Create(policy);
+  auto start = std::chrono::steady_clock::now();
+  loaded->BulkLoad(std::vector<std::string>(sortedKeys), std::vector<std::string>(values));
+  double loadSeconds = secondsSince(start);
+  size_t bytes = heapInUse() - before;
+
+  // 2. 随机顺序逐个写入
+  std::vector<std::string> shuffled(sortedKeys);
+  std::shuffle(shuffled.begin(), shuffled.end(), std::mt19937_64(1));
+  auto written = KvStorageEngine::Create(policy);
+  start = std::chrono::steady_clock::now();
+  for (const auto &key : shuffled) written->Put(key, values[0]);
+  double putSeconds = secondsSince(start);
+  if (written->Size() != loaded->Size()) {
+    std::cout << "size mismatch: " << written->Size() << " vs " << loaded->Size() << std::endl;
+  }
+  written.reset();
+
+  // 3. 随机点查
+  std::mt19937_64 rng(2);
+  std::vector<double> latencies;
+  latencies.reserve(lookups);
+  std::string value;
+  int found = 0;
+  start = std::chrono::steady_clock::now();
+  for (int i = 0; i < lookups; ++i) {
+    const std::string &key = sortedKeys[rng() % sortedKeys.size()];
+    auto begin = std::chrono::steady_clock::now();
+    found += loaded->Get(key, &value);
+    latencies.push_back(std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - begin).count());
+  }
+  double getSeconds = secondsSince(start);
+  std::sort(latencies.begin(), latencies.end());
+
+  // 4. 范围扫描
+  std::vector<std::string> keys;
+  std::vector<std::string> scanned;
+  std::string next;
+  size_t total = 0;
+  start = std::chrono::steady_clock::now();
+  for (int i = 0; i < scans; ++i) {
+    loaded->Scan(sortedKeys[rng() % sortedKeys.size()], "", false, scanLimit, &keys, &scanned, &next);
+    total += keys.size();
+  }
+  double scanSeconds = secondsSince(start);
+
+  std::cout << "  " << loaded->Name() << ": " << static_cast<double>(bytes) / sortedKeys.size() << " bytes/key, "
+            << "bulk load " << sortedKeys.size() / loadSeconds / 1e6 << " Mkeys/s, "
+            << "put " << sortedKeys.size() / putSeconds / 1e6 << " Mops/s, "
+            << "get " << lookups / getSeconds / 1e6 << " Mops/s (p50 " << latencies[latencies.size() / 2]
+            << " ns, p99 " << latencies[latencies.size() * 99 / 100] << " ns), "
+            << "scan " << total / scanSeconds / 1e6 << " Mkeys/s" << std::endl;
+  if (found != lookups) {
+    std::cout << "  missing keys: " << lookups - found << std::endl;
+  }
+}
+
+int main(int argc, char **argv) {
+  size_t keyCount = argc > 1 ? atoll(argv[1]) : 500000;
+  int lookups = argc > 2 ? atoi(argv[2]) : 1000000;
+  int scans = argc > 3 ? atoi(argv[3]) : 20000;
+  size_t scanLimit = 100;
+
+  // 键空间小，树会反复分裂和合并
+  bool equivalent = checkEquivalence(400000, 20000, 50000);
+  std::cout << "differential check (skiplist vs bplustree, with snapshot round trips): "
+            << (equivalent ? "ok" : "FAILED") << std::endl;
+  if (!equivalent) {
+    return 1;
+  }
+
+  std::vector<std::string> sequential;
+  sequential.reserve(keyCount);
+  for (size_t i = 0; i < keyCount; ++i) sequential.push_back(keyOf(i));
+
+  std::mt19937_64 rng(3);
+  std::vector<std::string> random;
+  random.reserve(keyCount);
+  for (size_t i = 0; i < keyCount; ++i) random.push_back(randomKeyOf(rng));
+  std::sort(random.begin(), random.end());
+  random.erase(std::unique(random.begin(), random.end()), random.end());
+
+  for (auto *keys : {&sequential, &random}) {
+    std::cout << keys->size() << (keys == &sequential ? " sequential" : " random") << " keys of " << (*keys)[0].size()
+              << " bytes, " << lookups << " lookups, " << scans << " scans of " << scanLimit << std::endl;
+    runCase(StorageEngineType::SkipList, *keys, lookups, scans, scanLimit);
+    runCase(StorageEngineType::BPlusTree, *keys, lookups, scans, scanLimit);
+  }
+  return 0;
+}
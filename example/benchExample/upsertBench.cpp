@@ -0,0 +1,84 @@
+//
+// 跳表覆盖写的基准测试：对比原先"查找+删除+插入"的三次遍历与 upsert / update_in_place 的单次遍历，输出吞吐和每次操作的堆分配次数
+//
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "util.h"
+#include "skipList.h"
+
+static std::atomic<long long> g_allocations{0};    // 全局 operator new 的调用次数
+
+void *operator new(size_t size) {
+  ++g_allocations;
+  if (void *p = malloc(size == 0 ? 1 : size)) {
+    return p;
+  }
+  throw std::bad_alloc();
+}
+
+void operator delete(void *p) noexcept { free(p); }
+void operator delete(void *p, size_t) noexcept { free(p); }
+
+static std::string keyOf(size_t i) {
+  char buf[32];
+  snprintf(buf, sizeof(buf), "key%012zu", i);
+  return buf;
+}
+
+/*
+runCase 函数
+主要功能：对已有的键执行 ops 次覆盖写，write(key, index) 由各个用例给出，输出吞吐和平均每次操作的分配次数
+*/
+template <typename Write>
+static void runCase(const std::string &name, const std::vector<std::string> &keys, int ops, Write write) {
+  std::mt19937_64 rng(7);
+  std::vector<size_t> order(ops);
+  for (auto &i : order) i = rng() % keys.size();
+
+  long long allocations = g_allocations.load();
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < ops; ++i) {
+    write(keys[order[i]], i);
+  }
+  double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  allocations = g_allocations.load() - allocations;
+  std::cout << name << ": " << ops / seconds / 1e6 << " Mops/s, " << static_cast<double>(allocations) / ops
+            << " allocations/op" << std::endl;
+}
+
+int main(int argc, char **argv) {
+  size_t keyCount = argc > 1 ? atoll(argv[1]) : 200000;
+  int ops = argc > 2 ? atoi(argv[2]) : 1000000;
+
+  std::vector<std::string> keys;
+  keys.reserve(keyCount);
+  for (size_t i = 0; i < keyCount; ++i) keys.push_back(keyOf(i));
+
+  SkipList<std::string, std::string> store(18);
+  for (const auto &key : keys) store.upsert(key, std::string(16, 'v'));
+  std::cout << keyCount << " keys, " << ops << " overwrites per case" << std::endl;
+
+  // 值都是不超过 SSO 长度的短字符串，分配次数只反映跳表本身
+  runCase("search + delete + insert", keys, ops, [&](const std::string &key, int i) -> void {
+    std::string current;
+    if (store.search_element(key, current)) {
+      store.delete_element(key);
+    }
+    store.try_emplace(key, std::to_string(i));   // 键刚被删除，这里就是一次普通的插入（insert_element 会逐条打印）
+  });
+  runCase("upsert                  ", keys, ops, [&](const std::string &key, int i) -> void {
+    store.upsert(std::string_view(key), std::to_string(i));
+  });
+  runCase("update_in_place         ", keys, ops, [&](const std::string &key, int i) -> void {
+    store.update_in_place(std::string_view(key), [i](std::string &value) -> void { value = std::to_string(i); });
+  });
+  return 0;
+}
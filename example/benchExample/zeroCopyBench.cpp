@@ -0,0 +1,127 @@
+//
+// 写请求命令路径的内存分配统计：验证大value从RPC请求到跳表只被拷贝固定的几次
+//
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <string>
+#include <vector>
+#include "ApplyMsg.h"
+#include "kvServerRPC.pb.h"
+#include "raftRPC.pb.h"
+#include "util.h"
+#include "skipList.h"
+
+/*
+替换全局的 operator new / delete，统计分配次数和字节数
+大于等于 g_largeThreshold 的分配单独计数，它们对应的就是value数据的拷贝
+*/
+static std::atomic<long long> g_allocCount{0};
+static std::atomic<long long> g_allocBytes{0};
+static std::atomic<long long> g_largeAllocCount{0};
+static size_t g_largeThreshold = 1 << 20;
+
+void *operator new(size_t size) {
+  g_allocCount.fetch_add(1, std::memory_order_relaxed);
+  g_allocBytes.fetch_add(size, std::memory_order_relaxed);
+  if (size >= g_largeThreshold) {
+    g_largeAllocCount.fetch_add(1, std::memory_order_relaxed);
+  }
+  void *p = std::malloc(size == 0 ? 1 : size);
+  if (p == nullptr) throw std::bad_alloc();
+  return p;
+}
+
+void operator delete(void *p) noexcept { std::free(p); }
+void operator delete(void *p, size_t) noexcept { std::free(p); }
+
+struct AllocSnapshot {
+  long long count = g_allocCount.load();
+  long long bytes = g_allocBytes.load();
+  long long large = g_largeAllocCount.load();
+};
+
+/*
+writePath 函数
+主要功能：按 KvServer::PutAppend -> Raft::Start -> Raft::getApplyLogs -> applyChan -> KvServer::GetCommandFromRaft
+        的顺序走一遍写请求的命令路径（去掉网络和共识部分）
+*/
+static void writePath(const raftKVRpcProctoc::PutAppendArgs &args,
+                      std::vector<std::shared_ptr<const raftRpcProctoc::LogEntry>> *logs,
+                      ApplyChannel *applyChan, SkipList<std::string, std::string> *store, int index) {
+  // KvServer::PutAppend：值直接从请求编码进命令
+  Op op;
+  op.Operation = args.op();
+  op.Key = args.key();
+  op.ClientId = args.clientid();
+  op.RequestId = args.requestid();
+  std::string command = op.asStringWithValue(args.value());
+
+  // Raft::Start：命令移动进日志条目，日志条目移动进不可变的共享对象
+  raftRpcProctoc::LogEntry entry;
+  entry.set_command(std::move(command));
+  entry.set_logindex(index);
+  logs->emplace_back(std::make_shared<const raftRpcProctoc::LogEntry>(std::move(entry)));
+
+  // Raft::getApplyLogs + applierTicker：共享日志条目中的命令字段，之后移动进队列
+  const auto &logEntry = logs->back();
+  ApplyMsg msg;
+  msg.CommandValid = true;
+  msg.Command = SharedBuffer(std::shared_ptr<const std::string>(logEntry, &logEntry->command()));
+  msg.CommandIndex = index;
+  applyChan->Push(std::move(msg));
+
+  // KvServer::ReadRaftApplyCommandLoop + GetCommandFromRaft：在共享缓冲区上解析，值移动进跳表
+  std::vector<ApplyMsg> applied;
+  applyChan->timeOutPopAll(0, &applied);
+  Op parsed;
+  parsed.parseFromString(applied[0].Command.view());
+  store->insert_set_element(parsed.Key, std::move(parsed.Value));
+}
+
+int main(int argc, char **argv) {
+  size_t valueSize = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : (4 << 20);
+  int rounds = argc > 2 ? atoi(argv[2]) : 32;
+  g_largeThreshold = valueSize;
+
+  // 模拟从socket收到的请求：这一次拷贝发生在protobuf解析时，不计入统计
+  raftKVRpcProctoc::PutAppendArgs args;
+  args.set_op("Put");
+  args.set_key("large-key");
+  args.set_value(std::string(valueSize, 'x'));
+  args.set_clientid(4096);
+
+  std::vector<std::shared_ptr<const raftRpcProctoc::LogEntry>> logs;
+  logs.reserve(rounds);
+  ApplyChannel applyChan;
+  SkipList<std::string, std::string> store(6);
+
+  AllocSnapshot before;
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < rounds; ++i) {
+    args.set_requestid(i + 1);
+    writePath(args, &logs, &applyChan, &store, i + 1);
+  }
+  double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  AllocSnapshot after;
+
+  double largePerOp = double(after.large - before.large) / rounds;
+  double bytesPerOp = double(after.bytes - before.bytes) / rounds;
+  std::cout << "value size           : " << valueSize << " bytes\n"
+            << "allocations / op     : " << double(after.count - before.count) / rounds << "\n"
+            << "value-sized allocs/op: " << largePerOp << "\n"
+            << "allocated bytes / op : " << bytesPerOp << " (" << bytesPerOp / valueSize << "x value)\n"
+            << "throughput           : " << rounds * valueSize / seconds / (1 << 20) << " MB/s" << std::endl;
+
+  // 值在路径上只允许出现两份：日志中的命令（持久化和复制需要，apply时直接共享它）、跳表中的值
+  const double expectedCopies = 2;
+  if (largePerOp > expectedCopies) {
+    std::cout << "FAIL: value copied more than " << expectedCopies << " times per write" << std::endl;
+    return 1;
+  }
+  std::cout << "PASS" << std::endl;
+  return 0;
+}
@@ -0,0 +1,208 @@
+//
+// 有界无锁多生产者单消费者环形队列，用于raft向kv server传递apply消息
+//
+
+#ifndef SKIP_LIST_ON_RAFT_MPSCRING_H
+#define SKIP_LIST_ON_RAFT_MPSCRING_H
+
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+/*
+MpscRing 类模板
+主要功能：apply通道，生产者（raft的applier线程、安装快照的线程）和消费者（kv server的apply线程）之间不共用一把锁
+实现：
+    1. 环形数组的每个槽位带一个序号 seq（Vyukov有界队列）：seq == pos 表示槽位空闲，可以写入第 pos 个元素；
+       seq == pos + 1 表示第 pos 个元素已经写好，可以读取；读完后 seq 置为 pos + capacity，留给下一圈
+    2. 生产者用一次CAS占住连续的 n 个槽位完成批量写入；消费者只有一个，读位置不需要CAS
+    3. 消费者没有数据可读时阻塞在 eventfd 上，生产者写完后只有在消费者确实在睡眠时才 write eventfd，
+       空闲时不需要轮询，忙碌时也不需要系统调用
+    4. 队列满时生产者让出CPU重试（背压），保证消息不会丢
+*/
+template <typename T>
+class MpscRing {
+public:
+  explicit MpscRing(size_t capacity = 16384);
+  ~MpscRing();
+
+  MpscRing(const MpscRing &) = delete;
+  MpscRing &operator=(const MpscRing &) = delete;
+
+  void Push(T &&item);    // 写入一个元素，队列满时等待
+
+  void PushBatch(std::vector<T> &items);    // 按顺序写入一批元素（元素被移走），尽量一次占住所有槽位，只唤醒一次消费者
+
+  // 取出当前所有可读的元素（至少一个），在 timeout 毫秒内一直没有数据则返回 false。只能由唯一的消费者线程调用
+  bool timeOutPopAll(int timeout, std::vector<T> *ResData);
+
+private:
+  struct Cell {
+    std::atomic<size_t> seq;
+    T data;
+  };
+
+  size_t tryClaim(size_t n, size_t *start);   // 尝试占住最多 n 个连续槽位，返回实际占住的个数
+  size_t drain(std::vector<T> *out);    // 取出当前所有可读的元素
+  void notifyConsumer();    // 消费者在睡眠时唤醒它
+
+private:
+  const size_t m_capacity;    // 容量，2的幂
+  const size_t m_mask;
+  std::unique_ptr<Cell[]> m_cells;
+
+  alignas(64) std::atomic<size_t> m_enqueuePos{0};    // 生产者之间竞争的写位置
+  alignas(64) size_t m_dequeuePos = 0;    // 只有消费者访问的读位置
+  std::atomic<bool> m_consumerWaiting{false};   // 消费者是否准备睡眠
+  int m_eventFd;
+};
+
+template <typename T>
+MpscRing<T>::MpscRing(size_t capacity)
+    : m_capacity([capacity] {
+        size_t c = 2;
+        while (c < capacity) c <<= 1;   // 向上取整到2的幂
+        return c;
+      }()),
+      m_mask(m_capacity - 1),
+      m_cells(new Cell[m_capacity]) {
+  for (size_t i = 0; i < m_capacity; ++i) {
+    m_cells[i].seq.store(i, std::memory_order_relaxed);
+  }
+  m_eventFd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+}
+
+template <typename T>
+MpscRing<T>::~MpscRing() {
+  if (m_eventFd >= 0) close(m_eventFd);
+}
+
+/*
+tryClaim 函数
+主要功能：用一次CAS占住从写位置开始的最多 n 个连续空闲槽位
+注意：消费者按顺序释放槽位，所以空闲的槽位总是从写位置开始连续的一段
+*/
+template <typename T>
+size_t MpscRing<T>::tryClaim(size_t n, size_t *start) {
+  size_t pos = m_enqueuePos.load(std::memory_order_relaxed);
+  while (true) {
+    size_t seq = m_cells[pos & m_mask].seq.load(std::memory_order_acquire);
+    intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+    if (diff < 0) {
+      return 0;   // 槽位里还是上一圈没被读走的元素，队列满了
+    }
+    if (diff > 0) {
+      pos = m_enqueuePos.load(std::memory_order_relaxed);   // 写位置已经被其他生产者推进，重新读取
+      continue;
+    }
+
+    // 第一个槽位空闲，继续数后面连续空闲的槽位
+    size_t k = 1;
+    while (k < n && m_cells[(pos + k) & m_mask].seq.load(std::memory_order_acquire) == pos + k) {
+      ++k;
+    }
+    if (m_enqueuePos.compare_exchange_weak(pos, pos + k, std::memory_order_relaxed)) {
+      *start = pos;
+      return k;
+    }
+    // CAS失败时 pos 已经被更新为最新的写位置，重试
+  }
+}
+
+template <typename T>
+void MpscRing<T>::Push(T &&item) {
+  size_t start = 0;
+  while (tryClaim(1, &start) == 0) {
+    std::this_thread::yield();    // 队列满，等消费者腾出位置
+  }
+  Cell &cell = m_cells[start & m_mask];
+  cell.data = std::move(item);
+  cell.seq.store(start + 1, std::memory_order_release);
+  notifyConsumer();
+}
+
+template <typename T>
+void MpscRing<T>::PushBatch(std::vector<T> &items) {
+  size_t done = 0;
+  while (done < items.size()) {
+    size_t start = 0;
+    size_t n = tryClaim(items.size() - done, &start);
+    if (n == 0) {
+      notifyConsumer();   // 满了，先让消费者把已经写好的取走
+      std::this_thread::yield();
+      continue;
+    }
+    for (size_t i = 0; i < n; ++i) {
+      Cell &cell = m_cells[(start + i) & m_mask];
+      cell.data = std::move(items[done + i]);
+      cell.seq.store(start + i + 1, std::memory_order_release);
+    }
+    done += n;
+  }
+  notifyConsumer();
+}
+
+/*
+notifyConsumer 函数
+主要功能：写入之后如果消费者正在（或准备）睡眠，就通过eventfd唤醒它
+注意：与 timeOutPopAll 中"先标记睡眠再检查队列"配合，两边都用seq_cst栅栏，不会出现写入了但消费者没被唤醒的情况
+*/
+template <typename T>
+void MpscRing<T>::notifyConsumer() {
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (m_consumerWaiting.load(std::memory_order_relaxed)) {
+    uint64_t one = 1;
+    ssize_t ret = write(m_eventFd, &one, sizeof(one));
+    (void)ret;
+  }
+}
+
+template <typename T>
+size_t MpscRing<T>::drain(std::vector<T> *out) {
+  size_t count = 0;
+  while (true) {
+    Cell &cell = m_cells[m_dequeuePos & m_mask];
+    if (cell.seq.load(std::memory_order_acquire) != m_dequeuePos + 1) {
+      break;    // 还没写好（或者是空的）
+    }
+    out->push_back(std::move(cell.data));
+    cell.data = T();    // 及时释放元素持有的资源（例如命令缓冲区的引用）
+    cell.seq.store(m_dequeuePos + m_capacity, std::memory_order_release);
+    ++m_dequeuePos;
+    ++count;
+  }
+  return count;
+}
+
+template <typename T>
+bool MpscRing<T>::timeOutPopAll(int timeout, std::vector<T> *ResData) {
+  ResData->clear();
+  if (drain(ResData) > 0) {
+    return true;
+  }
+
+  // 准备睡眠：先标记，再检查一次，避免错过在两步之间写入的数据
+  m_consumerWaiting.store(true, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (drain(ResData) == 0) {
+    struct pollfd pfd;
+    pfd.fd = m_eventFd;
+    pfd.events = POLLIN;
+    poll(&pfd, 1, timeout);
+  }
+  m_consumerWaiting.store(false, std::memory_order_relaxed);
+
+  uint64_t counter = 0;
+  ssize_t ret = read(m_eventFd, &counter, sizeof(counter));   // 清空计数，非阻塞
+  (void)ret;
+
+  drain(ResData);
+  return !ResData->empty();
+}
+
+#endif
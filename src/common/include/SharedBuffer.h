@@ -0,0 +1,40 @@
+//
+// 引用计数的只读缓冲区，在raft与kv server之间传递命令时只增加引用计数，不拷贝数据
+//
+
+#ifndef SKIP_LIST_ON_RAFT_SHAREDBUFFER_H
+#define SKIP_LIST_ON_RAFT_SHAREDBUFFER_H
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+
+/*
+SharedBuffer 类
+主要功能：持有一段不可变的字节数据，拷贝 SharedBuffer 只是拷贝智能指针（增加引用计数），底层数据始终只有一份
+    数据一旦放进来就不能再修改，因此可以在多个线程之间随意传递，不需要额外加锁
+*/
+class SharedBuffer {
+public:
+  SharedBuffer() = default;
+
+  // 接管一个字符串的内存：传入右值时不会拷贝数据
+  explicit SharedBuffer(std::string data) : m_data(std::make_shared<const std::string>(std::move(data))) {}
+
+  // 共享一个已经存在的不可变字符串，可以配合 shared_ptr 的别名构造，让缓冲区指向某个共享对象内部的字段
+  explicit SharedBuffer(std::shared_ptr<const std::string> data) : m_data(std::move(data)) {}
+
+  const char *data() const { return m_data ? m_data->data() : ""; }
+  size_t size() const { return m_data ? m_data->size() : 0; }
+  bool empty() const { return size() == 0; }
+
+  std::string_view view() const { return m_data ? std::string_view(*m_data) : std::string_view(); }
+
+  long useCount() const { return m_data.use_count(); }   // 当前有多少个 SharedBuffer 共享这份数据，主要用于调试
+
+private:
+  std::shared_ptr<const std::string> m_data;
+};
+
+#endif
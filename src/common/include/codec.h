@@ -0,0 +1,72 @@
+//
+// 紧凑二进制编码的工具函数：varint变长整数、zigzag、带长度前缀的字节串
+//
+
+#ifndef SKIP_LIST_ON_RAFT_CODEC_H
+#define SKIP_LIST_ON_RAFT_CODEC_H
+
+#include <cstdint>
+#include <string>
+
+/*
+PutVarint64 函数
+主要功能：把无符号整数按varint格式追加到dst末尾，每个字节低7位存数据，最高位为1表示后面还有字节
+        小于128的数只占1个字节
+*/
+inline void PutVarint64(std::string *dst, uint64_t value) {
+  char buf[10];
+  int len = 0;
+  while (value >= 0x80) {
+    buf[len++] = static_cast<char>(value | 0x80);
+    value >>= 7;
+  }
+  buf[len++] = static_cast<char>(value);
+  dst->append(buf, len);
+}
+
+/*
+GetVarint64 函数
+主要功能：从 [*p, limit) 中解析一个varint，成功后 *p 向后移动；数据被截断或格式错误时返回false
+*/
+inline bool GetVarint64(const char **p, const char *limit, uint64_t *value) {
+  uint64_t result = 0;
+  for (int shift = 0; shift <= 63 && *p < limit; shift += 7) {
+    uint64_t byte = static_cast<unsigned char>(**p);
+    ++(*p);
+    result |= (byte & 0x7f) << shift;
+    if ((byte & 0x80) == 0) {
+      *value = result;
+      return true;
+    }
+  }
+  return false;
+}
+
+// zigzag编码：把有符号数映射为无符号数，使绝对值小的负数也只占很少的字节（0->0, -1->1, 1->2, ...）
+inline uint64_t ZigZagEncode(int64_t value) { return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63); }
+inline int64_t ZigZagDecode(uint64_t value) { return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1); }
+
+/*
+PutLengthPrefixed 函数
+主要功能：追加一个"varint长度 + 原始字节"格式的字节串
+*/
+inline void PutLengthPrefixed(std::string *dst, const std::string &str) {
+  PutVarint64(dst, str.size());
+  dst->append(str);
+}
+
+/*
+GetLengthPrefixed 函数
+主要功能：解析一个带长度前缀的字节串到 *str
+*/
+inline bool GetLengthPrefixed(const char **p, const char *limit, std::string *str) {
+  uint64_t len = 0;
+  if (!GetVarint64(p, limit, &len) || len > static_cast<uint64_t>(limit - *p)) {
+    return false;
+  }
+  str->assign(*p, len);
+  *p += len;
+  return true;
+}
+
+#endif
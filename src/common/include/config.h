@@ -10,12 +10,32 @@ const bool Debug = true;    // 是否为Debug模式
 
 const int debugMul = 1;  // 时间单位：time.Millisecond，不同网络环境rpc速度不同，因此需要乘以一个系数
 const int HeartBeatTimeout = 25 * debugMul;  // 心跳时间一般要比选举超时小一个数量级
-const int ApplyInterval = 10 * debugMul;     // 将消息应用到状态机上的时间间隔
 
 const int minRandomizedElectionTime = 300 * debugMul;  // ms
 const int maxRandomizedElectionTime = 500 * debugMul;  // ms
 
 const int CONSENSUS_TIMEOUT = 500 * debugMul;  // ms。命令提交等待超时时间
+const int KV_READ_THREAD_NUM = 4;   // kv server执行读请求的线程数
+const int KV_PARTITION_NUM = 4;   // kv server按键的哈希划分的存储分区数，落在不同分区的命令可以并行apply
+const int KV_APPLY_THREAD_NUM = KV_PARTITION_NUM - 1;   // 并行apply的线程数，apply线程自己也执行一个分区
+const int READ_CACHE_REPORT_INTERVAL = 10000 * debugMul;  // ms。输出热点键读缓存统计的间隔
+
+const int SCAN_PAGE_MAX = 1024;   // 范围查找每页最多返回的键值对个数，避免单个回复过大、长时间占用读锁
+
+const int TXN_MAX_OPS = 1024;   // 一个事务中比较条件和操作的总数上限
+
+const int SESSION_EXPIRE_TIME = 10 * 60 * 1000;  // ms。客户端会话超过这个时间没有请求就过期，时间取自日志
+const int SESSION_MAX_NUM = 100000;   // 会话数上限，超过时淘汰最久未活跃的会话
+
+const int TTL_SCAN_INTERVAL = 100 * debugMul;  // ms。Leader检查过期键并提交删除的间隔，键最多在过期后这么久才被删除
+const int TTL_DELETE_BATCH = 256;   // 一条过期删除命令最多包含的键数
+
+const int WATCH_POLL_TIMEOUT = 5000 * debugMul;   // ms。Watch 长轮询没有变更时最多挂起的时间
+const int WATCH_MAX_EVENTS = 256;   // 一次 Watch 回复最多包含的变更数（同一个版本号的变更不拆开）
+const size_t WATCH_HISTORY_MAX = 4096;   // 保留的变更历史条数，更早的版本续传时返回 ErrCompacted
+const size_t WATCH_HISTORY_BYTES = 16 * 1024 * 1024;   // 变更历史中键和值的总字节数上限
+
+const int WAITING_SWEEP_INTERVAL = 50 * debugMul;  // ms。apply线程检查等待请求是否超时的间隔
 
 // 协程相关设置
 const int FIBER_THREAD_NUM = 1;     // 线程池大小
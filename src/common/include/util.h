@@ -12,14 +12,20 @@
 #include <boost/archive/text_iarchive.hpp>
 #include <boost/archive/text_oarchive.hpp>
 #include <boost/serialization/access.hpp>
+#include <boost/serialization/split_member.hpp>
+#include <boost/serialization/string.hpp>
+#include <boost/serialization/vector.hpp>
+#include <boost/serialization/version.hpp>
 #include <condition_variable>  // pthread_condition_t
 #include <functional>
 #include <iostream>
 #include <mutex>  // pthread_mutex_t
-#include <queue>
 #include <random>
 #include <sstream>
+#include <string_view>
 #include <thread>
+#include <vector>
+#include "codec.h"
 #include "config.h"
 
 /*
@@ -28,71 +34,6 @@
 void DPrintf(const char* format, ...);
 
 
-/*
-  定义一个线程安全的队列，用于异步写日志
-*/
-template <typename T>
-class LockQueue {
-public:
-  // 向队列中添加元素，写日志
-  void Push(const T& data) {
-    std::lock_guard<std::mutex> lock(m_mutex);   // 使用 lock_guard 锁定互斥锁，利用RAII的思想保证锁正确释放
-    m_queue.push(data);   // 添加元素
-    m_condvariable.notify_one();   // 唤醒一个因为锁而等待的线程，避免不必要的等待
-  }
-
-  // 取出队列元素，读日志
-  T Pop() {
-    std::unique_lock<std::mutex> lock(m_mutex);
-    while (m_queue.empty()) {
-      // 日志队列是空的，则进入等待，等有元素写入后被唤醒读取(通过条件变量)
-      m_condvariable.wait(lock);
-    }
-    // 取出最前面的元素
-    T data = m_queue.front();
-    m_queue.pop();
-    return data;
-  }
-
-  // 带有超时时间的取出队列元素，如果在指定时间内队列为空，没能取出，则返回 false
-  bool timeOutPop(int timeout, T* ResData) {
-    std::unique_lock<std::mutex> lock(m_mutex);
-    
-    auto now = std::chrono::system_clock::now();    // 获取当前时间
-    auto timeout_time = now + std::chrono::milliseconds(timeout);   // 计算超时时间
-
-    while (m_queue.empty()) {   
-      // m_condvariable.wait_until会在等待期间让出锁陷入阻塞，直到收到锁的通知或这超时
-      if (m_condvariable.wait_until(lock, timeout_time) == std::cv_status::timeout) { // 如果队列为空，且以及超时了，则返回失败
-        return false;
-      } else {    // 否则不断循环，直到队列不为空或超时
-        continue;
-      }
-    }
-
-    T data = m_queue.front();
-    m_queue.pop();
-    *ResData = data;
-    return true;
-  }
-
-private:
-  std::queue<T> m_queue;    // 存储队列元素的容器
-  std::mutex m_mutex;     // 互斥锁，用于保护队列的访问
-  std::condition_variable m_condvariable;     // 条件变量，用于线程间的同步
-};
-// 在LockQueue中，两个对锁的管理用到了RAII的思想，防止中途出现问题而导致资源无法释放的问题！！！
-// std::lock_guard 和 std::unique_lock 都是 C++11 中用来管理互斥锁的工具类，它们都封装了 RAII（Resource Acquisition Is
-// Initialization）技术，使得互斥锁在需要时自动加锁，在不需要时自动解锁，从而避免了很多手动加锁和解锁的繁琐操作。
-// std::lock_guard 是一个模板类，它的模板参数是一个互斥量类型。当创建一个 std::lock_guard
-// 对象时，它会自动地对传入的互斥量进行加锁操作，并在该对象被销毁时对互斥量进行自动解锁操作。std::lock_guard
-// 不能手动释放锁，因为其所提供的锁的生命周期与其绑定对象的生命周期一致。 std::unique_lock
-// 也是一个模板类，同样的，其模板参数也是互斥量类型。不同的是，std::unique_lock 提供了更灵活的锁管理功能。可以通过
-// lock()、unlock()、try_lock() 等方法手动控制锁的状态。当然，std::unique_lock 也支持 RAII
-// 技术，即在对象被销毁时会自动解锁。另外， std::unique_lock 还支持超时等待和可中断等待的操作。
-
-
-
 /*
   DEFER宏：一种在作用域结束时自动执行某些操作的方法，常用于确保资源释放、文件关闭、解锁互斥量等操作，即便函数因异常或其他原因提前返回也能确保这些操作被执行。
 */
@@ -157,39 +98,166 @@ void sleepNMilliseconds(int N);
 */
 class Op {
 public:
-  std::string Operation;  // "Get" "Put" "Append" 等作用于KV数据库的操作
-  std::string Key;        // key
-  std::string Value;      // value
-  std::string ClientId;  //客户端号码
-  int RequestId;         //客户端号码请求的Request的序列号，为了保证线性一致性
+  std::string Operation;  // "Get" "Put" "Append" "MultiGet" "MultiPut" "Scan" 等作用于KV数据库的操作
+  std::string Key;        // key；Scan 为起始键
+  std::string Value;      // value；Scan 为结束键，Increment 为十进制的增量，Txn 为序列化后的事务内容
+  std::vector<std::string> Keys;    // 批量操作（MultiGet/MultiPut/ExpireKeys）的键
+  std::vector<std::string> Values;  // 批量操作（MultiPut）的值，与Keys一一对应；CompareAndSwap 的期望值放在 Values[0]
+  uint64_t ClientId = 0;  // 客户端会话ID，由 RegisterSession 命令分配（即注册会话的那条日志的索引）
+  int RequestId = 0;      // 客户端号码请求的Request的序列号，为了保证线性一致性
+  int64_t Timestamp = 0;  // Leader提交命令时的时间（毫秒），会话过期只依据日志中的这个时间，保证所有副本结果一致
+  int64_t ExpireAt = 0;   // 带TTL的Put：键的过期时间（毫秒，与Timestamp同一个时钟），0 表示不过期
 
 public:
   /*
-  asString：将 Op 对象序列化为字符串
-  // todo
-  // 为了协调raftRPC中的command只设置成了string,这个的限制就是正常字符中不能包含|
-  // 当然后期可以换成更高级的序列化方法，比如protobuf
+  asString：将 Op 对象编码为字符串，作为raft日志条目的Command
+  编码格式（紧凑二进制，不再使用boost文本归档）：
+      [格式标记 OpFormatTag][操作码][Key][Value][Keys个数][Keys...][Values个数][Values...][ClientId][RequestId][Timestamp]([ExpireAt])
+      操作码为1个字节，不认识的操作名编码为 OpCustom 后跟操作名字符串
+      字符串都是"varint长度 + 原始字节"，ClientId 用 varint，RequestId、Timestamp 和 ExpireAt 用 zigzag varint
+      ExpireAt 为0时不写，之前写入的日志没有这个字段，解析时按0处理
+  */
+  std::string asString() const { return asStringWithValue(Value); }
+
+  /*
+  asStringWithValue：与 asString 相同，但用参数 value 代替成员 Value 进行编码
+  用于写请求：RPC请求中的值直接编码进日志命令，不必先拷贝一份到 Op::Value
   */
-  std::string asString() const {
-    std::stringstream ss;
-    boost::archive::text_oarchive oa(ss);   // 使用boost库序列化
+  std::string asStringWithValue(const std::string& value) const {
+    std::string out;
+    out.reserve(32 + Key.size() + value.size());
+    out.push_back(static_cast<char>(OpFormatTag));
+
+    int code = operationCode(Operation);
+    out.push_back(static_cast<char>(code));
+    if (code == OpCustom) {
+      PutLengthPrefixed(&out, Operation);
+    }
+    PutLengthPrefixed(&out, Key);
+    PutLengthPrefixed(&out, value);
+    PutVarint64(&out, Keys.size());
+    for (const auto& key : Keys) {
+      PutLengthPrefixed(&out, key);
+    }
+    PutVarint64(&out, Values.size());
+    for (const auto& value : Values) {
+      PutLengthPrefixed(&out, value);
+    }
+    PutVarint64(&out, ClientId);
+    PutVarint64(&out, ZigZagEncode(RequestId));
+    PutVarint64(&out, ZigZagEncode(Timestamp));
+    if (ExpireAt != 0) {
+      PutVarint64(&out, ZigZagEncode(ExpireAt));
+    }
+    return out;
+  }
+
+  /*
+  parseFromString(std::string_view str) 方法：将字符串解析为 Op 对象，数据不完整时返回false
+  注意：
+      不以 OpFormatTag 开头的数据是旧版本写入的boost文本归档，仍然按旧格式解析，保证升级后能读取已持久化的日志
+  */
+  bool parseFromString(std::string_view str) {
+    if (str.empty()) return false;
+    unsigned char tag = static_cast<unsigned char>(str[0]);
+    if (tag != OpFormatTag) {
+      return parseFromBoostString(str);
+    }
+
+    const char* p = str.data() + 1;
+    const char* limit = str.data() + str.size();
+    if (p >= limit) return false;
+    int code = static_cast<unsigned char>(*p++);
+    if (code == OpCustom) {
+      if (!GetLengthPrefixed(&p, limit, &Operation)) return false;
+    } else if (!operationName(code, &Operation)) {
+      return false;
+    }
+    if (!GetLengthPrefixed(&p, limit, &Key) || !GetLengthPrefixed(&p, limit, &Value)) return false;
+
+    uint64_t count = 0;
+    if (!GetVarint64(&p, limit, &count) || count > static_cast<uint64_t>(limit - p)) return false;   // 每个元素至少占1字节
+    Keys.resize(count);
+    for (auto& key : Keys) {
+      if (!GetLengthPrefixed(&p, limit, &key)) return false;
+    }
+    if (!GetVarint64(&p, limit, &count) || count > static_cast<uint64_t>(limit - p)) return false;
+    Values.resize(count);
+    for (auto& value : Values) {
+      if (!GetLengthPrefixed(&p, limit, &value)) return false;
+    }
 
-    // write class instance to archive
-    oa << *this;
-    // close archive
+    uint64_t requestId = 0;
+    uint64_t timestamp = 0;
+    if (!GetVarint64(&p, limit, &ClientId) || !GetVarint64(&p, limit, &requestId) || !GetVarint64(&p, limit, &timestamp)) {
+      return false;
+    }
+    RequestId = static_cast<int>(ZigZagDecode(requestId));
+    Timestamp = ZigZagDecode(timestamp);
+    ExpireAt = 0;
+    if (p < limit) {    // 可选的尾部字段
+      uint64_t expireAt = 0;
+      if (!GetVarint64(&p, limit, &expireAt)) return false;
+      ExpireAt = ZigZagDecode(expireAt);
+    }
+    return p == limit;
+  }
 
-    return ss.str();
+  /*
+  LegacyClientId 方法：把引入会话之前的字符串客户端ID映射为64位会话ID
+  一律取FNV-1a哈希并置最高位，落在日志索引分配的会话ID（最高位为0）之外，两者不会冲突
+  */
+  static uint64_t LegacyClientId(const std::string& clientId) {
+    uint64_t hash = 14695981039346656037ULL;
+    for (unsigned char c : clientId) {
+      hash ^= c;
+      hash *= 1099511628211ULL;
+    }
+    return hash | (1ULL << 63);
   }
 
   /*
-  parseFromString(std::string str) 方法:将字符串反序列化解析为 Op 对象
+  parseFromBoostString 方法：按旧的boost文本归档格式解析
   */
-  bool parseFromString(std::string str) {
-    std::stringstream iss(str);
-    boost::archive::text_iarchive ia(iss);
-    // read class state from archive
-    ia >> *this;
-    return true;  // todo : 解析失敗如何處理，要看一下boost庫了
+  bool parseFromBoostString(std::string_view str) {
+    try {
+      std::stringstream iss{std::string(str)};
+      boost::archive::text_iarchive ia(iss);
+      ia >> *this;
+    } catch (const std::exception&) {
+      return false;
+    }
+    return true;
+  }
+
+private:
+  // 编码相关的常量，操作码只能在末尾追加，不能修改已有的值，否则旧日志无法解析
+  static constexpr unsigned char OpFormatTag = 0x02;   // 二进制格式的标记，boost文本归档总是以数字字符开头，不会冲突
+  enum OpCode {
+    OpCustom = 0, OpGet = 1, OpPut = 2, OpAppend = 3, OpMultiGet = 4, OpMultiPut = 5, OpRegisterSession = 6, OpScan = 7,
+    OpCompareAndSwap = 8, OpIncrement = 9, OpPutIfAbsent = 10, OpTxn = 11,
+    OpDelete = 12, OpExpireKeys = 13, OpCodeNum
+  };
+
+  static const char* const* operationNames() {
+    static const char* const names[OpCodeNum] = {"", "Get", "Put", "Append", "MultiGet", "MultiPut",
+                                                 "RegisterSession", "Scan", "CompareAndSwap", "Increment", "PutIfAbsent", "Txn",
+                                                 "Delete", "ExpireKeys"};
+    return names;
+  }
+
+  static int operationCode(const std::string& operation) {
+    const char* const* names = operationNames();
+    for (int code = 1; code < OpCodeNum; ++code) {
+      if (operation == names[code]) return code;
+    }
+    return OpCustom;
+  }
+
+  static bool operationName(int code, std::string* operation) {
+    if (code <= OpCustom || code >= OpCodeNum) return false;
+    operation->assign(operationNames()[code]);
+    return true;
   }
 
 public: 
@@ -199,23 +267,49 @@ public:
   */
   friend std::ostream& operator<<(std::ostream& os, const Op& obj) {
     os << "[MyClass:Operation{" + obj.Operation + "},Key{" + obj.Key + "},Value{" + obj.Value + "},ClientId{" +
-              obj.ClientId + "},RequestId{" + std::to_string(obj.RequestId) + "}";
+              std::to_string(obj.ClientId) + "},RequestId{" + std::to_string(obj.RequestId) + "}";
     return os;
   }
 
 private:
-  // 集成boost库，利用boost::serialization 库进行序列化和反序列化。
+  // 集成boost库，利用boost::serialization 库进行序列化和反序列化。现在只用于解析旧版本写入的日志
+  // 旧格式中 ClientId 是字符串，读取时用 LegacyClientId 转换；
+  // 版本0是最初的布局 Operation/Key/Value/ClientId/RequestId，版本1在 Value 之后加入了 Keys/Values（MultiGet/MultiPut）
   friend class boost::serialization::access;   
   template <class Archive>
-  void serialize(Archive& ar, const unsigned int version) {
+  void save(Archive& ar, const unsigned int /*version*/) const {
+    std::string clientId = std::to_string(ClientId);
     ar& Operation;
     ar& Key;
     ar& Value;
-    ar& ClientId;
+    ar& Keys;
+    ar& Values;
+    ar& clientId;
     ar& RequestId;
   }
+  template <class Archive>
+  void load(Archive& ar, const unsigned int version) {
+    std::string clientId;
+    ar& Operation;
+    ar& Key;
+    ar& Value;
+    Keys.clear();
+    Values.clear();
+    if (version >= 1) {
+      ar& Keys;
+      ar& Values;
+    }
+    ar& clientId;
+    ar& RequestId;
+    ClientId = LegacyClientId(clientId);
+    Timestamp = 0;
+    ExpireAt = 0;
+  }
+  BOOST_SERIALIZATION_SPLIT_MEMBER()
 };
 
+BOOST_CLASS_VERSION(Op, 1)
+
 
 
 ///////////////////////////////////////////////kvserver reply err to clerk
@@ -223,6 +317,10 @@ private:
 const std::string OK = "OK";
 const std::string ErrNoKey = "ErrNoKey";
 const std::string ErrWrongLeader = "ErrWrongLeader";
+const std::string ErrBadArgs = "ErrBadArgs";    // 请求参数不合法，例如MultiPut的键和值数量不一致
+const std::string ErrNotInteger = "ErrNotInteger";    // Increment 的当前值不是整数，或者自增后溢出
+const std::string ErrSessionExpired = "ErrSessionExpired";    // 客户端会话不存在或已过期，需要重新注册会话
+const std::string ErrCompacted = "ErrCompacted";    // Watch 要求的版本已经不在变更历史中，需要重新读取状态后从当前版本继续
 
 ////////////////////////////////////获取可用端口
 
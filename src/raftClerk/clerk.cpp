@@ -10,34 +10,12 @@ Clerk::Get 函数
 主要功能：获取数据库中指定键所对应的值
 */
 std::string Clerk::Get(std::string key) {
-  m_requestId++;    // 增加发送的请求ID
-  auto requestId = m_requestId;
-
-  int server = m_recentLeaderId;    // raft节点ID，应该向Leader发送请求
-  
-  // 构造请求参数
   raftKVRpcProctoc::GetArgs args;
   args.set_key(key);
-  args.set_clientid(m_clientId);
-  args.set_requestid(requestId);
-
-  // 向目标raft节点发送请求，并处理返回消息
-  while (true) {
-    raftKVRpcProctoc::GetReply reply;
-    // 发送请求
-    bool ok = m_servers[server]->Get(&args, &reply);    // RPC调用
-    if (!ok || reply.err() == ErrWrongLeader) {   // 如果通信失败或报领导错误，会一直更换其他raft节点重试
-    // 因为requestId没有改变，因此可能会因为RPC的丢失或者其他情况导致重试，kvserver层会保证不重复执行（线性一致性），这里只需要重新发起就行，不用担心会重复执行
-      server = (server + 1) % m_servers.size();
-      continue;
-    }
-    if (reply.err() == ErrNoKey) {  // 没有相应的键，没找到
-      return "";
-    }
-    if (reply.err() == OK) {  // 查询成功
-      m_recentLeaderId = server;
-      return reply.value();
-    }
+  raftKVRpcProctoc::GetReply reply;
+  callLeader(&args, &reply, &raftServerRpcUtil::Get);
+  if (reply.err() == OK) {  // 查询成功；没有相应的键（ErrNoKey）时返回空字符串
+    return reply.value();
   }
   return "";
 }
@@ -54,44 +32,245 @@ Append 函数
 */
 void Clerk::Append(std::string key, std::string value) { PutAppend(key, value, "Append"); }
 
+/*
+PutWithTTL 函数
+主要功能：写入键值对并设置存活时间，过期时间由Leader在提交时计算
+*/
+void Clerk::PutWithTTL(std::string key, std::string value, int64_t ttlMs) { PutAppend(key, value, "Put", ttlMs); }
+
 /*
 PutAppend 函数
 主要功能：根据操作类型执行 Put 或 Append 操作。
 */
-void Clerk::PutAppend(std::string key, std::string value, std::string op) {
-  // 增加请求ID
-  m_requestId++;
-  auto requestId = m_requestId;
-  auto server = m_recentLeaderId;
-
-  while (true){
-    // 构造请求参数，这里参数构造被放进了循环内部，原因？
-    raftKVRpcProctoc::PutAppendArgs args;
-    args.set_key(key);
-    args.set_value(value);
-    args.set_op(op);
-    args.set_clientid(m_clientId);
-    args.set_requestid(requestId);
-
-    raftKVRpcProctoc::PutAppendReply reply;
-
-    // 发送请求
-    bool ok = m_servers[server]->PutAppend(&args, &reply);
-    if (!ok || reply.err() == ErrWrongLeader) {
-      DPrintf("【Clerk::PutAppend】原以为的leader: {%d}请求失败, 向新leader{%d}重试  ，操作：{%s}", server, server + 1, op.c_str());
-      if (!ok) {
-        DPrintf("重试原因 ,rpc通信失败");
-      }
-      if (reply.err() == ErrWrongLeader) {
-        DPrintf("重试原因: 发送的目标不是leader");
-      }
-      server = (server + 1) % m_servers.size();  // try the next server
+void Clerk::PutAppend(std::string key, std::string value, std::string op, int64_t ttlMs) {
+  raftKVRpcProctoc::PutAppendArgs args;
+  args.set_key(key);
+  args.set_value(value);
+  args.set_op(op);
+  args.set_ttlms(ttlMs);
+  raftKVRpcProctoc::PutAppendReply reply;
+  callLeader(&args, &reply, &raftServerRpcUtil::PutAppend);
+}
+
+/*
+MultiGet 函数
+主要功能：一次读取多个键的值，返回值与keys一一对应，不存在的键对应空字符串
+*/
+std::vector<std::string> Clerk::MultiGet(const std::vector<std::string> &keys) {
+  raftKVRpcProctoc::MultiGetArgs args;
+  for (const auto &key : keys) {
+    args.add_keys(key);
+  }
+  raftKVRpcProctoc::MultiGetReply reply;
+  callLeader(&args, &reply, &raftServerRpcUtil::MultiGet);
+  return std::vector<std::string>(reply.values().begin(), reply.values().end());
+}
+
+/*
+MultiPut 函数
+主要功能：一次写入多个键值对，整批作为一条raft日志原子地生效
+注意：键和值的数量不一致时不发送请求，返回 false
+*/
+bool Clerk::MultiPut(const std::vector<std::string> &keys, const std::vector<std::string> &values) {
+  if (keys.size() != values.size()) {
+    DPrintf("【Clerk::MultiPut】键和值的数量不一致");
+    return false;
+  }
+  raftKVRpcProctoc::MultiPutArgs args;
+  for (size_t i = 0; i < keys.size(); ++i) {
+    args.add_keys(keys[i]);
+    args.add_values(values[i]);
+  }
+  raftKVRpcProctoc::MultiPutReply reply;
+  callLeader(&args, &reply, &raftServerRpcUtil::MultiPut);
+  return reply.err() == OK;
+}
+
+/*
+Scan 函数
+主要功能：范围查找，按页向Leader读取，直到范围读完或者取够 limit 个
+*/
+std::vector<std::pair<std::string, std::string>> Clerk::Scan(const std::string &start, const std::string &end,
+                                                             int limit) {
+  std::vector<std::pair<std::string, std::string>> result;
+  std::string cursor = start;
+  while (true) {
+    int pageLimit = SCAN_PAGE_MAX;
+    if (limit > 0) {
+      pageLimit = std::min<int>(pageLimit, limit - result.size());
+      if (pageLimit <= 0) break;
+    }
+    std::string next;
+    if (!ScanPage(cursor, end, pageLimit, &result, &next)) {
+      break;
+    }
+    cursor = std::move(next);
+  }
+  return result;
+}
+
+/*
+ScanPrefix 函数
+主要功能：查找所有以 prefix 开头的键，转换为范围 [prefix, prefix的后继)
+注意：后继是去掉末尾的 0xff 字节后把最后一个字节加一，全是 0xff（或空前缀）时没有上界
+*/
+std::vector<std::pair<std::string, std::string>> Clerk::ScanPrefix(const std::string &prefix, int limit) {
+  std::string end = prefix;
+  while (!end.empty() && static_cast<unsigned char>(end.back()) == 0xff) {
+    end.pop_back();
+  }
+  if (!end.empty()) {
+    end.back() = static_cast<char>(static_cast<unsigned char>(end.back()) + 1);
+  }
+  return Scan(prefix, end, limit);
+}
+
+/*
+ScanPage 函数
+主要功能：读取一页，与Get一样在通信失败或者对方不是Leader时换一个节点重试
+*/
+bool Clerk::ScanPage(const std::string &start, const std::string &end, int limit,
+                     std::vector<std::pair<std::string, std::string>> *result, std::string *next) {
+  raftKVRpcProctoc::ScanArgs args;
+  args.set_startkey(start);
+  args.set_endkey(end);
+  args.set_limit(limit);
+  raftKVRpcProctoc::ScanReply reply;
+  callLeader(&args, &reply, &raftServerRpcUtil::Scan);
+  for (int i = 0; i < reply.keys_size(); ++i) {
+    result->emplace_back(std::move(*reply.mutable_keys(i)), std::move(*reply.mutable_values(i)));
+  }
+  *next = reply.continuation();
+  return reply.err() == OK && reply.more();
+}
+
+/*
+CompareAndSwap 函数
+主要功能：比较并交换，与Put一样换节点重试，服务端保证重试的请求只执行一次并返回第一次执行的结果
+*/
+bool Clerk::CompareAndSwap(const std::string &key, const std::string &expected, const std::string &value,
+                           std::string *current) {
+  raftKVRpcProctoc::CompareAndSwapArgs args;
+  args.set_key(key);
+  args.set_expected(expected);
+  args.set_value(value);
+  raftKVRpcProctoc::CompareAndSwapReply reply;
+  callLeader(&args, &reply, &raftServerRpcUtil::CompareAndSwap);
+  if (current != nullptr) {
+    *current = reply.current();
+  }
+  return reply.err() == OK && reply.succeeded();
+}
+
+/*
+Increment 函数
+主要功能：原子自增
+*/
+bool Clerk::Increment(const std::string &key, int64_t delta, int64_t *value) {
+  raftKVRpcProctoc::IncrementArgs args;
+  args.set_key(key);
+  args.set_delta(delta);
+  raftKVRpcProctoc::IncrementReply reply;
+  callLeader(&args, &reply, &raftServerRpcUtil::Increment);
+  if (value != nullptr) {
+    *value = reply.value();
+  }
+  return reply.err() == OK;   // 当前值不是整数时是 ErrNotInteger
+}
+
+/*
+PutIfAbsent 函数
+主要功能：键不存在时写入
+*/
+bool Clerk::PutIfAbsent(const std::string &key, const std::string &value, std::string *current) {
+  raftKVRpcProctoc::PutIfAbsentArgs args;
+  args.set_key(key);
+  args.set_value(value);
+  raftKVRpcProctoc::PutIfAbsentReply reply;
+  callLeader(&args, &reply, &raftServerRpcUtil::PutIfAbsent);
+  if (current != nullptr) {
+    *current = reply.current();
+  }
+  return reply.err() == OK && reply.succeeded();
+}
+
+/*
+Delete 函数
+主要功能：删除一个键，服务端保证重试的删除只执行一次，返回值是第一次执行时键是否存在
+*/
+bool Clerk::Delete(const std::string &key) {
+  raftKVRpcProctoc::DeleteArgs args;
+  args.set_key(key);
+  raftKVRpcProctoc::DeleteReply reply;
+  callLeader(&args, &reply, &raftServerRpcUtil::Delete);
+  return reply.err() == OK && reply.deleted();
+}
+
+/*
+Watch 函数
+主要功能：长轮询一次键的变更，Watch 不写raft日志，不需要会话；任何节点都可以回复，RPC失败时换一个节点续传
+*/
+bool Clerk::Watch(const std::string &key, bool prefix, int64_t *revision,
+                  std::vector<raftKVRpcProctoc::WatchEvent> *events) {
+  int server = m_recentLeaderId;
+  raftKVRpcProctoc::WatchArgs args;
+  args.set_key(key);
+  args.set_prefix(prefix);
+  args.set_fromrevision(*revision);
+
+  events->clear();
+  while (true) {
+    raftKVRpcProctoc::WatchReply reply;
+    bool ok = m_servers[server]->Watch(&args, &reply);
+    if (!ok) {
+      server = (server + 1) % m_servers.size();
       continue;
     }
-    if (reply.err() == OK) {
-      m_recentLeaderId = server;
-      return;
+    *revision = reply.nextrevision();
+    if (reply.err() == ErrCompacted) {
+      return false;
+    }
+    for (auto &event : *reply.mutable_events()) {
+      events->push_back(std::move(event));
+    }
+    return true;
+  }
+}
+
+/*
+Txn 函数
+主要功能：提交一个多键条件事务，与Put一样换节点重试，服务端保证重试的事务只执行一次
+*/
+bool Clerk::Txn(raftKVRpcProctoc::TxnArgs txn, std::vector<raftKVRpcProctoc::TxnResult> *results) {
+  raftKVRpcProctoc::TxnReply reply;
+  callLeader(&txn, &reply, &raftServerRpcUtil::Txn);
+  if (reply.err() == ErrBadArgs) {
+    DPrintf("【Clerk::Txn】事务中的条件和操作太多");
+    return false;
+  }
+  if (results != nullptr) {
+    results->assign(reply.results().begin(), reply.results().end());
+  }
+  return reply.err() == OK && reply.succeeded();
+}
+
+/*
+RegisterSession 函数
+主要功能：向Leader注册一个新会话，失败或者对方不是Leader时换一个节点重试
+*/
+void Clerk::RegisterSession() {
+  int server = m_recentLeaderId;
+  raftKVRpcProctoc::RegisterSessionArgs args;
+  while (true) {
+    raftKVRpcProctoc::RegisterSessionReply reply;
+    bool ok = m_servers[server]->RegisterSession(&args, &reply);
+    if (!ok || reply.err() != OK) {
+      server = (server + 1) % m_servers.size();
+      continue;
     }
+    m_recentLeaderId = server;
+    m_clientId = reply.clientid();
+    return;
   }
 }
 
@@ -132,5 +311,5 @@ void Clerk::Init(std::string configFileName) {
 构造函数
 主要功能：初始化成员变量
 */
-Clerk::Clerk() : m_clientId(Uuid()), m_requestId(0), m_recentLeaderId(0) {}
+Clerk::Clerk() : m_clientId(0), m_requestId(0), m_recentLeaderId(0) {}
 
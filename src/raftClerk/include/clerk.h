@@ -6,6 +6,7 @@
 #ifndef SKIP_LIST_ON_RAFT_CLERK_H
 #define SKIP_LIST_ON_RAFT_CLERK_H
 
+#include <functional>
 #include <string>
 #include <vector>
 #include "raftServerRpcUtil.h"
@@ -23,24 +24,103 @@ public:
   void Put(std::string key, std::string value);
   void Append(std::string key, std::string value);
 
+  // 带过期时间的Put：ttlMs 毫秒后键被自动删除（由Leader定期提交删除命令，可能略晚于过期时间），之后普通的Put会清除TTL
+  void PutWithTTL(std::string key, std::string value, int64_t ttlMs);
+  bool Delete(const std::string &key);   // 删除键，返回键删除前是否存在
+
+  // 批量操作：整批请求只占用一次RPC往返和一条raft日志
+  std::vector<std::string> MultiGet(const std::vector<std::string> &keys);   // 不存在的键返回空字符串
+  // 键和值的数量不一致时不写入，返回 false
+  bool MultiPut(const std::vector<std::string> &keys, const std::vector<std::string> &values);
+
+  // 范围查找：按键的顺序返回 [start, end) 中最多 limit 个键值对，end 为空表示不限上界，limit <= 0 表示不限个数
+  // 结果由若干页组成，每页是一次独立的线性一致读
+  std::vector<std::pair<std::string, std::string>> Scan(const std::string &start, const std::string &end, int limit = 0);
+  std::vector<std::pair<std::string, std::string>> ScanPrefix(const std::string &prefix, int limit = 0);  // 前缀查找
+
+  // 读改写操作：比较和写入在服务端一次完成，只需要一轮共识
+  // 键当前的值等于 expected 时写入 value 并返回 true；失败时 current（不为空的话）返回键的当前值，键不存在时为空
+  bool CompareAndSwap(const std::string &key, const std::string &expected, const std::string &value,
+                      std::string *current = nullptr);
+  // 把键的值当作十进制整数加上 delta，键不存在时视为0；成功返回 true 并通过 value 返回新值，当前值不是整数时返回 false
+  bool Increment(const std::string &key, int64_t delta, int64_t *value = nullptr);
+  // 键不存在时写入 value 并返回 true；否则返回 false，current（不为空的话）返回键的当前值
+  bool PutIfAbsent(const std::string &key, const std::string &value, std::string *current = nullptr);
+
+  // 多键条件事务：txn 中填好比较条件和 Success/Failure 两组操作（会话ID和请求ID由Clerk填写），整个事务只需要一轮共识
+  // 返回比较条件是否全部成立；results（不为空的话）返回所执行的那一组操作的结果，与操作一一对应
+  bool Txn(raftKVRpcProctoc::TxnArgs txn, std::vector<raftKVRpcProctoc::TxnResult> *results = nullptr);
+
+  // 长轮询键（prefix 为true时是前缀）的变更：返回 *revision 之后的变更，没有变更时最多等待 WATCH_POLL_TIMEOUT，
+  // 返回后 *revision 更新为下一次调用的起点（*revision 为0表示只要之后的变更）；
+  // 返回 false 表示要求的版本已经不在服务端的变更历史中，调用者应重新读取状态，再用更新后的 *revision 继续
+  bool Watch(const std::string &key, bool prefix, int64_t *revision, std::vector<raftKVRpcProctoc::WatchEvent> *events);
+
 public:
   Clerk();  // 构造函数
 
 private:
-  // 生成一个随机的客户端标识符 clientId。
-  std::string Uuid() {
-    return std::to_string(rand()) + std::to_string(rand()) + std::to_string(rand()) + std::to_string(rand());
-  }
+  // 向kv server注册一个会话，得到的会话ID作为之后所有请求的 clientId；会话过期后也调用它重新注册
+  void RegisterSession();
+
+  // 读取一页范围查找的结果，返回范围内是否还有剩余，有的话 next 为下一页的起始键
+  bool ScanPage(const std::string &start, const std::string &end, int limit,
+                std::vector<std::pair<std::string, std::string>> *result, std::string *next);
 
   // 辅助函数，用于发送 Put 或 Append 请求
-  void PutAppend(std::string key, std::string value, std::string op);
+  void PutAppend(std::string key, std::string value, std::string op, int64_t ttlMs = 0);
+
+  // 填写会话ID和请求ID后通过 rpc 发给Leader，直到得到除换Leader和会话过期以外的回复
+  template <typename Args, typename Reply, typename Rpc>
+  void callLeader(Args *args, Reply *reply, Rpc rpc);
 
 private:
   std::vector<std::shared_ptr<raftServerRpcUtil>> m_servers;    // 保存与所有kvserver raft节点的通信接口
-  std::string m_clientId;   // 当前客户端的标识符ID
+  uint64_t m_clientId;   // 当前客户端的会话ID，0 表示还没有注册会话
   int m_requestId;    // 请求的ID，逐渐累加
   int m_recentLeaderId;   // 最近一次已知的 Raft leader 节点的编号
 };
 
+/*
+callLeader 函数模板
+主要功能：所有带会话的请求共用的发送和重试逻辑
+    1. 还没有会话时先注册，给请求分配一个新的请求ID
+    2. RPC失败或者对方不是Leader时换一个节点重试，请求ID不变，kvserver层的去重保证重试的请求不会重复执行
+    3. 会话过期时命令没有被执行，重新注册后用新的会话和请求ID重发；会话只有在长时间没有请求时才会过期，不会与还在重试的请求冲突
+    4. 其余的回复（成功或者ErrNoKey、ErrBadArgs等）交给调用者处理，并记住回复它的节点是Leader
+输入参数：
+    args：请求参数，会话ID和请求ID由这里填写
+    reply：回复
+    rpc：发送请求的可调用对象，以 (raftServerRpcUtil&, Args*, Reply*) 调用，返回RPC是否成功，例如 &raftServerRpcUtil::Get
+*/
+template <typename Args, typename Reply, typename Rpc>
+void Clerk::callLeader(Args *args, Reply *reply, Rpc rpc) {
+  if (m_clientId == 0) {
+    RegisterSession();
+  }
+  args->set_clientid(m_clientId);
+  args->set_requestid(++m_requestId);
+
+  int server = m_recentLeaderId;
+  while (true) {
+    reply->Clear();
+    bool ok = std::invoke(rpc, *m_servers[server], args, reply);
+    if (!ok || reply->err() == ErrWrongLeader) {
+      DPrintf("【Clerk::callLeader】原以为的leader: {%d}请求失败, 向下一个节点重试", server);
+      server = (server + 1) % m_servers.size();
+      continue;
+    }
+    if (reply->err() == ErrSessionExpired) {
+      RegisterSession();
+      server = m_recentLeaderId;    // 注册成功的节点就是Leader
+      args->set_clientid(m_clientId);
+      args->set_requestid(++m_requestId);
+      continue;
+    }
+    m_recentLeaderId = server;
+    return;
+  }
+}
+
 
 #endif
\ No newline at end of file
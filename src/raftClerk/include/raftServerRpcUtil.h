@@ -20,6 +20,16 @@ class raftServerRpcUtil {
     // RPC方法
     bool Get(raftKVRpcProctoc::GetArgs* GetArgs, raftKVRpcProctoc::GetReply* reply);
     bool PutAppend(raftKVRpcProctoc::PutAppendArgs* args, raftKVRpcProctoc::PutAppendReply* reply);
+    bool MultiGet(raftKVRpcProctoc::MultiGetArgs* args, raftKVRpcProctoc::MultiGetReply* reply);
+    bool MultiPut(raftKVRpcProctoc::MultiPutArgs* args, raftKVRpcProctoc::MultiPutReply* reply);
+    bool RegisterSession(raftKVRpcProctoc::RegisterSessionArgs* args, raftKVRpcProctoc::RegisterSessionReply* reply);
+    bool Scan(raftKVRpcProctoc::ScanArgs* args, raftKVRpcProctoc::ScanReply* reply);
+    bool CompareAndSwap(raftKVRpcProctoc::CompareAndSwapArgs* args, raftKVRpcProctoc::CompareAndSwapReply* reply);
+    bool Increment(raftKVRpcProctoc::IncrementArgs* args, raftKVRpcProctoc::IncrementReply* reply);
+    bool PutIfAbsent(raftKVRpcProctoc::PutIfAbsentArgs* args, raftKVRpcProctoc::PutIfAbsentReply* reply);
+    bool Txn(raftKVRpcProctoc::TxnArgs* args, raftKVRpcProctoc::TxnReply* reply);
+    bool Delete(raftKVRpcProctoc::DeleteArgs* args, raftKVRpcProctoc::DeleteReply* reply);
+    bool Watch(raftKVRpcProctoc::WatchArgs* args, raftKVRpcProctoc::WatchReply* reply);
 
     // 构造、析构函数
     raftServerRpcUtil(std::string ip, short port);
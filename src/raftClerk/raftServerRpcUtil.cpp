@@ -42,4 +42,111 @@ bool raftServerRpcUtil::PutAppend(raftKVRpcProctoc::PutAppendArgs *args, raftKVR
     std::cout << controller.ErrorText() << std::endl;
   }
   return !controller.Failed();
-}
\ No newline at end of file
+}
+/*
+MultiGet 函数
+主要功能：执行MultiGet RPC调用，一次请求读取多个键
+*/
+bool raftServerRpcUtil::MultiGet(raftKVRpcProctoc::MultiGetArgs *args, raftKVRpcProctoc::MultiGetReply *reply) {
+  MprpcController controller;
+  stub->MultiGet(&controller, args, reply, nullptr);
+  return !controller.Failed();
+}
+
+/*
+MultiPut 函数
+主要功能：执行MultiPut RPC调用，一次请求写入多个键值对
+*/
+bool raftServerRpcUtil::MultiPut(raftKVRpcProctoc::MultiPutArgs *args, raftKVRpcProctoc::MultiPutReply *reply) {
+  MprpcController controller;
+  stub->MultiPut(&controller, args, reply, nullptr);
+  if (controller.Failed()) {
+    std::cout << controller.ErrorText() << std::endl;
+  }
+  return !controller.Failed();
+}
+
+/*
+RegisterSession 函数
+主要功能：执行RegisterSession RPC调用，向kv server注册客户端会话
+*/
+bool raftServerRpcUtil::RegisterSession(raftKVRpcProctoc::RegisterSessionArgs *args,
+                                        raftKVRpcProctoc::RegisterSessionReply *reply) {
+  MprpcController controller;
+  stub->RegisterSession(&controller, args, reply, nullptr);
+  return !controller.Failed();
+}
+
+/*
+Scan 函数
+主要功能：执行Scan RPC调用，读取一页范围内的键值对
+*/
+bool raftServerRpcUtil::Scan(raftKVRpcProctoc::ScanArgs *args, raftKVRpcProctoc::ScanReply *reply) {
+  MprpcController controller;
+  stub->Scan(&controller, args, reply, nullptr);
+  return !controller.Failed();
+}
+
+/*
+CompareAndSwap 函数
+主要功能：执行CompareAndSwap RPC调用
+*/
+bool raftServerRpcUtil::CompareAndSwap(raftKVRpcProctoc::CompareAndSwapArgs *args,
+                                       raftKVRpcProctoc::CompareAndSwapReply *reply) {
+  MprpcController controller;
+  stub->CompareAndSwap(&controller, args, reply, nullptr);
+  return !controller.Failed();
+}
+
+/*
+Increment 函数
+主要功能：执行Increment RPC调用
+*/
+bool raftServerRpcUtil::Increment(raftKVRpcProctoc::IncrementArgs *args, raftKVRpcProctoc::IncrementReply *reply) {
+  MprpcController controller;
+  stub->Increment(&controller, args, reply, nullptr);
+  return !controller.Failed();
+}
+
+/*
+PutIfAbsent 函数
+主要功能：执行PutIfAbsent RPC调用
+*/
+bool raftServerRpcUtil::PutIfAbsent(raftKVRpcProctoc::PutIfAbsentArgs *args, raftKVRpcProctoc::PutIfAbsentReply *reply) {
+  MprpcController controller;
+  stub->PutIfAbsent(&controller, args, reply, nullptr);
+  return !controller.Failed();
+}
+
+/*
+Txn 函数
+主要功能：执行Txn RPC调用，提交一个多键条件事务
+*/
+bool raftServerRpcUtil::Txn(raftKVRpcProctoc::TxnArgs *args, raftKVRpcProctoc::TxnReply *reply) {
+  MprpcController controller;
+  stub->Txn(&controller, args, reply, nullptr);
+  if (controller.Failed()) {
+    std::cout << controller.ErrorText() << std::endl;
+  }
+  return !controller.Failed();
+}
+
+/*
+Delete 函数
+主要功能：执行Delete RPC调用
+*/
+bool raftServerRpcUtil::Delete(raftKVRpcProctoc::DeleteArgs *args, raftKVRpcProctoc::DeleteReply *reply) {
+  MprpcController controller;
+  stub->Delete(&controller, args, reply, nullptr);
+  return !controller.Failed();
+}
+
+/*
+Watch 函数
+主要功能：执行Watch RPC调用，没有变更时服务端会挂起一段时间再回复
+*/
+bool raftServerRpcUtil::Watch(raftKVRpcProctoc::WatchArgs *args, raftKVRpcProctoc::WatchReply *reply) {
+  MprpcController controller;
+  stub->Watch(&controller, args, reply, nullptr);
+  return !controller.Failed();
+}
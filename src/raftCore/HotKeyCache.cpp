@@ -0,0 +1,234 @@
+//
+// 热点键读缓存的具体实现
+//
+
+#include "HotKeyCache.h"
+#include <algorithm>
+#include <functional>
+#include "mprpcconfig.h"
+
+/*
+ReadCachePolicy::LoadFromConfig 函数
+主要功能：从配置文件中读取读缓存策略，配置项示例：
+        readCacheCapacity = 4096
+        readCacheShards = 16
+        readCacheAdmission = tinylfu   (或 clock)
+        readCacheMaxValueBytes = 65536
+*/
+void ReadCachePolicy::LoadFromConfig(const std::string &configFileName) {
+  MprpcConfig config;
+  config.LoadConfigFile(configFileName.c_str());
+
+  std::string value;
+  if (!(value = config.Load("readCacheCapacity")).empty()) capacity = strtoull(value.c_str(), nullptr, 10);
+  if (!(value = config.Load("readCacheShards")).empty()) shards = atoi(value.c_str());
+  if (!(value = config.Load("readCacheAdmission")).empty()) tinyLfu = value != "clock";
+  if (!(value = config.Load("readCacheMaxValueBytes")).empty()) maxValueBytes = strtoull(value.c_str(), nullptr, 10);
+}
+
+/*----------------------------------FrequencySketch----------------------------------------------------*/
+HotKeyCache::FrequencySketch::FrequencySketch(size_t capacity) {
+  m_width = 16;
+  while (m_width < capacity) m_width <<= 1;   // 向上取整到2的幂
+  m_table.assign(4 * m_width, 0);
+  m_sampleSize = std::max<size_t>(10 * capacity, 16);
+}
+
+size_t HotKeyCache::FrequencySketch::indexOf(uint64_t hash, int row) const {
+  static const uint64_t seeds[4] = {0xc3a5c85c97cb3127ULL, 0xb492b66fbe98f273ULL, 0x9ae16a3b2f90404fULL,
+                                    0xcbf29ce484222325ULL};
+  uint64_t h = (hash + seeds[row]) * seeds[(row + 1) & 3];
+  h ^= h >> 32;
+  return row * m_width + (h & (m_width - 1));
+}
+
+void HotKeyCache::FrequencySketch::Increment(uint64_t hash) {
+  for (int row = 0; row < 4; ++row) {
+    uint8_t &counter = m_table[indexOf(hash, row)];
+    if (counter < 15) ++counter;
+  }
+  if (++m_additions >= m_sampleSize) {
+    reset();
+  }
+}
+
+int HotKeyCache::FrequencySketch::Frequency(uint64_t hash) const {
+  int frequency = 15;
+  for (int row = 0; row < 4; ++row) {
+    frequency = std::min<int>(frequency, m_table[indexOf(hash, row)]);
+  }
+  return frequency;
+}
+
+/*
+reset 函数
+主要功能：所有计数器减半，很久以前的热点键的频率逐渐衰减，新的热点键才能进入缓存
+*/
+void HotKeyCache::FrequencySketch::reset() {
+  for (auto &counter : m_table) {
+    counter >>= 1;
+  }
+  m_additions /= 2;
+}
+
+/*----------------------------------HotKeyCache----------------------------------------------------*/
+HotKeyCache::HotKeyCache(const ReadCachePolicy &policy)
+    : m_capacity(policy.capacity), m_shardCapacity(0), m_maxValueBytes(policy.maxValueBytes) {
+  if (m_capacity == 0) {
+    return;
+  }
+  size_t shards = std::clamp<size_t>(policy.shards, 1, m_capacity);
+  m_shardCapacity = (m_capacity + shards - 1) / shards;
+  for (size_t i = 0; i < shards; ++i) {
+    auto shard = std::make_unique<Shard>();
+    shard->slots.reserve(m_shardCapacity);
+    shard->index.reserve(m_shardCapacity);
+    if (policy.tinyLfu) {
+      shard->sketch = std::make_unique<FrequencySketch>(m_shardCapacity);
+    }
+    m_shards.push_back(std::move(shard));
+  }
+}
+
+uint64_t HotKeyCache::hashOf(const std::string &key) {
+  uint64_t h = std::hash<std::string>{}(key);
+  h ^= h >> 33;   // std::hash 对字符串可能只是简单的乘加，这里再混合一次，高位也能用来选分片
+  h *= 0xff51afd7ed558ccdULL;
+  h ^= h >> 33;
+  return h;
+}
+
+/*
+Lookup 函数
+主要功能：查找缓存，命中时设置 CLOCK 访问位并拷贝出值；不论是否命中都计入访问频率
+*/
+bool HotKeyCache::Lookup(const std::string &key, std::string *value) {
+  if (!Enabled()) {
+    return false;
+  }
+  uint64_t hash = hashOf(key);
+  Shard &shard = shardOf(hash);
+  std::lock_guard<std::mutex> lg(shard.mtx);
+  if (shard.sketch != nullptr) {
+    shard.sketch->Increment(hash);
+  }
+  auto it = shard.index.find(key);
+  if (it == shard.index.end()) {
+    ++shard.stats.misses;
+    return false;
+  }
+  Slot &slot = shard.slots[it->second];
+  slot.referenced = true;
+  *value = slot.value;
+  ++shard.stats.hits;
+  return true;
+}
+
+/*
+Insert 函数
+主要功能：未命中的键从跳表读出后放进缓存
+    1. 分片没满时直接放入
+    2. 分片满了由 CLOCK 选出牺牲者；开启 TinyLFU 时新键的频率必须高于牺牲者，否则不放入，牺牲者保留
+*/
+void HotKeyCache::Insert(const std::string &key, const std::string &value) {
+  if (!Enabled() || value.size() > m_maxValueBytes) {
+    return;
+  }
+  uint64_t hash = hashOf(key);
+  Shard &shard = shardOf(hash);
+  std::lock_guard<std::mutex> lg(shard.mtx);
+  auto it = shard.index.find(key);
+  if (it != shard.index.end()) {    // 其他读线程已经放入了
+    shard.slots[it->second].referenced = true;
+    return;
+  }
+
+  size_t slot;
+  if (!shard.freeSlots.empty()) {
+    slot = shard.freeSlots.back();
+    shard.freeSlots.pop_back();
+  } else if (shard.slots.size() < m_shardCapacity) {
+    slot = shard.slots.size();
+    shard.slots.emplace_back();
+  } else {
+    slot = victimOf(shard);
+    if (shard.sketch != nullptr && shard.sketch->Frequency(hash) <= shard.sketch->Frequency(shard.slots[slot].hash)) {
+      ++shard.stats.rejections;
+      return;
+    }
+    eraseSlot(shard, slot);
+    shard.freeSlots.pop_back();   // eraseSlot 把槽位放进了空闲列表，这里直接使用
+  }
+
+  auto inserted = shard.index.emplace(key, slot).first;
+  Slot &entry = shard.slots[slot];
+  entry.key = &inserted->first;   // unordered_map 的节点地址不会变，槽位直接引用其中的键
+  entry.value = value;
+  entry.hash = hash;
+  entry.referenced = false;   // 新放入的键要再被访问一次才能躲过下一轮淘汰
+  ++shard.stats.admissions;
+}
+
+/*
+victimOf 函数
+主要功能：CLOCK 算法：从指针处开始扫描，被访问过的槽位清除访问位、给一次机会，遇到没有被访问过的槽位就选它
+注意：调用者需持有分片的锁，并保证分片已满（没有空槽位）；最多扫描两圈
+*/
+size_t HotKeyCache::victimOf(Shard &shard) {
+  while (true) {
+    size_t slot = shard.hand;
+    shard.hand = (shard.hand + 1) % shard.slots.size();
+    if (shard.slots[slot].referenced) {
+      shard.slots[slot].referenced = false;
+      continue;
+    }
+    return slot;
+  }
+}
+
+void HotKeyCache::eraseSlot(Shard &shard, size_t slot) {
+  Slot &entry = shard.slots[slot];
+  shard.index.erase(shard.index.find(*entry.key));
+  entry.key = nullptr;
+  entry.value = std::string();
+  entry.referenced = false;
+  shard.freeSlots.push_back(slot);
+}
+
+void HotKeyCache::Invalidate(const std::string &key) {
+  if (!Enabled()) {
+    return;
+  }
+  Shard &shard = shardOf(hashOf(key));
+  std::lock_guard<std::mutex> lg(shard.mtx);
+  auto it = shard.index.find(key);
+  if (it == shard.index.end()) {
+    return;
+  }
+  eraseSlot(shard, it->second);
+  ++shard.stats.invalidations;
+}
+
+void HotKeyCache::Clear() {
+  for (auto &shard : m_shards) {
+    std::lock_guard<std::mutex> lg(shard->mtx);
+    shard->index.clear();
+    shard->slots.clear();
+    shard->freeSlots.clear();
+    shard->hand = 0;
+  }
+}
+
+HotKeyCache::Stats HotKeyCache::GetStats() {
+  Stats total;
+  for (auto &shard : m_shards) {
+    std::lock_guard<std::mutex> lg(shard->mtx);
+    total.hits += shard->stats.hits;
+    total.misses += shard->stats.misses;
+    total.admissions += shard->stats.admissions;
+    total.rejections += shard->stats.rejections;
+    total.invalidations += shard->stats.invalidations;
+    total.size += shard->index.size();
+  }
+  return total;
+}
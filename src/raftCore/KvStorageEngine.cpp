@@ -0,0 +1,95 @@
+//
+// KV存储引擎的具体实现：跳表和B+树两种有序索引
+//
+
+#include "KvStorageEngine.h"
+#include <type_traits>
+#include "BPlusTree.h"
+#include "mprpcconfig.h"
+
+/*
+StorageEnginePolicy::LoadFromConfig 函数
+主要功能：从配置文件中读取存储引擎策略，配置项示例：
+        storageEngine = skiplist   (或 bplustree)
+        skipListMaxLevel = 6
+*/
+void StorageEnginePolicy::LoadFromConfig(const std::string &configFileName) {
+  MprpcConfig config;
+  config.LoadConfigFile(configFileName.c_str());
+
+  std::string value;
+  if (!(value = config.Load("storageEngine")).empty()) {
+    type = value == "bplustree" ? StorageEngineType::BPlusTree : StorageEngineType::SkipList;
+  }
+  if (!(value = config.Load("skipListMaxLevel")).empty()) skipListMaxLevel = atoi(value.c_str());
+}
+
+namespace {
+
+/*
+OrderedIndexEngine 类模板
+主要功能：把 SkipList 或 BPlusTree 适配成 KvStorageEngine，两者的接口相同，只有构造和批量加载不同
+*/
+template <typename Index>
+class OrderedIndexEngine : public KvStorageEngine {
+public:
+  template <typename... Args>
+  OrderedIndexEngine(const char *name, Args &&...args) : m_name(name), m_index(std::forward<Args>(args)...) {}
+
+  const char *Name() const override { return m_name; }
+
+  bool Get(const std::string &key, std::string *value) override { return m_index.search_element(key, *value); }
+
+  bool Put(const std::string &key, std::string value) override { return m_index.upsert(key, std::move(value)); }
+
+  void Append(const std::string &key, const std::string &suffix) override { m_index.append_element(key, suffix); }
+
+  bool Delete(const std::string &key) override { return m_index.delete_element(key); }
+
+  SegmentedValue *Find(const std::string &key) override {
+    SegmentedValue *found = nullptr;
+    m_index.update_in_place(key, [&found](SegmentedValue &value) -> void { found = &value; });
+    return found;
+  }
+
+  std::pair<SegmentedValue *, bool> FindOrInsert(const std::string &key) override { return m_index.try_emplace(key); }
+
+  void MultiPut(const std::vector<std::string> &keys, const std::vector<std::string> &values) override {
+    m_index.insert_set_elements(keys, values);
+  }
+
+  bool Scan(const std::string &start, const std::string &end, bool hasEnd, size_t limit,
+            std::vector<std::string> *keys, std::vector<std::string> *values, std::string *next) override {
+    return m_index.scan_elements(start, end, hasEnd, limit, keys, values, next);
+  }
+
+  void DumpTo(SkipListDump<std::string, SegmentedValue> *dumper) override { m_index.dump_to(dumper); }
+
+  void BulkLoad(std::vector<std::string> &&keys, std::vector<std::string> &&values) override {
+    if constexpr (std::is_same_v<Index, BPlusTree<std::string, SegmentedValue>>) {
+      m_index.insert_set_elements(std::move(keys), std::move(values));    // 空树上排序后自底向上建树
+    } else {
+      for (size_t i = 0; i < keys.size() && i < values.size(); ++i) {
+        m_index.upsert(std::move(keys[i]), std::move(values[i]));
+      }
+    }
+  }
+
+  int Size() override { return m_index.size(); }
+
+  void Display() override { m_index.display_list(); }
+
+private:
+  const char *m_name;
+  Index m_index;
+};
+
+}  // namespace
+
+std::unique_ptr<KvStorageEngine> KvStorageEngine::Create(const StorageEnginePolicy &policy) {
+  if (policy.type == StorageEngineType::BPlusTree) {
+    return std::make_unique<OrderedIndexEngine<BPlusTree<std::string, SegmentedValue>>>("bplustree");
+  }
+  return std::make_unique<OrderedIndexEngine<SkipList<std::string, SegmentedValue>>>("skiplist",
+                                                                                      policy.skipListMaxLevel);
+}
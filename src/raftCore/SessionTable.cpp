@@ -0,0 +1,211 @@
+//
+// 客户端会话表的具体实现
+//
+
+#include "SessionTable.h"
+#include "codec.h"
+
+SessionTable::SessionTable(size_t capacity) {
+  size_t c = 16;
+  while (c < capacity) c <<= 1;   // 向上取整到2的幂
+  m_slots.resize(c);
+}
+
+/*
+hashOf 函数
+主要功能：会话ID是连续的日志索引，直接取低位会让相邻的会话挤在一起，这里用 splitmix64 的混合步骤打散
+*/
+uint64_t SessionTable::hashOf(uint64_t id) {
+  id ^= id >> 30;
+  id *= 0xbf58476d1ce4e5b9ULL;
+  id ^= id >> 27;
+  id *= 0x94d049bb133111ebULL;
+  id ^= id >> 31;
+  return id;
+}
+
+size_t SessionTable::slotOf(uint64_t id) const {
+  size_t mask = m_slots.size() - 1;
+  size_t slot = hashOf(id) & mask;
+  while (m_slots[slot].id != 0 && m_slots[slot].id != id) {
+    slot = (slot + 1) & mask;
+  }
+  return slot;
+}
+
+SessionTable::Session *SessionTable::Find(uint64_t id) {
+  if (id == 0) return nullptr;
+  Session &session = m_slots[slotOf(id)];
+  return session.id == id ? &session : nullptr;
+}
+
+const SessionTable::Session *SessionTable::Find(uint64_t id) const {
+  if (id == 0) return nullptr;
+  const Session &session = m_slots[slotOf(id)];
+  return session.id == id ? &session : nullptr;
+}
+
+/*
+rehash 函数
+主要功能：把所有会话搬到一个新容量的槽位数组中
+注意：链表是用会话ID链接的，搬移后不需要修改 prev/next
+*/
+void SessionTable::rehash(size_t capacity) {
+  std::vector<Session> old;
+  old.swap(m_slots);
+  m_slots.resize(capacity);
+  for (const auto &session : old) {
+    if (session.id != 0) {
+      m_slots[slotOf(session.id)] = session;
+    }
+  }
+}
+
+SessionTable::Session *SessionTable::Insert(uint64_t id, int64_t now) {
+  if (Session *session = Find(id)) {
+    return session;
+  }
+  if ((m_size + 1) * 4 > m_slots.size() * 3) {   // 装载因子超过 3/4 时扩容
+    rehash(m_slots.size() * 2);
+  }
+
+  Session &session = m_slots[slotOf(id)];
+  session = Session();
+  session.id = id;
+  session.lastActive = now;
+  ++m_size;
+  linkTail(session);
+  return &session;
+}
+
+void SessionTable::Touch(uint64_t id, int64_t now) {
+  Session *session = Find(id);
+  if (session == nullptr) return;
+  session->lastActive = now;
+  if (session->id != m_tail) {
+    unlink(*session);
+    linkTail(*session);
+  }
+}
+
+bool SessionTable::Erase(uint64_t id) {
+  if (id == 0) return false;
+  size_t slot = slotOf(id);
+  if (m_slots[slot].id != id) {
+    return false;
+  }
+  unlink(m_slots[slot]);
+  eraseSlot(slot);
+  --m_size;
+
+  if (m_slots.size() > 64 && m_size * 8 < m_slots.size()) {    // 会话大量过期后缩容，内存随会话数回落
+    rehash(m_slots.size() / 2);
+  }
+  return true;
+}
+
+/*
+eraseSlot 函数
+主要功能：清空一个槽位，并把后面探测链上的元素前移填补空位，保证线性探测的查找不会在空位处提前结束
+注意：槽位 i 上的元素只有在空位 hole 位于它的理想位置 home 和 i 之间时才能前移
+*/
+void SessionTable::eraseSlot(size_t slot) {
+  size_t mask = m_slots.size() - 1;
+  size_t hole = slot;
+  m_slots[hole] = Session();
+  for (size_t i = (hole + 1) & mask; m_slots[i].id != 0; i = (i + 1) & mask) {
+    size_t home = hashOf(m_slots[i].id) & mask;
+    if (((i - home) & mask) >= ((i - hole) & mask)) {
+      m_slots[hole] = m_slots[i];
+      m_slots[i] = Session();
+      hole = i;
+    }
+  }
+}
+
+size_t SessionTable::ExpireBefore(int64_t deadline) {
+  size_t count = 0;
+  while (m_head != 0 && Find(m_head)->lastActive < deadline) {
+    Erase(m_head);
+    ++count;
+  }
+  return count;
+}
+
+bool SessionTable::EvictOldest() { return Erase(m_head); }
+
+void SessionTable::Clear() {
+  m_slots.assign(16, Session());
+  m_size = 0;
+  m_head = 0;
+  m_tail = 0;
+}
+
+void SessionTable::linkTail(Session &session) {
+  session.prev = m_tail;
+  session.next = 0;
+  if (m_tail != 0) {
+    Find(m_tail)->next = session.id;
+  } else {
+    m_head = session.id;
+  }
+  m_tail = session.id;
+}
+
+void SessionTable::unlink(Session &session) {
+  if (session.prev != 0) {
+    Find(session.prev)->next = session.next;
+  } else {
+    m_head = session.next;
+  }
+  if (session.next != 0) {
+    Find(session.next)->prev = session.prev;
+  } else {
+    m_tail = session.prev;
+  }
+  session.prev = 0;
+  session.next = 0;
+}
+
+/*
+EncodeTo 函数
+主要功能：编码会话表，格式为 [会话个数][会话ID, 最后请求ID, 最后活跃时间, 执行结果, 返回值]...，按从旧到新的活跃顺序排列
+        链表指针和空槽都不写入，快照大小只和存活的会话数有关
+*/
+void SessionTable::EncodeTo(std::string *dst) const {
+  PutVarint64(dst, m_size);
+  for (uint64_t id = m_head; id != 0;) {
+    const Session *session = Find(id);
+    PutVarint64(dst, session->id);
+    PutVarint64(dst, ZigZagEncode(session->lastRequestId));
+    PutVarint64(dst, ZigZagEncode(session->lastActive));
+    PutVarint64(dst, ZigZagEncode(session->lastStatus));
+    PutVarint64(dst, ZigZagEncode(session->lastResult));
+    id = session->next;
+  }
+}
+
+bool SessionTable::DecodeFrom(std::string_view data) {
+  Clear();
+  const char *p = data.data();
+  const char *limit = data.data() + data.size();
+  uint64_t count = 0;
+  if (!GetVarint64(&p, limit, &count) || count > static_cast<uint64_t>(limit - p)) return false;   // 每个会话至少占5字节
+
+  size_t capacity = 16;
+  while (capacity * 3 < (count + 1) * 4) capacity <<= 1;
+  rehash(capacity);
+  for (uint64_t i = 0; i < count; ++i) {
+    uint64_t id = 0, requestId = 0, lastActive = 0, status = 0, result = 0;
+    if (!GetVarint64(&p, limit, &id) || !GetVarint64(&p, limit, &requestId) || !GetVarint64(&p, limit, &lastActive) ||
+        !GetVarint64(&p, limit, &status) || !GetVarint64(&p, limit, &result) || id == 0) {
+      Clear();
+      return false;
+    }
+    Session *session = Insert(id, ZigZagDecode(lastActive));   // 按编码顺序插入，链表顺序与编码时一致
+    session->lastRequestId = static_cast<int>(ZigZagDecode(requestId));
+    session->lastStatus = static_cast<int>(ZigZagDecode(status));
+    session->lastResult = ZigZagDecode(result);
+  }
+  return p == limit;
+}
@@ -0,0 +1,159 @@
+//
+// 快照调度器的具体实现
+//
+
+#include "SnapshotScheduler.h"
+#include <algorithm>
+#include "mprpcconfig.h"
+#include "util.h"
+
+/*
+SnapshotPolicy::LoadFromConfig 函数
+主要功能：从配置文件中读取快照策略，配置项示例：
+        snapshotTriggerRatio = 0.1
+        snapshotJitterRatio = 0.25
+        snapshotHardLimitRatio = 0.2
+        snapshotSlotMs = 2000
+        snapshotMinIntervalMs = 0
+*/
+void SnapshotPolicy::LoadFromConfig(const std::string &configFileName) {
+  MprpcConfig config;
+  config.LoadConfigFile(configFileName.c_str());
+
+  std::string value;
+  if (!(value = config.Load("snapshotTriggerRatio")).empty()) triggerRatio = atof(value.c_str());
+  if (!(value = config.Load("snapshotJitterRatio")).empty()) jitterRatio = atof(value.c_str());
+  if (!(value = config.Load("snapshotHardLimitRatio")).empty()) hardLimitRatio = atof(value.c_str());
+  if (!(value = config.Load("snapshotSlotMs")).empty()) slotMs = atoi(value.c_str());
+  if (!(value = config.Load("snapshotMinIntervalMs")).empty()) minIntervalMs = atoi(value.c_str());
+}
+
+/*
+构造函数
+主要功能：初始化调度器，随机数种子中混入节点编号，保证不同节点抽到不同的触发点
+*/
+SnapshotScheduler::SnapshotScheduler(int me, int peerCount, int maxRaftState)
+    : m_me(me),
+      m_peerCount(std::max(peerCount, 1)),
+      m_maxRaftState(maxRaftState),
+      m_trigger(0),
+      m_rng(std::random_device{}() ^ (static_cast<unsigned>(me) * 2654435761u)),
+      m_lastSampleTime(std::chrono::steady_clock::now()),
+      m_lastSampleSize(0),
+      m_bytesPerSec(0),
+      m_snapshotMs(0),
+      m_lastSnapshotTime(std::chrono::steady_clock::now()) {
+  resampleTrigger();
+}
+
+void SnapshotScheduler::SetPolicy(const SnapshotPolicy &policy) {
+  std::lock_guard<std::mutex> lg(m_mtx);
+  m_policy = policy;
+  resampleTrigger();
+}
+
+/*
+ShouldSnapshot 函数
+主要功能：判断现在是否应该制作快照，判断顺序：
+    1. 超过硬上限：立即快照
+    2. 未达到本轮随机触发点，或距离上次快照太近：不快照
+    3. 处于自己的错峰窗口，并且窗口剩余的时间够做完一次快照：快照
+    4. 否则根据状态增长速率预估等到自己的（下一个）窗口时是否会超过硬上限，会的话提前快照
+*/
+bool SnapshotScheduler::ShouldSnapshot(long long raftStateSize) {
+  std::lock_guard<std::mutex> lg(m_mtx);
+  updateRate(raftStateSize);
+
+  double hardLimit = m_maxRaftState * std::max(m_policy.hardLimitRatio, m_policy.triggerRatio);
+  if (raftStateSize > hardLimit) {
+    return true;
+  }
+
+  if (raftStateSize <= m_trigger) {
+    return false;
+  }
+
+  if (m_policy.minIntervalMs > 0) {
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() -
+                                                                         m_lastSnapshotTime);
+    if (elapsed.count() < m_policy.minIntervalMs) {
+      return false;
+    }
+  }
+
+  // 窗口按墙上时钟划分，各节点才能对"现在是谁的窗口"达成一致
+  long long nowMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+                        std::chrono::system_clock::now().time_since_epoch()).count();
+  long long slot = std::max(m_policy.slotMs, 1);
+  long long waitMs = msUntilMyWindow(nowMs);
+  if (waitMs == 0) {
+    long long leftMs = slot - nowMs % slot;
+    // 窗口本身比一次快照还短时剩余时间永远不够，这时不再等待
+    if (m_snapshotMs <= leftMs || m_snapshotMs >= slot) {
+      return true;
+    }
+    waitMs = leftMs + (m_peerCount - 1) * slot;   // 等下一个自己的窗口
+  }
+
+  // 估算等到自己的窗口这段时间内状态会增长多少
+  double projectedSize = raftStateSize + m_bytesPerSec * waitMs / 1000.0;
+  return projectedSize > hardLimit;
+}
+
+/*
+OnSnapshotDone 函数
+主要功能：快照完成后记录耗时，重置速率统计的起点，并重新抽取下一轮的随机触发点
+注意：快照耗时超过窗口长度时错峰基本失效，打印提示，应调大 snapshotSlotMs
+*/
+void SnapshotScheduler::OnSnapshotDone(long long raftStateSize, std::chrono::steady_clock::duration cost) {
+  std::lock_guard<std::mutex> lg(m_mtx);
+  double costMs = std::chrono::duration<double, std::milli>(cost).count();
+  m_snapshotMs = m_snapshotMs <= 0 ? costMs : 0.3 * costMs + 0.7 * m_snapshotMs;
+  if (m_snapshotMs > m_policy.slotMs) {
+    DPrintf("[SnapshotScheduler] 快照平均耗时 %.0fms 超过错峰窗口 %dms，建议调大 snapshotSlotMs", m_snapshotMs,
+            m_policy.slotMs);
+  }
+
+  m_lastSnapshotTime = std::chrono::steady_clock::now();
+  m_lastSampleTime = m_lastSnapshotTime;
+  m_lastSampleSize = raftStateSize;
+  resampleTrigger();
+}
+
+int SnapshotScheduler::ownerOfWindow(long long nowMs) const {
+  long long slot = std::max(m_policy.slotMs, 1);
+  return static_cast<int>((nowMs / slot) % m_peerCount);
+}
+
+long long SnapshotScheduler::msUntilMyWindow(long long nowMs) const {
+  long long slot = std::max(m_policy.slotMs, 1);
+  int distance = (m_me - ownerOfWindow(nowMs) + m_peerCount) % m_peerCount;  // 还要经过几个窗口
+  if (distance == 0) {
+    return 0;
+  }
+  return (nowMs / slot + distance) * slot - nowMs;
+}
+
+void SnapshotScheduler::resampleTrigger() {
+  std::uniform_real_distribution<double> dist(0.0, std::max(m_policy.jitterRatio, 0.0));
+  m_trigger = m_maxRaftState * m_policy.triggerRatio * (1.0 + dist(m_rng));
+}
+
+/*
+updateRate 函数
+主要功能：至少间隔100ms采样一次，用指数加权移动平均平滑状态增长速率
+*/
+void SnapshotScheduler::updateRate(long long raftStateSize) {
+  auto nowTime = std::chrono::steady_clock::now();
+  double seconds = std::chrono::duration<double>(nowTime - m_lastSampleTime).count();
+  if (seconds < 0.1) {
+    return;
+  }
+
+  const double alpha = 0.3;
+  double bytesRate = std::max<long long>(raftStateSize - m_lastSampleSize, 0) / seconds;
+  m_bytesPerSec = m_bytesPerSec <= 0 ? bytesRate : alpha * bytesRate + (1 - alpha) * m_bytesPerSec;
+
+  m_lastSampleTime = nowTime;
+  m_lastSampleSize = raftStateSize;
+}
@@ -0,0 +1,242 @@
+//
+// 键变更通知的具体实现
+//
+
+#include "WatchHub.h"
+#include <algorithm>
+#include "config.h"
+#include "util.h"
+
+bool WatchHub::matches(const Watcher &watcher, const Event &event) {
+  if (watcher.prefix) {
+    return event.key.compare(0, watcher.key.size(), watcher.key) == 0;
+  }
+  return event.key == watcher.key;
+}
+
+/*
+Watch 函数
+主要功能：处理一个 Watch 请求
+    1. FromRevision 为0表示只关心之后的变更，从最后apply的日志之后开始
+    2. FromRevision 早于历史窗口时返回 ErrCompacted
+    3. 历史中已经有匹配的变更时直接回复，否则挂起，等待新的变更或超时
+*/
+bool WatchHub::Watch(const raftKVRpcProctoc::WatchArgs *args, raftKVRpcProctoc::WatchReply *reply,
+                     google::protobuf::Closure *done) {
+  Watcher watcher;
+  watcher.key = args->key();
+  watcher.prefix = args->prefix();
+  watcher.deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(WATCH_POLL_TIMEOUT);
+  watcher.reply = reply;
+  watcher.done = done;
+
+  std::lock_guard<std::mutex> lg(m_mtx);
+  m_watched = true;
+  m_lastWatchRevision = m_lastRevision;
+  // 还没有apply过任何日志时不知道版本号从哪里开始，from 先记为0，等第一条日志apply时再确定
+  watcher.from = args->fromrevision() > 0 ? args->fromrevision() : (m_lastRevision > 0 ? m_lastRevision + 1 : 0);
+  watcher.fromNow = args->fromrevision() <= 0;
+  if (fillReply(watcher)) {
+    return true;
+  }
+  m_watchers.push_back(std::move(watcher));
+  return false;
+}
+
+/*
+fillReply 函数
+主要功能：从历史中取出 watcher.from 之后匹配的变更填进reply
+注意：
+    调用者需持有 m_mtx。只看已经 Advance 过的版本号：apply一条日志时先追加变更再 Advance，
+    这期间到来的请求不会拿到只有一半的版本；没有匹配时把 watcher.from 推进到最后apply的日志之后
+*/
+bool WatchHub::fillReply(Watcher &watcher) {
+  raftKVRpcProctoc::WatchReply *reply = watcher.reply;
+  if (watcher.from == 0) {
+    return false;
+  }
+  if (watcher.from < m_firstRevision) {   // 需要的变更已经不在历史中
+    reply->set_err(ErrCompacted);
+    reply->set_nextrevision(m_lastRevision + 1);
+    return true;
+  }
+
+  auto it = std::lower_bound(m_history.begin(), m_history.end(), watcher.from,
+                             [](const Event &event, int64_t revision) { return event.revision < revision; });
+  int count = 0;
+  int64_t next = m_lastRevision + 1;
+  for (; it != m_history.end() && it->revision <= m_lastRevision; ++it) {
+    if (count >= WATCH_MAX_EVENTS && it->revision != reply->events(count - 1).revision()) {
+      next = it->revision;    // 本页满了，同一个版本号的变更已经全部放进来，下一页从这里开始
+      break;
+    }
+    if (!matches(watcher, *it)) {
+      continue;
+    }
+    auto *event = reply->add_events();
+    event->set_eventtype(it->type);
+    event->set_key(it->key);
+    event->set_value(it->value);
+    event->set_revision(it->revision);
+    ++count;
+  }
+
+  if (count == 0) {
+    watcher.from = std::max(watcher.from, m_lastRevision + 1);
+    return false;
+  }
+  reply->set_err(OK);
+  reply->set_nextrevision(next);
+  return true;
+}
+
+/*
+Advance 函数
+主要功能：记录最后apply的日志索引，这之前的变更对 Watch 可见
+注意：
+    重启后第一条apply的日志紧跟在快照之后，历史从这里开始才是完整的。
+    不记录变更时历史从下一条日志开始，这一批内登记的"只要之后的变更"的请求跟着推进到历史的起点：
+    一批日志在独占存储锁下apply，客户端观察不到批内的中间状态，看作在这一批之后登记即可；
+    明确要求了这些版本号的请求仍然在分发时得到 ErrCompacted
+*/
+void WatchHub::Advance(int64_t revision) {
+  std::lock_guard<std::mutex> lg(m_mtx);
+  startAt(revision);
+  m_lastRevision = revision;
+  if (!m_recording) {
+    m_firstRevision = revision + 1;
+    for (auto &watcher : m_watchers) {
+      if (watcher.fromNow) watcher.from = std::max(watcher.from, m_firstRevision);
+    }
+    m_dirty = m_dirty || !m_watchers.empty();
+  }
+}
+
+/*
+BeginBatch 函数
+主要功能：决定这一批日志是否记录变更，在apply线程独占存储锁之后、执行命令之前调用，同一批内不会改变
+    1. 有挂起的请求，或者最近 WATCH_HISTORY_MAX 条日志内收到过 Watch（长轮询的两次请求之间没有挂起的请求）时记录
+    2. 从不记录切换到记录时，历史从下一条日志开始；从记录切换到不记录时丢弃历史
+*/
+bool WatchHub::BeginBatch() {
+  std::lock_guard<std::mutex> lg(m_mtx);
+  bool recording = !m_watchers.empty() ||
+                   (m_watched && m_lastRevision - m_lastWatchRevision <= static_cast<int64_t>(WATCH_HISTORY_MAX));
+  if (recording && !m_recording && m_lastRevision > 0) {
+    m_firstRevision = m_lastRevision + 1;
+  } else if (!recording && m_recording) {
+    m_history.clear();
+    m_historyBytes = 0;
+    m_firstRevision = m_lastRevision + 1;
+  }
+  m_recording = recording;
+  return m_recording;
+}
+
+void WatchHub::Append(Event event) {
+  std::lock_guard<std::mutex> lg(m_mtx);
+  startAt(event.revision);
+  m_historyBytes += event.key.size() + event.value.size();
+  m_history.push_back(std::move(event));
+  m_dirty = true;
+  trimHistory();
+}
+
+/*
+startAt 函数
+主要功能：第一次收到apply的日志时确定历史的起点，之前登记的"只要之后的变更"的请求从这里开始
+*/
+void WatchHub::startAt(int64_t revision) {
+  if (m_lastRevision != 0 || !m_history.empty()) {
+    return;
+  }
+  m_firstRevision = revision;
+  for (auto &watcher : m_watchers) {
+    if (watcher.from == 0) watcher.from = revision;
+  }
+}
+
+/*
+trimHistory 函数
+主要功能：历史超过条数或字节数上限时从头部淘汰，同一个版本号的变更一起淘汰，保证历史窗口里的版本都是完整的
+*/
+void WatchHub::trimHistory() {
+  while (!m_history.empty() && (m_history.size() > WATCH_HISTORY_MAX || m_historyBytes > WATCH_HISTORY_BYTES)) {
+    int64_t revision = m_history.front().revision;
+    while (!m_history.empty() && m_history.front().revision == revision) {
+      m_historyBytes -= m_history.front().key.size() + m_history.front().value.size();
+      m_history.pop_front();
+    }
+    m_firstRevision = revision + 1;
+  }
+}
+
+/*
+Dispatch 函数
+主要功能：apply完一批日志后调用，把新的变更发给挂起的请求
+注意：每个请求只检查它的 from 之后的变更；回调由调用者在不持有任何锁时执行
+*/
+void WatchHub::Dispatch(std::vector<google::protobuf::Closure *> *ready) {
+  std::lock_guard<std::mutex> lg(m_mtx);
+  if (!m_dirty) {
+    return;
+  }
+  m_dirty = false;
+  size_t kept = 0;
+  for (size_t i = 0; i < m_watchers.size(); ++i) {
+    if (fillReply(m_watchers[i])) {
+      ready->push_back(m_watchers[i].done);
+    } else {
+      if (kept != i) m_watchers[kept] = std::move(m_watchers[i]);
+      ++kept;
+    }
+  }
+  m_watchers.resize(kept);
+}
+
+/*
+ExpireWatchers 函数
+主要功能：超时的请求回复空结果，NextRevision 是它已经检查到的位置，客户端从这里继续长轮询
+*/
+void WatchHub::ExpireWatchers(std::chrono::steady_clock::time_point now,
+                              std::vector<google::protobuf::Closure *> *ready) {
+  std::lock_guard<std::mutex> lg(m_mtx);
+  size_t kept = 0;
+  for (size_t i = 0; i < m_watchers.size(); ++i) {
+    Watcher &watcher = m_watchers[i];
+    if (watcher.deadline <= now) {
+      watcher.reply->set_err(OK);
+      watcher.reply->set_nextrevision(watcher.from == 0 ? 0 : std::max(watcher.from, m_lastRevision + 1));
+      ready->push_back(watcher.done);
+    } else {
+      if (kept != i) m_watchers[kept] = std::move(watcher);
+      ++kept;
+    }
+  }
+  m_watchers.resize(kept);
+}
+
+/*
+Reset 函数
+主要功能：安装快照后，快照之前的变更无从得知，清空历史；还在等待快照之前版本的请求回复 ErrCompacted
+*/
+void WatchHub::Reset(int64_t revision, std::vector<google::protobuf::Closure *> *ready) {
+  std::lock_guard<std::mutex> lg(m_mtx);
+  m_history.clear();
+  m_historyBytes = 0;
+  m_lastRevision = revision;
+  m_firstRevision = revision + 1;
+  m_dirty = false;
+  size_t kept = 0;
+  for (size_t i = 0; i < m_watchers.size(); ++i) {
+    Watcher &watcher = m_watchers[i];
+    if (watcher.from != 0 && watcher.from <= revision) {
+      fillReply(watcher);
+      ready->push_back(watcher.done);
+    } else {
+      if (kept != i) m_watchers[kept] = std::move(watcher);
+      ++kept;
+    }
+  }
+  m_watchers.resize(kept);
+}
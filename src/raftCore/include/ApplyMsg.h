@@ -6,6 +6,10 @@
 #ifndef APPLYMSG_H
 #define APPLYMSG_H
 
+#include <string>
+#include "MpscRing.h"
+#include "SharedBuffer.h"
+
 /*
 ApplyMsg 类用于在 Raft 协议中传递需要应用到状态机的消息。
 它包含了命令和快照相关的信息，并通过构造函数对所有成员变量进行初始化，确保初始状态的有效性和一致性。
@@ -17,7 +21,7 @@ public:
 
 public:
   bool CommandValid;    // 表示 Command 是否有效。
-  std::string Command;    // 表示需要应用到状态机的命令
+  SharedBuffer Command;   // 表示需要应用到状态机的命令，引用计数的只读缓冲区，在队列中传递时不拷贝数据
   int CommandIndex;    // 该命令在日志中的索引
   bool SnapshotValid;       // Snapshot是否有效
   std::string Snapshot;   // 快照数据
@@ -25,4 +29,7 @@ public:
   int SnapshotIndex;      // 快照的最后一个日志条目的索引
 };
 
+// raft节点向kv server传递ApplyMsg的通道：有界无锁队列，支持批量写入/批量取出，空闲时通过eventfd唤醒
+using ApplyChannel = MpscRing<ApplyMsg>;
+
 #endif
\ No newline at end of file
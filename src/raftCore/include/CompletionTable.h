@@ -0,0 +1,215 @@
+//
+// 等待apply的请求表：按日志索引分片、槽位预分配、请求对象池化复用
+//
+
+#ifndef SKIP_LIST_ON_RAFT_COMPLETIONTABLE_H
+#define SKIP_LIST_ON_RAFT_COMPLETIONTABLE_H
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+/*
+CompletionTable 类模板
+主要功能：保存"已经提交给raft、正在等待apply"的请求对象，键为日志索引
+设计：
+    1. 按日志索引分成 ShardNum 个分片，每个分片一把锁，登记和通知只锁对应的分片，不再争抢 KvServer::m_mtx
+    2. 每个分片预先分配 slotsPerShard 个槽位，索引 i 放在 (i / ShardNum) % slotsPerShard 槽，
+       同时在途的索引跨度超过容量时才退化到分片内的溢出哈希表
+    3. 请求对象 T 来自分片内的对象池，用完归还，T 内部的字符串等成员保留容量，热路径上不再有 new/delete
+要求：T 需要有 int raftIndex 和 std::chrono::steady_clock::time_point deadline 两个成员
+*/
+template <typename T>
+class CompletionTable {
+public:
+  static constexpr int ShardNum = 16;   // 分片数，必须是2的幂
+
+  explicit CompletionTable(int capacity = 4096);
+  ~CompletionTable();
+
+  CompletionTable(const CompletionTable &) = delete;
+  CompletionTable &operator=(const CompletionTable &) = delete;
+
+  T *Acquire(int raftIndex);      // 从对象池中取出一个请求对象
+  void Release(T *item);          // 把请求对象归还给对象池
+
+  // 登记请求对象。返回 false 表示该索引已经apply过了，调用者应按超时处理
+  // 如果该索引上已经有一个旧的请求（日志被新leader覆盖后重新分配到同一个索引），旧请求通过 displaced 返回
+  bool Register(T *item, T **displaced);
+
+  T *Take(int raftIndex);     // 该索引被apply，取出在上面等待的请求，没有则返回nullptr
+
+  void MarkApplied(int raftIndex);    // 更新已apply的最大索引
+
+  void CollectExpired(std::chrono::steady_clock::time_point now, std::vector<T *> *expired);   // 取出所有超时的请求
+
+private:
+  struct Slot {
+    int raftIndex = -1;   // -1表示空槽
+    T *item = nullptr;
+  };
+
+  struct Shard {
+    std::mutex mtx;
+    std::vector<Slot> slots;    // 预分配的槽位
+    std::unordered_map<int, T *> overflow;   // 槽位冲突时的溢出表
+    std::vector<T *> freeList;  // 对象池
+    int liveCount = 0;          // 在途请求数，为0时超时检查直接跳过
+  };
+
+  Shard &shardOf(int raftIndex) { return m_shards[raftIndex & (ShardNum - 1)]; }
+  Slot &slotOf(Shard &shard, int raftIndex) { return shard.slots[(raftIndex / ShardNum) % shard.slots.size()]; }
+
+private:
+  Shard m_shards[ShardNum];
+  std::atomic<int> m_lastApplied{0};
+};
+
+template <typename T>
+CompletionTable<T>::CompletionTable(int capacity) {
+  int slotsPerShard = std::max(capacity / ShardNum, 1);
+  for (auto &shard : m_shards) {
+    shard.slots.resize(slotsPerShard);
+    shard.freeList.reserve(slotsPerShard);
+    for (int i = 0; i < slotsPerShard; ++i) {
+      shard.freeList.push_back(new T());
+    }
+  }
+}
+
+template <typename T>
+CompletionTable<T>::~CompletionTable() {
+  for (auto &shard : m_shards) {
+    for (auto *item : shard.freeList) delete item;
+    for (auto &slot : shard.slots) delete slot.item;
+    for (auto &kv : shard.overflow) delete kv.second;
+  }
+}
+
+template <typename T>
+T *CompletionTable<T>::Acquire(int raftIndex) {
+  Shard &shard = shardOf(raftIndex);
+  T *item = nullptr;
+  {
+    std::lock_guard<std::mutex> lg(shard.mtx);
+    if (!shard.freeList.empty()) {
+      item = shard.freeList.back();
+      shard.freeList.pop_back();
+    }
+  }
+  if (item == nullptr) {  // 对象池耗尽才会真正分配，之后归还进池子，池子随负载增长
+    item = new T();
+  }
+  item->raftIndex = raftIndex;
+  return item;
+}
+
+template <typename T>
+void CompletionTable<T>::Release(T *item) {
+  Shard &shard = shardOf(item->raftIndex);
+  std::lock_guard<std::mutex> lg(shard.mtx);
+  shard.freeList.push_back(item);
+}
+
+template <typename T>
+bool CompletionTable<T>::Register(T *item, T **displaced) {
+  *displaced = nullptr;
+  int raftIndex = item->raftIndex;
+  Shard &shard = shardOf(raftIndex);
+  std::lock_guard<std::mutex> lg(shard.mtx);
+
+  // 在分片锁内检查，保证与 MarkApplied + Take 的顺序一致：要么这里看到已apply，要么Take能看到本次登记
+  if (raftIndex <= m_lastApplied.load(std::memory_order_acquire)) {
+    return false;
+  }
+
+  Slot &slot = slotOf(shard, raftIndex);
+  if (slot.raftIndex == raftIndex) {
+    *displaced = slot.item;
+    slot.item = item;
+    return true;
+  }
+  auto it = shard.overflow.find(raftIndex);
+  if (it != shard.overflow.end()) {
+    *displaced = it->second;
+    it->second = item;
+    return true;
+  }
+
+  if (slot.raftIndex == -1) {
+    slot.raftIndex = raftIndex;
+    slot.item = item;
+  } else {
+    shard.overflow.emplace(raftIndex, item);
+  }
+  ++shard.liveCount;
+  return true;
+}
+
+template <typename T>
+T *CompletionTable<T>::Take(int raftIndex) {
+  Shard &shard = shardOf(raftIndex);
+  std::lock_guard<std::mutex> lg(shard.mtx);
+  if (shard.liveCount == 0) {
+    return nullptr;
+  }
+
+  T *item = nullptr;
+  Slot &slot = slotOf(shard, raftIndex);
+  if (slot.raftIndex == raftIndex) {
+    item = slot.item;
+    slot.raftIndex = -1;
+    slot.item = nullptr;
+  } else {
+    auto it = shard.overflow.find(raftIndex);
+    if (it == shard.overflow.end()) {
+      return nullptr;
+    }
+    item = it->second;
+    shard.overflow.erase(it);
+  }
+  --shard.liveCount;
+  return item;
+}
+
+template <typename T>
+void CompletionTable<T>::MarkApplied(int raftIndex) {
+  Shard &shard = shardOf(raftIndex);
+  std::lock_guard<std::mutex> lg(shard.mtx);
+  int cur = m_lastApplied.load(std::memory_order_relaxed);
+  if (raftIndex > cur) {
+    m_lastApplied.store(raftIndex, std::memory_order_release);
+  }
+}
+
+template <typename T>
+void CompletionTable<T>::CollectExpired(std::chrono::steady_clock::time_point now, std::vector<T *> *expired) {
+  for (auto &shard : m_shards) {
+    std::lock_guard<std::mutex> lg(shard.mtx);
+    if (shard.liveCount == 0) {
+      continue;
+    }
+    for (auto &slot : shard.slots) {
+      if (slot.raftIndex != -1 && slot.item->deadline <= now) {
+        expired->push_back(slot.item);
+        slot.raftIndex = -1;
+        slot.item = nullptr;
+        --shard.liveCount;
+      }
+    }
+    for (auto it = shard.overflow.begin(); it != shard.overflow.end();) {
+      if (it->second->deadline <= now) {
+        expired->push_back(it->second);
+        it = shard.overflow.erase(it);
+        --shard.liveCount;
+      } else {
+        ++it;
+      }
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,115 @@
+//
+// 热点键读缓存：分片的有界哈希表，命中时不需要在跳表中逐层查找
+//
+
+#ifndef SKIP_LIST_ON_RAFT_HOTKEYCACHE_H
+#define SKIP_LIST_ON_RAFT_HOTKEYCACHE_H
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/*
+ReadCachePolicy 读缓存策略
+主要功能：描述读缓存的容量和准入策略，可以通过配置文件修改
+*/
+struct ReadCachePolicy {
+  size_t capacity = 0;    // 最多缓存的键数，0 表示关闭读缓存
+  int shards = 16;        // 分片数，每个分片一把锁
+  bool tinyLfu = true;    // true：TinyLFU 准入，新键的访问频率高于被淘汰的键才放进缓存；false：只用 CLOCK 淘汰，总是放入
+  size_t maxValueBytes = 64 * 1024;   // 值超过这个长度不缓存，避免少数大值挤掉大量热点键
+
+  void LoadFromConfig(const std::string &configFileName);   // 从配置文件中读取覆盖默认值（键不存在则保持默认）
+};
+
+/*
+HotKeyCache 类
+主要功能：缓存最近读取的热点键，Get 命中时直接返回值的拷贝
+设计：
+    1. 按键的哈希分成多个分片，每个分片是一个 unordered_map 加一个槽位数组，各有一把锁，读线程之间很少竞争
+    2. 淘汰使用 CLOCK：命中时只设置槽位的访问位，淘汰时指针扫过槽位，清除访问位，直到找到没有被访问过的槽位，
+       命中路径上不需要调整链表
+    3. 可选的 TinyLFU 准入：每个分片用一个 4 行的 Count-Min Sketch 近似统计键的访问频率（每个计数器最大15），
+       总次数达到容量的10倍时所有计数器减半，让频率跟随最近的访问；缓存已满时只有新键的频率高于 CLOCK 选出的牺牲者才放入，
+       扫描式的一次性读取不会冲掉热点键
+    4. 正确性由调用者保证：查找和填充都在存储的共享锁下进行，写入在独占锁下先使缓存失效，缓存中不会留下过期的值
+注意：线程安全
+*/
+class HotKeyCache {
+public:
+  struct Stats {
+    uint64_t hits = 0;            // 命中次数
+    uint64_t misses = 0;          // 未命中次数
+    uint64_t admissions = 0;      // 放进缓存的次数
+    uint64_t rejections = 0;      // TinyLFU 拒绝放入的次数
+    uint64_t invalidations = 0;   // 因为写入被移出缓存的次数
+    size_t size = 0;              // 当前缓存的键数
+
+    double HitRate() const { return hits + misses == 0 ? 0.0 : static_cast<double>(hits) / (hits + misses); }
+  };
+
+  explicit HotKeyCache(const ReadCachePolicy &policy);
+
+  bool Enabled() const { return m_capacity > 0; }
+
+  bool Lookup(const std::string &key, std::string *value);    // 命中时拷贝出值并返回 true
+
+  void Insert(const std::string &key, const std::string &value);    // 读取跳表之后填充，由准入策略决定是否放入
+
+  void Invalidate(const std::string &key);    // 键被修改或删除，从缓存中移除
+
+  void Clear();   // 安装快照时清空
+
+  Stats GetStats();   // 汇总各分片的统计
+
+private:
+  // Count-Min Sketch，近似统计访问频率
+  class FrequencySketch {
+  public:
+    explicit FrequencySketch(size_t capacity);
+    void Increment(uint64_t hash);
+    int Frequency(uint64_t hash) const;
+
+  private:
+    size_t indexOf(uint64_t hash, int row) const;
+    void reset();   // 所有计数器减半
+
+    std::vector<uint8_t> m_table;   // 4 行计数器连续存放
+    size_t m_width = 0;   // 每行的计数器个数，2的幂
+    size_t m_additions = 0;
+    size_t m_sampleSize = 0;
+  };
+
+  struct Slot {
+    const std::string *key = nullptr;   // 指向 index 中的键，nullptr 表示空槽
+    std::string value;
+    uint64_t hash = 0;
+    bool referenced = false;    // CLOCK 访问位
+  };
+
+  struct Shard {
+    std::mutex mtx;
+    std::unordered_map<std::string, size_t> index;    // 键 -> 槽位
+    std::vector<Slot> slots;
+    std::vector<size_t> freeSlots;    // 失效后空出来的槽位
+    size_t hand = 0;    // CLOCK 指针
+    std::unique_ptr<FrequencySketch> sketch;   // 关闭 TinyLFU 时为空
+    Stats stats;
+  };
+
+  static uint64_t hashOf(const std::string &key);
+  Shard &shardOf(uint64_t hash) { return *m_shards[(hash >> 32) % m_shards.size()]; }
+  size_t victimOf(Shard &shard);    // 用 CLOCK 选出一个牺牲者槽位
+  void eraseSlot(Shard &shard, size_t slot);
+
+private:
+  size_t m_capacity;    // 总容量，0 表示关闭
+  size_t m_shardCapacity;   // 每个分片的容量
+  size_t m_maxValueBytes;
+  std::vector<std::unique_ptr<Shard>> m_shards;
+};
+
+#endif
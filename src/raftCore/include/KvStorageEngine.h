@@ -0,0 +1,75 @@
+//
+// KV存储引擎接口：KvServer 的每个分区通过它访问有序索引，具体使用跳表还是B+树在启动时由配置决定
+//
+
+#ifndef SKIP_LIST_ON_RAFT_KVSTORAGEENGINE_H
+#define SKIP_LIST_ON_RAFT_KVSTORAGEENGINE_H
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+#include "util.h"
+#include "skipList.h"
+
+enum class StorageEngineType {
+  SkipList,     // 跳表（默认）
+  BPlusTree,    // B+树，节点内键连续存放，查找和范围扫描的缓存缺失更少
+};
+
+/*
+StorageEnginePolicy 存储引擎策略
+主要功能：选择存储引擎及其参数，可以通过配置文件修改；只在启动时生效，运行中不切换
+*/
+struct StorageEnginePolicy {
+  StorageEngineType type = StorageEngineType::SkipList;
+  int skipListMaxLevel = 6;   // 跳表的初始最高层级，随元素数量自动增长
+
+  void LoadFromConfig(const std::string &configFileName);   // 从配置文件中读取覆盖默认值（键不存在则保持默认）
+};
+
+/*
+KvStorageEngine 类
+主要功能：有序键值存储的抽象接口，键为 std::string，值为 SegmentedValue（Append 只拷贝追加的部分）
+注意：
+    与 SkipList 相同，写操作在引擎内部加锁，读操作不加锁；KvServer 用 m_storeMtx 保证读写不并发。
+    Find / FindOrInsert 返回的值指针在下一次写操作之前有效
+*/
+class KvStorageEngine {
+public:
+  virtual ~KvStorageEngine() = default;
+
+  virtual const char *Name() const = 0;
+
+  virtual bool Get(const std::string &key, std::string *value) = 0;   // 键存在时拷贝出值并返回 true
+
+  virtual bool Put(const std::string &key, std::string value) = 0;    // 插入或覆盖，返回是否插入了新键
+
+  virtual void Append(const std::string &key, const std::string &suffix) = 0;   // 追加到已有的值之后，键不存在时等同于Put
+
+  virtual bool Delete(const std::string &key) = 0;    // 返回键是否存在
+
+  virtual SegmentedValue *Find(const std::string &key) = 0;   // 键不存在时返回 nullptr，可以通过返回的指针原地修改值
+
+  // 键不存在时插入一个空值，返回值的指针和是否插入；一次查找完成“读-改-写”
+  virtual std::pair<SegmentedValue *, bool> FindOrInsert(const std::string &key) = 0;
+
+  virtual void MultiPut(const std::vector<std::string> &keys, const std::vector<std::string> &values) = 0;    // 批量插入或覆盖
+
+  // 范围查找，从 start 开始最多取 limit 个，hasEnd 时不包括 end；范围内还有元素时返回 true 并把下一个键放进 next
+  virtual bool Scan(const std::string &start, const std::string &end, bool hasEnd, size_t limit,
+                    std::vector<std::string> *keys, std::vector<std::string> *values, std::string *next) = 0;
+
+  virtual void DumpTo(SkipListDump<std::string, SegmentedValue> *dumper) = 0;   // 按键的顺序追加到 dumper 中，用于制作快照
+
+  // 把快照中的键值对装进空的引擎，键和值被移动
+  virtual void BulkLoad(std::vector<std::string> &&keys, std::vector<std::string> &&values) = 0;
+
+  virtual int Size() = 0;
+
+  virtual void Display() = 0;   // 显示所有元素，主要用于调试
+
+  static std::unique_ptr<KvStorageEngine> Create(const StorageEnginePolicy &policy);   // 按策略创建一个空的引擎
+};
+
+#endif
@@ -0,0 +1,75 @@
+//
+// 客户端会话表：开放寻址的扁平哈希表，会话按最后活跃时间串成链表，用于去重和会话过期
+//
+
+#ifndef SKIP_LIST_ON_RAFT_SESSIONTABLE_H
+#define SKIP_LIST_ON_RAFT_SESSIONTABLE_H
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/*
+SessionTable 类
+主要功能：替代 unordered_map<std::string, int>，保存每个客户端会话的最后请求ID和最后活跃时间
+设计：
+    1. 会话ID是注册该会话的那条日志的索引（64位整数），0 表示空槽
+    2. 线性探测的开放寻址哈希表，所有会话放在一块连续数组里；删除时把后面的元素前移填补空位（backward shift），不留墓碑，
+       会话数变少时数组也会缩小，内存只和当前存活的会话数有关
+    3. 会话按最后活跃时间串成双向链表，链表用会话ID而不是槽位链接，表内移动元素不影响链表；表头是最久未活跃的会话，
+       过期和淘汰都从表头摘除，不需要扫描整张表
+    4. 所有修改都由apply线程按日志顺序进行，时间也取自日志，因此各副本的会话表完全一致
+注意：不是线程安全的，调用者需加锁；Find 返回的指针在下一次插入或删除之后失效
+*/
+class SessionTable {
+public:
+  struct Session {
+    uint64_t id = 0;          // 会话ID，0 表示空槽
+    int lastRequestId = 0;    // 该会话最后一个被apply的请求ID
+    int lastStatus = 0;       // 最后一个请求的执行结果（CAS等读改写操作使用），重复的请求直接返回它，不再执行
+    int64_t lastResult = 0;   // 最后一个请求的返回值，例如 Increment 之后的新值
+    int64_t lastActive = 0;   // 最后活跃时间（日志中记录的Leader时间，毫秒）
+    uint64_t prev = 0;        // 活跃链表中前一个（更久未活跃的）会话
+    uint64_t next = 0;        // 活跃链表中后一个会话
+  };
+
+  explicit SessionTable(size_t capacity = 64);
+
+  Session *Find(uint64_t id);
+  const Session *Find(uint64_t id) const;
+
+  Session *Insert(uint64_t id, int64_t now);  // 新建会话并放到链表尾部，会话已存在时直接返回它
+
+  void Touch(uint64_t id, int64_t now);   // 更新会话的活跃时间，并移到链表尾部
+
+  bool Erase(uint64_t id);    // 删除会话，返回会话是否存在
+
+  size_t ExpireBefore(int64_t deadline);  // 删除所有最后活跃时间早于 deadline 的会话，返回删除的个数
+
+  bool EvictOldest();   // 删除最久未活跃的会话，表为空时返回 false
+
+  size_t Size() const { return m_size; }
+
+  void Clear();
+
+  void EncodeTo(std::string *dst) const;    // 按活跃顺序编码，解码后链表顺序不变，缓存的执行结果一起编码
+
+  bool DecodeFrom(std::string_view data);   // 解码快照中的会话表，数据不完整时返回 false
+
+private:
+  static uint64_t hashOf(uint64_t id);
+  size_t slotOf(uint64_t id) const;   // 返回 id 所在的槽位，不存在时返回应插入的空槽
+  void rehash(size_t capacity);
+  void linkTail(Session &session);
+  void unlink(Session &session);
+  void eraseSlot(size_t slot);
+
+private:
+  std::vector<Session> m_slots;   // 槽位数组，容量总是2的幂，装载因子不超过 3/4
+  size_t m_size = 0;
+  uint64_t m_head = 0;    // 最久未活跃的会话
+  uint64_t m_tail = 0;    // 最近活跃的会话
+};
+
+#endif
@@ -0,0 +1,74 @@
+//
+// 快照调度器：根据raft状态大小和apply速率决定何时制作快照，并在副本之间错开快照时机
+//
+
+#ifndef SKIP_LIST_ON_RAFT_SNAPSHOTSCHEDULER_H
+#define SKIP_LIST_ON_RAFT_SNAPSHOTSCHEDULER_H
+
+#include <chrono>
+#include <mutex>
+#include <random>
+#include <string>
+
+/*
+SnapshotPolicy 快照策略
+主要功能：描述快照触发的各项参数，启动时从配置文件读取
+所有比例都是相对于 m_maxRaftState 而言的
+*/
+struct SnapshotPolicy {
+  double triggerRatio = 0.1;      // raft状态超过 maxRaftState * triggerRatio 后才具备快照资格（原先写死的 /10.0）
+  double jitterRatio = 0.25;      // 触发点的随机抖动范围：[trigger, trigger * (1 + jitterRatio)]，每次快照后重新抽取
+  double hardLimitRatio = 0.2;    // 超过 maxRaftState * hardLimitRatio 时无视错峰窗口，立即快照，防止日志无限增长
+  int slotMs = 2000;              // 错峰窗口的长度（毫秒），窗口按时间轮流分配给各个节点，应明显长于一次快照的耗时
+  int minIntervalMs = 0;          // 两次快照之间的最小时间间隔，0表示不限制
+
+  void LoadFromConfig(const std::string &configFileName);   // 从配置文件中读取覆盖默认值（键不存在则保持默认）
+};
+
+/*
+SnapshotScheduler 快照调度器
+主要功能：
+    1. 每个节点的触发点在阈值上随机抖动，避免所有副本在同一个日志索引处同时快照
+    2. 按墙上时钟把时间轴切成长度为 slotMs 的窗口，第 k 个窗口只属于节点 k % peerCount，
+       各节点的时钟偏差远小于窗口长度时，同一时刻最多只有一个节点在做快照（少数派）；
+       窗口按时间而不是日志索引划分，窗口长度与快照耗时可以直接比较，也不会因为apply一批日志只检查一次而被整个跳过
+    3. 记录快照的耗时，窗口剩余的时间不够做完一次快照时等下一个自己的窗口
+    4. 统计状态增长速率，预估在轮到自己的窗口之前是否会突破硬上限，如果会就提前快照
+*/
+class SnapshotScheduler {
+public:
+  SnapshotScheduler(int me, int peerCount, int maxRaftState);
+
+  void SetPolicy(const SnapshotPolicy &policy);
+
+  // apply一批日志后调用，返回现在是否应该制作快照
+  bool ShouldSnapshot(long long raftStateSize);
+
+  // 快照完成后调用：记录快照的耗时，重置统计并重新抽取触发点
+  void OnSnapshotDone(long long raftStateSize, std::chrono::steady_clock::duration cost);
+
+private:
+  int ownerOfWindow(long long nowMs) const;    // 当前时刻所在窗口属于哪个节点
+  long long msUntilMyWindow(long long nowMs) const;    // 距离下一个属于自己的窗口还有多少毫秒，正处于自己的窗口时为0
+  void resampleTrigger();   // 重新抽取随机触发点
+  void updateRate(long long raftStateSize);  // 更新状态增长速率
+
+private:
+  std::mutex m_mtx;
+  SnapshotPolicy m_policy;
+  int m_me;
+  int m_peerCount;
+  int m_maxRaftState;
+
+  double m_trigger;     // 本轮抽取出的触发阈值（字节）
+  std::mt19937 m_rng;
+
+  // 速率统计（指数加权移动平均）
+  std::chrono::steady_clock::time_point m_lastSampleTime;
+  long long m_lastSampleSize;
+  double m_bytesPerSec;     // raft状态增长速率：字节/秒
+  double m_snapshotMs;      // 制作一次快照的耗时（毫秒），还没有做过快照时为0
+  std::chrono::steady_clock::time_point m_lastSnapshotTime;
+};
+
+#endif
@@ -0,0 +1,25 @@
+//
+// 状态机接口：raft把已经提交的日志批量交给上层状态机应用
+//
+
+#ifndef SKIP_LIST_ON_RAFT_STATEMACHINE_H
+#define SKIP_LIST_ON_RAFT_STATEMACHINE_H
+
+#include <span>
+#include "ApplyMsg.h"
+
+/*
+StateMachine 状态机接口
+主要功能：apply线程每次从通道中取出当前所有可用的消息，一次性交给 Apply
+    实现者应当在一个临界区内按顺序应用整批消息，并把快照检查、唤醒等待者这类工作放到整批结束之后做一次，
+    这样apply的吞吐随批大小增长，而不是受加锁次数限制
+*/
+class StateMachine {
+public:
+  virtual ~StateMachine() = default;
+
+  // 按日志顺序应用一批消息，消息可能是命令也可能是快照
+  virtual void Apply(std::span<ApplyMsg> messages) = 0;
+};
+
+#endif
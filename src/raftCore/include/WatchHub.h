@@ -0,0 +1,87 @@
+//
+// 键变更通知：保存最近的变更历史，按版本号（日志索引）续传，供 Watch 长轮询使用
+//
+
+#ifndef SKIP_LIST_ON_RAFT_WATCHHUB_H
+#define SKIP_LIST_ON_RAFT_WATCHHUB_H
+
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "kvServerRPC.pb.h"
+
+/*
+WatchHub 类
+主要功能：apply线程把每条日志产生的键变更追加进来，客户端用 Watch 长轮询从某个版本号开始读取变更
+设计：
+    1. 版本号就是产生变更的那条日志的索引，同一条日志（例如MultiPut、Txn）产生的变更版本号相同，各副本完全一致
+    2. 历史是有界的环形窗口（WATCH_HISTORY_MAX 条、WATCH_HISTORY_BYTES 字节），客户端要求的版本号已经被淘汰
+       （或者在快照之前）时返回 ErrCompacted，客户端重新读取状态后从当前版本号继续
+    3. 没有新变更时请求挂起，直到有匹配的变更或者超时；挂起的请求记录自己已经检查到的版本号，
+       每次分发只检查新追加的变更，不会重复扫描历史
+    4. 每次回复最多 WATCH_MAX_EVENTS 条变更（同一个版本号的变更不拆开），客户端用回复中的 NextRevision 续传，
+       每个观察者需要的缓冲就是它自己的这一页，慢的观察者不会拖住apply线程
+注意：Watch 不经过raft日志，由收到请求的节点直接回复，事件的顺序和内容只取决于已经apply的日志，换节点续传也不会漏或乱序
+*/
+class WatchHub {
+public:
+  // 在第 revision 条日志上产生的一个键变更
+  struct Event {
+    int64_t revision = 0;
+    raftKVRpcProctoc::WatchEvent::Type type = raftKVRpcProctoc::WatchEvent::PUT;
+    std::string key;
+    std::string value;
+  };
+
+  // 登记一个 Watch 请求：已经有匹配的变更（或者出错）时直接填好reply返回 true，由调用者回复；否则挂起并返回 false
+  bool Watch(const raftKVRpcProctoc::WatchArgs *args, raftKVRpcProctoc::WatchReply *reply,
+             google::protobuf::Closure *done);
+
+  void Advance(int64_t revision);   // apply了第 revision 条日志（不论有没有变更），由apply线程按顺序调用
+
+  // apply一批日志之前调用，返回这一批是否需要记录变更。没有挂起的请求、并且最近 WATCH_HISTORY_MAX 条日志内没有收到过 Watch 时不记录，
+  // apply路径上不再拷贝键和值；不记录期间历史视为已淘汰，要求更早版本的请求返回 ErrCompacted
+  bool BeginBatch();
+
+  void Append(Event event);   // 追加一个变更，版本号不小于之前追加的
+
+
+  void Dispatch(std::vector<google::protobuf::Closure *> *ready);   // 把新变更分发给挂起的请求，完成的请求放进 ready
+
+  void ExpireWatchers(std::chrono::steady_clock::time_point now, std::vector<google::protobuf::Closure *> *ready);
+
+  void Reset(int64_t revision, std::vector<google::protobuf::Closure *> *ready);   // 安装快照后丢弃历史，版本号跳到 revision
+
+private:
+  struct Watcher {
+    std::string key;
+    bool prefix = false;
+    int64_t from = 0;   // 下一个要检查的版本号，之前的变更都已经检查过、没有匹配的；0 表示等第一条apply的日志
+    bool fromNow = false;   // 请求的 FromRevision 为0，只关心登记之后的变更
+    std::chrono::steady_clock::time_point deadline;
+    raftKVRpcProctoc::WatchReply *reply = nullptr;
+    google::protobuf::Closure *done = nullptr;
+  };
+
+  static bool matches(const Watcher &watcher, const Event &event);
+  bool fillReply(Watcher &watcher);   // 把 watcher.from 之后匹配的变更填进reply，没有匹配的变更时返回 false
+  void startAt(int64_t revision);
+  void trimHistory();
+
+private:
+  std::mutex m_mtx;
+  std::deque<Event> m_history;    // 按版本号递增排列的最近变更
+  size_t m_historyBytes = 0;      // 历史中键和值的总字节数
+  int64_t m_firstRevision = 1;    // 从这个版本号开始的变更都在历史中
+  int64_t m_lastRevision = 0;     // 最后一条apply的日志索引
+  bool m_dirty = false;           // 上次分发之后是否追加了新变更
+  bool m_recording = false;       // 当前这一批是否记录变更，由 BeginBatch 决定
+  bool m_watched = false;         // 是否收到过 Watch 请求
+  int64_t m_lastWatchRevision = 0;    // 收到最近一个 Watch 请求时最后apply的日志索引
+  std::vector<Watcher> m_watchers;    // 挂起的请求
+};
+
+#endif
@@ -16,21 +16,35 @@
 #include <boost/serialization/serialization.hpp>
 #include <boost/serialization/unordered_map.hpp>
 #include <boost/serialization/vector.hpp>
+#include <boost/serialization/version.hpp>
 #include "kvServerRPC.pb.h"
 #include "ApplyMsg.h"
 #include "raft.h"
 #include "skipList.h"
+#include "SnapshotScheduler.h"
+#include "CompletionTable.h"
+#include "HotKeyCache.h"
+#include "KvStorageEngine.h"
+#include "SessionTable.h"
+#include "StateMachine.h"
+#include "WatchHub.h"
 #include "util.h"
 #include "mprpcconfig.h"
 #include "rpcprovider.h"
+#include <atomic>
+#include <chrono>
 #include <iostream>
 #include <mutex>
+#include <set>
+#include <shared_mutex>
+#include <span>
 #include <unordered_map>
+#include <vector>
 
 /*
 键值存储服务器，它基于 Raft 共识算法实现。它通过 RPC 与客户端进行交互，同时通过 Raft 节点之间的通信保持一致性
 */
-class KvServer : raftKVRpcProctoc::kvServerRpc {
+class KvServer : raftKVRpcProctoc::kvServerRpc, public StateMachine {
 public:
   KvServer() = delete;    // 禁用默认构造函数
 
@@ -40,30 +54,92 @@ public:
 
   void DprintfKVDB();     // 打印键值数据库的内容
 
-  void ExecuteAppendOpOnKVDB(Op op);    // 执行 Append 操作
+  void DprintfReadCache();    // 打印热点键读缓存的命中率等统计
 
-  void ExecuteGetOpOnKVDB(Op op, std::string *value, bool *exist);  // 执行 Get 操作
+  HotKeyCache::Stats ReadCacheStats();    // 热点键读缓存的统计，没有开启时全为0
 
-  void ExecutePutOpOnKVDB(Op op);  // 执行 Put 操作
+  // 以下 Execute* 函数要求调用者已经持有 m_storeMtx：写操作独占，读操作共享；apply一批日志时整批只加一次锁
+  void ExecuteAppendOpOnKVDB(Op &op);    // 执行 Append 操作，op.Value 追加到键已有的值之后
 
-  void Get(const raftKVRpcProctoc::GetArgs *args,raftKVRpcProctoc::GetReply *reply);  // 从raft节点中获得消息，不是执行Get操作
+  void ExecuteGetOpOnKVDB(const Op &op, std::string *value, bool *exist);  // 执行 Get 操作
 
-  void GetCommandFromRaft(ApplyMsg message);      //  从 Raft 节点获取命令
+  void ExecutePutOpOnKVDB(Op &op);  // 执行 Put 操作，op.Value 会被移动进跳表
 
-  bool ifRequestDuplicate(std::string ClientId, int RequestId);   // 检查请求是否重复
+  void ExecuteMultiPutOpOnKVDB(const Op &op);  // 执行 MultiPut 操作，每个分区的键值对一次写入该分区的跳表
 
-  void PutAppend(const raftKVRpcProctoc::PutAppendArgs *args, raftKVRpcProctoc::PutAppendReply *reply);   // 处理 Put 和 Append 请求
+  void ExecuteMultiGetOpOnKVDB(const Op &op, std::vector<std::string> *values, std::vector<bool> *exists);  // 执行 MultiGet 操作
+
+  // 读改写操作：在apply时按日志顺序执行，返回 RmwStatus，各副本得到相同的结果
+  int ExecuteCompareAndSwapOpOnKVDB(Op &op);    // 当前值等于 op.Values[0] 时写入 op.Value
+  int ExecuteIncrementOpOnKVDB(const Op &op, int64_t *result);   // 当前值加上 op.Value，新值放进 result
+  int ExecutePutIfAbsentOpOnKVDB(Op &op);   // 键不存在时写入 op.Value
+
+  int ExecuteDeleteOpOnKVDB(const Op &op);   // 删除键，键存在时返回 RmwOk，否则返回 RmwFailed
+
+  // 执行 Txn 操作：检查所有比较条件，按结果执行 Success 或 Failure 中的操作，结果放进 result，返回条件是否成立
+  bool ExecuteTxnOpOnKVDB(const raftKVRpcProctoc::TxnArgs &txn, raftKVRpcProctoc::TxnReply *result);
+
+  // 执行 Scan 操作，取出 [op.Key, op.Value) 中最多 limit 个键值对，返回范围内是否还有剩余，有的话 next 为下一页的起始键
+  bool ExecuteScanOpOnKVDB(const Op &op, int limit, std::vector<std::string> *keys, std::vector<std::string> *values,
+                           std::string *next);
+
+  // 向raft提交Get请求并登记等待，立即返回，不阻塞RPC的IO线程；命令apply或超时后由apply线程调用done->Run()
+  void Get(const raftKVRpcProctoc::GetArgs *args, raftKVRpcProctoc::GetReply *reply, google::protobuf::Closure *done);
+
+  void Apply(std::span<ApplyMsg> messages) override;   // 批量应用raft交过来的命令和快照
+
+  void GetCommandFromRaft(const ApplyMsg &message);      //  从 Raft 节点获取命令（单条，等价于只有一条消息的 Apply）
+
+  bool ifRequestDuplicate(uint64_t ClientId, int RequestId);   // 检查请求是否重复
+
+  // 处理 Put 和 Append 请求，与Get一样异步完成
+  void PutAppend(const raftKVRpcProctoc::PutAppendArgs *args, raftKVRpcProctoc::PutAppendReply *reply,
+                 google::protobuf::Closure *done);
+
+  // 批量读写：整批请求只对应一条raft日志，要么全部生效要么全部不生效
+  void MultiGet(const raftKVRpcProctoc::MultiGetArgs *args, raftKVRpcProctoc::MultiGetReply *reply,
+                google::protobuf::Closure *done);
+
+  void MultiPut(const raftKVRpcProctoc::MultiPutArgs *args, raftKVRpcProctoc::MultiPutReply *reply,
+                google::protobuf::Closure *done);
+
+  // 范围查找：与Get一样作为一条命令提交给raft，apply后在读线程池中取出一页
+  void Scan(const raftKVRpcProctoc::ScanArgs *args, raftKVRpcProctoc::ScanReply *reply, google::protobuf::Closure *done);
+
+  // 读改写操作：与PutAppend一样作为一条命令提交，只需要一轮共识
+  void CompareAndSwap(const raftKVRpcProctoc::CompareAndSwapArgs *args, raftKVRpcProctoc::CompareAndSwapReply *reply,
+                      google::protobuf::Closure *done);
+
+  void Increment(const raftKVRpcProctoc::IncrementArgs *args, raftKVRpcProctoc::IncrementReply *reply,
+                 google::protobuf::Closure *done);
+
+  void PutIfAbsent(const raftKVRpcProctoc::PutIfAbsentArgs *args, raftKVRpcProctoc::PutIfAbsentReply *reply,
+                   google::protobuf::Closure *done);
+
+  // 多键条件事务：比较条件和两组操作编码进一条命令，apply时原子地执行
+  void Txn(const raftKVRpcProctoc::TxnArgs *args, raftKVRpcProctoc::TxnReply *reply, google::protobuf::Closure *done);
+
+  // 删除键：与PutAppend一样作为一条命令提交
+  void Delete(const raftKVRpcProctoc::DeleteArgs *args, raftKVRpcProctoc::DeleteReply *reply, google::protobuf::Closure *done);
+
+  // 长轮询键的变更：不经过raft日志，直接从本节点apply产生的变更历史中读取，没有新变更时挂起直到有变更或超时
+  void Watch(const raftKVRpcProctoc::WatchArgs *args, raftKVRpcProctoc::WatchReply *reply, google::protobuf::Closure *done);
+
+  // 注册客户端会话：作为一条命令提交给raft，会话ID就是这条命令的日志索引
+  void RegisterSession(raftKVRpcProctoc::RegisterSessionReply *reply, google::protobuf::Closure *done);
 
   void ReadRaftApplyCommandLoop();      // 循环读取 Raft 应用命令
 
-  void ReadSnapShotToInstall(std::string snapshot);     // 读取并安装快照
+  void ReadSnapShotToInstall(const std::string &snapshot);     // 读取并安装快照
 
-  bool SendMessageToWaitChan(const Op &op, int raftIndex);      // 向等待通道发送消息
+  void TimeoutWaitingRequests();      // 处理等待超时的请求
+
+  void ProposeExpiredKeys();    // Leader定期调用：把已经过期的键打包成一条删除命令提交给raft
 
   // 检查是否需要制作快照，需要的话就向raft发送命令
-  void IfNeedToSendSnapShotCommand(int raftIndex, int proportion);
+  void IfNeedToSendSnapShotCommand(int raftIndex);
 
-  void GetSnapShotFromRaft(ApplyMsg message);   // 从 Raft 获取快照
+  void GetSnapShotFromRaft(const ApplyMsg &message);   // 从 Raft 获取快照
 
   std::string MakeSnapShot();     // 制作快照
 
@@ -74,24 +150,85 @@ public:  // 重写的RPC方法
   void Get(google::protobuf::RpcController *controller, const ::raftKVRpcProctoc::GetArgs *request,
            ::raftKVRpcProctoc::GetReply *response, ::google::protobuf::Closure *done) override;
 
+  void MultiGet(google::protobuf::RpcController *controller, const ::raftKVRpcProctoc::MultiGetArgs *request,
+                ::raftKVRpcProctoc::MultiGetReply *response, ::google::protobuf::Closure *done) override;
+
+  void MultiPut(google::protobuf::RpcController *controller, const ::raftKVRpcProctoc::MultiPutArgs *request,
+                ::raftKVRpcProctoc::MultiPutReply *response, ::google::protobuf::Closure *done) override;
+
+  void RegisterSession(google::protobuf::RpcController *controller,
+                       const ::raftKVRpcProctoc::RegisterSessionArgs *request,
+                       ::raftKVRpcProctoc::RegisterSessionReply *response, ::google::protobuf::Closure *done) override;
+
+  void Scan(google::protobuf::RpcController *controller, const ::raftKVRpcProctoc::ScanArgs *request,
+            ::raftKVRpcProctoc::ScanReply *response, ::google::protobuf::Closure *done) override;
+
+  void CompareAndSwap(google::protobuf::RpcController *controller,
+                      const ::raftKVRpcProctoc::CompareAndSwapArgs *request,
+                      ::raftKVRpcProctoc::CompareAndSwapReply *response, ::google::protobuf::Closure *done) override;
+
+  void Increment(google::protobuf::RpcController *controller, const ::raftKVRpcProctoc::IncrementArgs *request,
+                 ::raftKVRpcProctoc::IncrementReply *response, ::google::protobuf::Closure *done) override;
+
+  void PutIfAbsent(google::protobuf::RpcController *controller, const ::raftKVRpcProctoc::PutIfAbsentArgs *request,
+                   ::raftKVRpcProctoc::PutIfAbsentReply *response, ::google::protobuf::Closure *done) override;
+
+  void Txn(google::protobuf::RpcController *controller, const ::raftKVRpcProctoc::TxnArgs *request,
+           ::raftKVRpcProctoc::TxnReply *response, ::google::protobuf::Closure *done) override;
+
+  void Delete(google::protobuf::RpcController *controller, const ::raftKVRpcProctoc::DeleteArgs *request,
+              ::raftKVRpcProctoc::DeleteReply *response, ::google::protobuf::Closure *done) override;
+
+  void Watch(google::protobuf::RpcController *controller, const ::raftKVRpcProctoc::WatchArgs *request,
+             ::raftKVRpcProctoc::WatchReply *response, ::google::protobuf::Closure *done) override;
+
 private:  // 序列化方法
   friend class boost::serialization::access;
 
+  // 版本0的快照保存的是 unordered_map<std::string, int> 形式的去重表，版本1改为紧凑编码的会话表，版本2增加了键的过期时间
   template <class Archive>
   void serialize(Archive &ar, const unsigned int version)  //  这里面写需要序列话和反序列化的字段
   {
     ar &m_serializedKVData;
 
     // ar & m_kvDB;
-    ar &m_lastRequestId;
+    if (version == 0) {   // 只有读取旧快照时才会走到这里
+      std::unordered_map<std::string, int> lastRequestId;
+      ar &lastRequestId;
+      m_sessions.Clear();
+      m_sessionClock = 0;
+      for (const auto &item : lastRequestId) {
+        m_sessions.Insert(Op::LegacyClientId(item.first), 0)->lastRequestId = item.second;
+      }
+    } else {
+      ar &m_serializedSessions;
+    }
+    if (version >= 2) {
+      ar &m_serializedExpire;
+    }
   }
 
   std::string getSnapshotData() {     // 序列化字段，获取快照数据
-    m_serializedKVData = m_skipList.dump_file();
+    m_serializedKVData = dumpKVData();
+    PutVarint64(&m_serializedSessions, ZigZagEncode(m_sessionClock));   // [会话时钟][会话表]
+    m_sessions.EncodeTo(&m_serializedSessions);
+    size_t expireCount = 0;
+    for (const auto &partition : m_partitions) {
+      expireCount += partition->expireIndex.size();
+    }
+    PutVarint64(&m_serializedExpire, expireCount);   // [个数][过期时间, 键]...，每个分区内按过期时间排序
+    for (const auto &partition : m_partitions) {
+      for (const auto &item : partition->expireIndex) {
+        PutVarint64(&m_serializedExpire, ZigZagEncode(item.first));
+        PutLengthPrefixed(&m_serializedExpire, item.second);
+      }
+    }
     std::stringstream ss;
     boost::archive::text_oarchive oa(ss);
     oa << *this;
     m_serializedKVData.clear();
+    m_serializedSessions.clear();
+    m_serializedExpire.clear();
     return ss.str();
   }
 
@@ -99,26 +236,146 @@ private:  // 序列化方法
     std::stringstream ss(str);
     boost::archive::text_iarchive ia(ss);
     ia >> *this;
-    m_skipList.load_file(m_serializedKVData);
+    loadKVData(m_serializedKVData);
     m_serializedKVData.clear();
+    if (!m_serializedSessions.empty()) {
+      const char *p = m_serializedSessions.data();
+      const char *limit = p + m_serializedSessions.size();
+      uint64_t clock = 0;
+      GetVarint64(&p, limit, &clock);
+      m_sessionClock = ZigZagDecode(clock);
+      m_sessions.DecodeFrom(std::string_view(p, limit - p));
+      m_serializedSessions.clear();
+    }
+    if (!m_serializedExpire.empty()) {
+      const char *p = m_serializedExpire.data();
+      const char *limit = p + m_serializedExpire.size();
+      uint64_t count = 0;
+      GetVarint64(&p, limit, &count);
+      for (uint64_t i = 0; i < count; ++i) {
+        uint64_t expireAt = 0;
+        std::string key;
+        if (!GetVarint64(&p, limit, &expireAt) || !GetLengthPrefixed(&p, limit, &key)) break;
+        setKeyExpireLocked(key, ZigZagDecode(expireAt));
+      }
+      m_serializedExpire.clear();
+    }
   }
 
 private:
-  std::mutex m_mtx;
+  std::shared_mutex m_storeMtx;   // 保护所有分区（跳表、键的过期时间）和 m_lastSnapShotRaftLogIndex：apply写入时独占，读请求和制作快照时共享
+  std::mutex m_sessionMtx;        // 保护会话表 m_sessions 和 m_sessionClock，与存储的锁分开，读请求不需要它
+  std::unique_ptr<monsoon::IOManager> m_readPool;   // 读线程池：已提交的读请求在这里并行执行，不占用apply线程
+  std::unique_ptr<monsoon::IOManager> m_applyPool;  // apply线程池：一批日志中落在不同分区的命令在这里并行执行
+  std::unique_ptr<HotKeyCache> m_readCache;   // 热点键读缓存，Get 和 MultiGet 先查它；apply写入键时使其失效
+  StorageEnginePolicy m_storagePolicy;    // 各分区使用的存储引擎，启动时从配置文件读取
   int m_me;   // 当前数据库标识符
   std::shared_ptr<Raft> m_raftNode;    // 当前kv数据库所对应的raft节点
-  std::shared_ptr<LockQueue<ApplyMsg> > applyChan;    //  Raft 节点与 KV 服务器之间通信的通道，是一个线程安全队列
+  std::shared_ptr<ApplyChannel> applyChan;    //  Raft 节点与 KV 服务器之间通信的通道，是一个无锁的多生产者单消费者队列
   int m_maxRaftState;  // Raft 状态的最大值，用于判断是否需要进行快照。
+  std::unique_ptr<SnapshotScheduler> m_snapshotScheduler;   // 快照调度器，决定何时制作快照并在副本之间错峰
 
   std::string m_serializedKVData;   // 序列化的键值数据
-  SkipList<std::string, std::string> m_skipList;    // 使用跳表存储键值对
-  std::unordered_map<std::string, std::string> m_kvDB;    // 键值数据库 
-
-  std::unordered_map<int, LockQueue<Op> *>  waitApplyCh;    // 等待应用的操作通道，键为 Raft 的日志条目索引。
-
-  std::unordered_map<std::string, int> m_lastRequestId;    // 记录每个客户端的最后请求 ID，一个kV服务器可能连接多个client
+  std::string m_serializedSessions;   // 序列化的会话表
+  std::string m_serializedExpire;     // 序列化的键过期时间
+
+  /*
+  Partition：按键的哈希划分的一个存储分区，分区之间没有共享的数据，不同分区的命令可以并行apply
+  */
+  struct Partition {
+    std::unique_ptr<KvStorageEngine> store;   // 存储键值对的有序索引（跳表或B+树，由 m_storagePolicy 决定），值分段存储，Append 只拷贝追加的部分
+    // 键的过期时间（日志中的Leader时间，毫秒）；expireIndex 按过期时间排序，Leader从头部取出到期的键，不需要扫描整个跳表
+    // 没有TTL的键不在这两个结构中
+    std::unordered_map<std::string, int64_t> keyExpireAt;
+    std::set<std::pair<int64_t, std::string>> expireIndex;
+    std::vector<WatchHub::Event> changes;   // 本批apply产生的键变更，批末按版本号合并进 m_watchHub
+    int applyingIndex = 0;    // 正在这个分区上执行的日志索引，即变更的版本号
+    std::vector<size_t> tasks;    // 本轮分给这个分区的命令（在本批中的下标），按日志顺序执行
+  };
+  std::vector<std::unique_ptr<Partition>> m_partitions;   // KV_PARTITION_NUM 个分区，都由 m_storeMtx 保护
+  size_t partitionIndexOf(const std::string &key) const { return std::hash<std::string>{}(key) % m_partitions.size(); }
+  Partition &partitionOf(const std::string &key) { return *m_partitions[partitionIndexOf(key)]; }
+  void resetPartitions();   // 清空所有分区，安装快照前调用
+  std::string dumpKVData();   // 把所有分区的键值对导出为一个快照，格式与单个跳表的 dump_file 相同
+  void loadKVData(const std::string &data);   // 清空所有分区后，从快照中加载键值对，每个键放进它所在的分区
+
+  /*
+  WaitingRequest：已经提交给raft、正在等待apply的客户端请求
+  RPC处理函数登记完就返回，之后由apply线程在命令apply或超时的时候调用 finishWaitingRequest，
+  由它填写reply并调用done->Run()。对象来自 m_waitingRequests 的对象池，用完归还复用
+  */
+  struct WaitingRequest {
+    enum Kind { GetRequest, PutAppendRequest, MultiGetRequest, MultiPutRequest, RegisterSessionRequest, ScanRequest,
+                CompareAndSwapRequest, IncrementRequest, PutIfAbsentRequest, TxnRequest, DeleteRequest };
+
+    int raftIndex = -1;   // 所等待的日志索引
+    std::chrono::steady_clock::time_point deadline;   // 超时时间点
+    Kind kind = GetRequest;   // 请求类型，决定reply的具体类型
+    Op op;    // 提交给raft的命令，复用时字符串保留容量
+    bool sessionExpired = false;    // 命令已经apply，但它的会话不存在（已过期），没有被执行
+    int scanLimit = 0;    // Scan 请求本页最多返回的个数，只在本地使用，不写进日志
+    google::protobuf::Message *reply = nullptr;   // RPC的响应对象
+    google::protobuf::Closure *done = nullptr;    // RPC完成回调
+  };
+
+  CompletionTable<WaitingRequest> m_waitingRequests;    // 等待apply的请求，按 Raft 的日志条目索引分片保存
+
+  void addWaitingRequest(WaitingRequest *request);   // 登记一个等待apply的请求
+  void finishWaitingRequest(WaitingRequest *request, const Op *appliedOp);  // 完成请求，appliedOp为空表示超时
+  void fillWaitingReply(WaitingRequest *request, const Op *appliedOp, bool isLeader);   // 填写reply，调用者需持有 m_storeMtx
+  void fillReadModifyWriteReply(WaitingRequest *request, const std::string *err, int status, int64_t result);
+  void replyWaitingRequest(WaitingRequest *request);    // 调用done->Run()回复客户端并归还请求对象，不能持有任何锁
+  void serveReadRequest(WaitingRequest *request);   // 在读线程池中执行已提交的读请求并回复
+
+  // 独占 m_storeMtx 时应用一条命令：在该索引上等待的写请求填好reply后放进 finished，已提交的读请求放进 reads
+  bool applyCommandLocked(int raftIndex, Op &op, std::vector<WaitingRequest *> *finished,
+                          std::vector<WaitingRequest *> *reads);
+  // 独占 m_storeMtx 时把一条无法解析的命令当作空操作：不执行、不修改会话表，只推进索引并让在该索引上等待的请求失败
+  bool skipCommandLocked(int raftIndex, std::vector<WaitingRequest *> *finished, std::vector<WaitingRequest *> *reads);
+  // 独占 m_storeMtx 时应用 [begin, end) 这一段不需要跨分区同步的命令，按分区并行执行，返回最后一条被应用的命令索引
+  int applyPartitionedLocked(std::span<ApplyMsg> messages, std::vector<Op> &ops, size_t begin, size_t end,
+                             std::vector<WaitingRequest *> *finished, std::vector<WaitingRequest *> *reads);
+  static bool isPartitionable(const Op &op);    // 命令能否拆到各分区独立执行（Txn 需要同时看到多个分区，不能拆）
+  void executeOnPartitionLocked(size_t partition, Op &op, int *status, int64_t *result);    // 执行命令中属于该分区的部分
+  void publishChangesLocked(int raftIndex);   // 把各分区记录的变更按版本号合并进 m_watchHub，并推进到 raftIndex
+  // 各分区并行执行分到的命令，全部完成后返回；读改写的执行结果按命令在本批中的下标写入 statuses 和 results
+  void runPartitionTasks(std::span<ApplyMsg> messages, std::vector<Op> &ops, std::vector<int> *statuses,
+                         std::vector<int64_t> *results);
+  bool installSnapshotLocked(const ApplyMsg &message);   // 独占 m_storeMtx 时安装raft发来的快照，返回是否安装成功
+
+  enum SessionCheck { SessionFresh, SessionDuplicate, SessionUnknown };
+  SessionCheck applySession(int raftIndex, const Op &op);   // apply时推进会话时钟、过期会话、注册会话、去重并记录请求ID
+  // 命令执行完之后，完成在该索引上等待的请求；txnResult 是刚执行的Txn的结果
+  void completeCommandLocked(int raftIndex, const Op &op, SessionCheck check, raftKVRpcProctoc::TxnReply *txnResult,
+                             std::vector<WaitingRequest *> *finished, std::vector<WaitingRequest *> *reads);
+
+  // 读改写操作的执行结果，缓存在会话中，重复的请求直接返回缓存的结果
+  enum RmwStatus { RmwOk = 0, RmwFailed = 1, RmwNotInteger = 2 };
+  void recordResult(uint64_t ClientId, int status, int64_t result);    // 缓存会话最后一个请求的执行结果
+  bool lastResultOf(uint64_t ClientId, int RequestId, int *status, int64_t *result);   // 取出该请求缓存的执行结果
+
+  void applyTxnLocked(const Op &op, raftKVRpcProctoc::TxnReply *result);   // 独占 m_storeMtx 时执行一条Txn命令并缓存结果
+  void readTxnResults(const Op &op, bool succeeded, raftKVRpcProctoc::TxnReply *reply);   // 重复的Txn请求重新读取GET的结果
+
+  // 键的过期时间保存在键所在的分区中
+  void setKeyExpireLocked(const std::string &key, int64_t expireAt);   // 设置键的过期时间，0 表示清除，调用者需独占 m_storeMtx
+  void expireKeysLocked(size_t partition, const Op &op);   // 执行过期删除命令中属于该分区的键，只删除在命令时间戳之前确实已经过期的键
+  void multiPutLocked(size_t partition, const Op &op);   // 执行MultiPut中属于该分区的键值对
+  std::atomic<int> m_expireProposalIndex{-1};   // Leader已提交、还没apply的过期删除命令的日志索引，-1 表示没有
+  std::chrono::steady_clock::time_point m_expireProposalDeadline;   // 超过这个时间还没apply就认为命令丢了，重新提交
+
+  // 键变更历史：执行命令时先记在键所在分区的 changes 中，版本号是该分区正在apply的日志索引
+  WatchHub m_watchHub;
+  bool m_recordChanges = false;   // 本批是否记录键变更（m_watchHub.BeginBatch 的结果），没有 Watch 时不拷贝键和值
+  void noteChangeLocked(raftKVRpcProctoc::WatchEvent::Type type, const std::string &key, const std::string &value);   // 记录一个键变更并使读缓存失效，调用者需独占 m_storeMtx
+  bool readValueLocked(const std::string &key, std::string *value);    // 经过读缓存读取一个键，调用者需持有 m_storeMtx
+
+  SessionTable m_sessions;      // 客户端会话表，记录每个会话的最后请求 ID 和最后活跃时间，一个kV服务器可能连接多个client
+  int64_t m_sessionClock = 0;   // 会话时钟：已apply的日志中最大的时间戳，会话过期只看它，不看本地时间
 
   int m_lastSnapShotRaftLogIndex;    // 最后一个快照的日志条目索引
 };
 
+BOOST_CLASS_VERSION(KvServer, 2)
+
 #endif
\ No newline at end of file
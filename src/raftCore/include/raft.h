@@ -8,6 +8,7 @@
 
 #include <boost/serialization/string.hpp>
 #include <boost/serialization/vector.hpp>
+#include <condition_variable>
 #include <mutex>
 #include <vector>
 #include <memory>
@@ -31,11 +32,13 @@ constexpr int Expire = 2;  //投票（消息、竞选者）过期
 constexpr int Normal = 3;
 
 
+using LogEntryPtr = std::shared_ptr<const raftRpcProctoc::LogEntry>;   // 不可变的共享日志条目
+
 // Raft节点类
 class Raft : public raftRpcProctoc::raftRpc { // 继承自使用protobuf生成的raftRpc类
 public:
   void AppendEntries1(const raftRpcProctoc::AppendEntriesArgs *args, raftRpcProctoc::AppendEntriesReply *reply);    // 实现 AppendEntries RPC 方法
-  void applierTicker();     // 负责周期性地将已提交的日志应用到状态机
+  void applierTicker();     // 负责将已提交的日志应用到状态机，提交索引前进时被唤醒
   bool CondInstallSnapshot(int lastIncludedTerm, int lastIncludedIndex, std::string snapshot);    // 条件安装快照
   void doElection();    // 发起选举
   void doHeartBeat();   // 发起心跳，只有leader才需要发起心跳
@@ -70,7 +73,9 @@ public:
   void readPersist(std::string data);    // 读取持久化数据
   std::string persistData();    // 获取要持久化的状态数据
 
-  void Start(Op command, int *newLogIndex, int *newLogTerm, bool *isLeader);    // 开始一个新的命令
+  void Start(const Op &command, int *newLogIndex, int *newLogTerm, bool *isLeader);    // 开始一个新的命令
+
+  void Start(std::string command, int *newLogIndex, int *newLogTerm, bool *isLeader);   // 同上，命令已经编码好，直接移动进日志条目
 
   // Snapshot the service says it has created a snapshot that has
   // all info up to and including index. this means the
@@ -94,10 +99,11 @@ public:
 
 public:
   void init(std::vector<std::shared_ptr<RaftRpcUtil>> peers, int me, std::shared_ptr<Persister> persister,
-            std::shared_ptr<LockQueue<ApplyMsg>> applyCh);
+            std::shared_ptr<ApplyChannel> applyCh);
             
 private:
   std::mutex m_mtx;    // mutex类对象，用于加互斥锁
+  std::condition_variable m_applyCond;    // 提交索引前进时通知applier线程，与 m_mtx 配合使用
 
   // 每个raft节点都需要与其他raft节点通信，所以用一个数组保存与其他节点通信的rpc通信对象
   std::vector<std::shared_ptr<RaftRpcUtil>> m_peers; 
@@ -107,7 +113,9 @@ private:
   int m_me;   // 当前节点的索引
   int m_currentTerm;    // 当前节点的任期号
   int m_votedFor;     // 当前节点在本任期内投票的候选人ID
-  std::vector<raftRpcProctoc::LogEntry> m_logs;  // 日志条目数组
+  // 日志条目数组。条目一旦加入就不再修改（冲突时整体替换），用共享指针保存，
+  // apply时可以把命令直接交给kv server而不拷贝，截断日志时也只拷贝指针
+  std::vector<LogEntryPtr> m_logs;
   
   int m_commitIndex;    // 当前节点最大的已提交的日志条目索引
   int m_lastApplied;    // 已经应用到状态机的最大的日志条目索引
@@ -117,7 +125,7 @@ private:
   enum Status { Follower, Candidate, Leader };
   Status m_status;    // 当前节点的状态（Follower、Candidate、Leader）
   
-  std::shared_ptr<LockQueue<ApplyMsg>> applyChan;     // 指向一个线程安全的日志队列，用于raft节点和kv server的通信
+  std::shared_ptr<ApplyChannel> applyChan;     // 指向一个无锁的消息通道，用于raft节点和kv server的通信
   
   std::chrono::_V2::system_clock::time_point m_lastResetElectionTime;   // 最近一次重置选举计时器的时间
   std::chrono::_V2::system_clock::time_point m_lastResetHearBeatTime;   // 最近一次重置心跳计时器的时间
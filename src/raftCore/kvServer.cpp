@@ -6,6 +6,19 @@
 #include "kvServer.h"
 #include "config.h"
 #include "util.h"
+#include <algorithm>
+#include <charconv>
+#include <iterator>
+#include <latch>
+
+/*
+leaderTimestamp 函数
+主要功能：Leader提交命令时打上的时间戳（毫秒），随命令写进日志，所有副本用日志里的时间判断会话过期
+*/
+static int64_t leaderTimestamp() {
+  return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch())
+      .count();
+}
 
 /*
 DprintfKVDB 函数
@@ -14,264 +27,1589 @@ DprintfKVDB 函数
 void KvServer::DprintfKVDB() {
   if (!Debug) return;
 
-  std::lock_guard<std::mutex> lg(m_mtx);
+  std::shared_lock<std::shared_mutex> lg(m_storeMtx);
+
+  DEFER {
+    for (const auto &partition : m_partitions) {
+      partition->store->Display();
+    }
+  };
+}
+
+/*
+resetPartitions 函数
+主要功能：丢弃所有分区的数据，重新创建 KV_PARTITION_NUM 个空分区
+注意：调用者需独占 m_storeMtx（构造函数中除外）
+*/
+void KvServer::resetPartitions() {
+  m_partitions.clear();
+  for (int i = 0; i < KV_PARTITION_NUM; ++i) {
+    m_partitions.push_back(std::make_unique<Partition>());
+    m_partitions.back()->store = KvStorageEngine::Create(m_storagePolicy);
+  }
+}
+
+/*
+dumpKVData 函数
+主要功能：把所有分区的键值对导出到同一个 SkipListDump 中再序列化，快照格式与单个跳表的 dump_file 完全相同，
+        分区数不同的节点之间也可以互相安装快照
+注意：调用者需持有 m_storeMtx
+*/
+std::string KvServer::dumpKVData() {
+  SkipListDump<std::string, SegmentedValue> dumper;
+  for (const auto &partition : m_partitions) {
+    partition->store->DumpTo(&dumper);
+  }
+  std::stringstream ss;
+  boost::archive::text_oarchive oa(ss);
+  oa << dumper;
+  return ss.str();
+}
+
+/*
+loadKVData 函数
+主要功能：清空所有分区，再把快照中的每个键值对放进它所在的分区
+注意：调用者需独占 m_storeMtx（构造函数中除外）
+*/
+void KvServer::loadKVData(const std::string &data) {
+  resetPartitions();
+  m_readCache->Clear();
+  if (data.empty()) {
+    return;
+  }
+  SkipListDump<std::string, SegmentedValue> dumper;
+  std::stringstream iss(data);
+  boost::archive::text_iarchive ia(iss);
+  ia >> dumper;
+  // 先按分区分组，再由各分区的引擎批量加载（B+树在空树上直接自底向上建树）
+  std::vector<std::vector<std::string>> keys(m_partitions.size());
+  std::vector<std::vector<std::string>> values(m_partitions.size());
+  for (size_t i = 0; i < dumper.keyDumpVt_.size() && i < dumper.valDumpVt_.size(); ++i) {
+    size_t partition = partitionIndexOf(dumper.keyDumpVt_[i]);
+    keys[partition].push_back(std::move(dumper.keyDumpVt_[i]));
+    values[partition].push_back(std::move(dumper.valDumpVt_[i]));
+  }
+  for (size_t p = 0; p < m_partitions.size(); ++p) {
+    m_partitions[p]->store->BulkLoad(std::move(keys[p]), std::move(values[p]));
+  }
+}
+
+/*
+DprintfReadCache 函数
+主要功能：打印热点键读缓存的统计
+*/
+void KvServer::DprintfReadCache() {
+  HotKeyCache::Stats stats = ReadCacheStats();
+  DPrintf("[KvServer::DprintfReadCache-kvserver{%d}] size:{%zu} hits:{%llu} misses:{%llu} hitRate:{%.4f} "
+          "admissions:{%llu} rejections:{%llu} invalidations:{%llu}",
+          m_me, stats.size, (unsigned long long)stats.hits, (unsigned long long)stats.misses, stats.HitRate(),
+          (unsigned long long)stats.admissions, (unsigned long long)stats.rejections,
+          (unsigned long long)stats.invalidations);
+}
+
+HotKeyCache::Stats KvServer::ReadCacheStats() { return m_readCache->GetStats(); }
+
+/*
+ExecuteAppendOpOnKVDB 函数
+主要功能：执行append功能，把值追加到键已有的值之后，键不存在时直接写入
+注意：调用者需独占 m_storeMtx
+*/
+void KvServer::ExecuteAppendOpOnKVDB(Op &op) {
+  noteChangeLocked(raftKVRpcProctoc::WatchEvent::APPEND, op.Key, op.Value);
+  partitionOf(op.Key).store->Append(op.Key, op.Value);    // 原地追加到分段的值末尾，只拷贝追加的部分；键不存在时等同于Put
+}
+
+/*
+KvServer::ExecuteGetOpOnKVDB 函数
+主要功能：执行get功能，获取指定键所对应的值
+注意：调用者需持有 m_storeMtx（共享即可），不修改任何状态，多个读请求可以并行执行
+*/
+void KvServer::ExecuteGetOpOnKVDB(const Op &op, std::string *value, bool *exist) {
+  // 初始化
+  *value = "";
+  *exist = readValueLocked(op.Key, value);
+}
+
+/*
+readValueLocked 函数
+主要功能：读取一个键的值，先查热点键缓存，未命中时在存储引擎中查找，找到后尝试放进缓存
+注意：
+    调用者需持有 m_storeMtx（共享即可）。查找和填充都在锁内完成，写入在独占锁下先使缓存失效（见 noteChangeLocked），
+    因此放进缓存的值一定是当前的值
+*/
+bool KvServer::readValueLocked(const std::string &key, std::string *value) {
+  if (m_readCache->Lookup(key, value)) {
+    return true;
+  }
+  if (!partitionOf(key).store->Get(key, value)) {    // 在存储引擎中查询
+    return false;
+  }
+  m_readCache->Insert(key, *value);
+  return true;
+}
+
+/*
+KvServer::ExecutePutOpOnKVDB
+主要功能：执行put功能，
+注意：调用者需独占 m_storeMtx
+*/
+void KvServer::ExecutePutOpOnKVDB(Op &op) {
+  setKeyExpireLocked(op.Key, op.ExpireAt);    // 普通的Put会清除之前设置的TTL
+  noteChangeLocked(raftKVRpcProctoc::WatchEvent::PUT, op.Key, op.Value);
+  partitionOf(op.Key).store->Put(op.Key, std::move(op.Value));   // 只查找一次，值移动进索引，不拷贝
+  // m_kvDB[op.Key] = op.Value;
+
+  //    DPrintf("[KVServerExePUT----]ClientId :%d ,RequestID :%d ,Key : %v, value : %v", op.ClientId, op.RequestId,
+  //    op.Key, op.Value)
+}
+
+/*
+ExecuteMultiPutOpOnKVDB 函数
+主要功能：执行MultiPut，依次写入每个分区
+注意：调用者需独占 m_storeMtx
+*/
+void KvServer::ExecuteMultiPutOpOnKVDB(const Op &op) {
+  for (size_t p = 0; p < m_partitions.size(); ++p) {
+    multiPutLocked(p, op);
+  }
+}
+
+/*
+multiPutLocked 函数
+主要功能：取出MultiPut中属于该分区的键值对，通过存储引擎的批量接口一次写入
+注意：调用者需独占 m_storeMtx；只访问这一个分区，不同分区可以同时执行
+*/
+void KvServer::multiPutLocked(size_t partition, const Op &op) {
+  std::vector<std::string> keys;
+  std::vector<std::string> values;
+  for (size_t i = 0; i < op.Keys.size() && i < op.Values.size(); ++i) {
+    if (partitionIndexOf(op.Keys[i]) != partition) {
+      continue;
+    }
+    setKeyExpireLocked(op.Keys[i], 0);
+    noteChangeLocked(raftKVRpcProctoc::WatchEvent::PUT, op.Keys[i], op.Values[i]);
+    keys.push_back(op.Keys[i]);
+    values.push_back(op.Values[i]);
+  }
+  if (!keys.empty()) {
+    m_partitions[partition]->store->MultiPut(keys, values);
+  }
+}
+
+/*
+ExecuteMultiGetOpOnKVDB 函数
+主要功能：执行MultiGet，在同一次持锁内读出所有键，保证读到的是同一时刻的状态
+注意：调用者需持有 m_storeMtx（共享即可）
+*/
+void KvServer::ExecuteMultiGetOpOnKVDB(const Op &op, std::vector<std::string> *values, std::vector<bool> *exists) {
+  values->assign(op.Keys.size(), std::string());
+  exists->assign(op.Keys.size(), false);
+  for (size_t i = 0; i < op.Keys.size(); ++i) {
+    (*exists)[i] = readValueLocked(op.Keys[i], &(*values)[i]);
+  }
+}
+
+/*
+ExecuteCompareAndSwapOpOnKVDB 函数
+主要功能：键存在并且当前值等于期望值 op.Values[0] 时写入 op.Value，返回 RmwOk；否则不修改，返回 RmwFailed
+注意：调用者需独占 m_storeMtx；比较和写入只查找一次，当前值逐段比较，不展平拷贝
+*/
+int KvServer::ExecuteCompareAndSwapOpOnKVDB(Op &op) {
+  if (op.Values.empty()) {
+    return RmwFailed;
+  }
+  SegmentedValue *value = partitionOf(op.Key).store->Find(op.Key);
+  if (value == nullptr || !value->equals(op.Values[0])) {
+    return RmwFailed;
+  }
+  setKeyExpireLocked(op.Key, 0);
+  noteChangeLocked(raftKVRpcProctoc::WatchEvent::PUT, op.Key, op.Value);
+  *value = std::move(op.Value);
+  return RmwOk;
+}
+
+/*
+ExecuteIncrementOpOnKVDB 函数
+主要功能：把键的值当作十进制整数加上 op.Value 中的增量，键不存在时视为0
+注意：调用者需独占 m_storeMtx；当前值不是整数或者结果溢出时不修改，返回 RmwNotInteger
+*/
+int KvServer::ExecuteIncrementOpOnKVDB(const Op &op, int64_t *result) {
+  int64_t delta = 0;
+  auto parsed = std::from_chars(op.Value.data(), op.Value.data() + op.Value.size(), delta);
+  if (parsed.ec != std::errc() || parsed.ptr != op.Value.data() + op.Value.size()) {
+    return RmwNotInteger;
+  }
+
+  // 键不存在时插入一个空值占位，视为0；0加上任何增量都不会失败，所以插入后不会再出现需要撤销的情况
+  auto [slot, inserted] = partitionOf(op.Key).store->FindOrInsert(op.Key);
+  int64_t value = 0;
+  if (!inserted) {
+    std::string current = slot->str();
+    parsed = std::from_chars(current.data(), current.data() + current.size(), value);
+    if (parsed.ec != std::errc() || parsed.ptr != current.data() + current.size()) {
+      return RmwNotInteger;
+    }
+  }
+  if (__builtin_add_overflow(value, delta, result)) {
+    return RmwNotInteger;
+  }
+  std::string newValue = std::to_string(*result);
+  noteChangeLocked(raftKVRpcProctoc::WatchEvent::PUT, op.Key, newValue);
+  *slot = std::move(newValue);    // 直接写回索引中的值，不再查找一次
+  return RmwOk;
+}
+
+/*
+ExecutePutIfAbsentOpOnKVDB 函数
+主要功能：键不存在时写入 op.Value，返回 RmwOk；键已存在时不修改，返回 RmwFailed
+注意：调用者需独占 m_storeMtx
+*/
+int KvServer::ExecutePutIfAbsentOpOnKVDB(Op &op) {
+  // 只查找一次：键不存在时插入空值后再把 op.Value 移动进去，与 Put 一样不拷贝值
+  auto [slot, inserted] = partitionOf(op.Key).store->FindOrInsert(op.Key);
+  if (!inserted) {
+    return RmwFailed;
+  }
+  noteChangeLocked(raftKVRpcProctoc::WatchEvent::PUT, op.Key, op.Value);
+  *slot = std::move(op.Value);
+  return RmwOk;
+}
+
+/*
+ExecuteDeleteOpOnKVDB 函数
+主要功能：删除键以及它的过期时间，键存在时返回 RmwOk，否则返回 RmwFailed
+注意：调用者需独占 m_storeMtx
+*/
+int KvServer::ExecuteDeleteOpOnKVDB(const Op &op) {
+  setKeyExpireLocked(op.Key, 0);
+  if (!partitionOf(op.Key).store->Delete(op.Key)) {
+    return RmwFailed;
+  }
+  noteChangeLocked(raftKVRpcProctoc::WatchEvent::DELETE, op.Key, "");
+  return RmwOk;
+}
+
+/*
+ExecuteTxnOpOnKVDB 函数
+主要功能：执行一个事务：所有比较条件都成立时执行 Success 中的操作，否则执行 Failure 中的操作
+注意：调用者需独占 m_storeMtx，整个事务在一次持锁内完成，其他请求看不到中间状态；操作按顺序执行，GET能读到前面PUT的值
+*/
+bool KvServer::ExecuteTxnOpOnKVDB(const raftKVRpcProctoc::TxnArgs &txn, raftKVRpcProctoc::TxnReply *result) {
+  // 1. 检查比较条件
+  bool succeeded = true;
+  std::string current;
+  for (const auto &compare : txn.compares()) {
+    bool exist = partitionOf(compare.key()).store->Get(compare.key(), &current);
+    bool holds = false;
+    switch (compare.cmp()) {
+      case raftKVRpcProctoc::TxnCompare::EQUAL:
+        holds = exist && current == compare.value();
+        break;
+      case raftKVRpcProctoc::TxnCompare::NOT_EQUAL:
+        holds = !exist || current != compare.value();
+        break;
+      case raftKVRpcProctoc::TxnCompare::LESS:
+        holds = exist && current < compare.value();
+        break;
+      case raftKVRpcProctoc::TxnCompare::GREATER:
+        holds = exist && current > compare.value();
+        break;
+      case raftKVRpcProctoc::TxnCompare::EXISTS:
+        holds = exist;
+        break;
+      case raftKVRpcProctoc::TxnCompare::NOT_EXISTS:
+        holds = !exist;
+        break;
+      default:    // 不认识的比较方式按不成立处理
+        break;
+    }
+    if (!holds) {
+      succeeded = false;
+      break;
+    }
+  }
+
+  // 2. 执行对应的一组操作
+  result->set_succeeded(succeeded);
+  result->clear_results();
+  for (const auto &txnOp : succeeded ? txn.success() : txn.failure()) {
+    auto *opResult = result->add_results();
+    switch (txnOp.optype()) {
+      case raftKVRpcProctoc::TxnOp::PUT:
+        setKeyExpireLocked(txnOp.key(), 0);
+        noteChangeLocked(raftKVRpcProctoc::WatchEvent::PUT, txnOp.key(), txnOp.value());
+        partitionOf(txnOp.key()).store->Put(txnOp.key(), txnOp.value());
+        break;
+      case raftKVRpcProctoc::TxnOp::DELETE:
+        setKeyExpireLocked(txnOp.key(), 0);
+        if (partitionOf(txnOp.key()).store->Delete(txnOp.key())) {
+          noteChangeLocked(raftKVRpcProctoc::WatchEvent::DELETE, txnOp.key(), "");
+        }
+        break;
+      case raftKVRpcProctoc::TxnOp::GET:
+        opResult->set_exists(partitionOf(txnOp.key()).store->Get(txnOp.key(), opResult->mutable_value()));
+        break;
+      default:
+        break;
+    }
+  }
+  return succeeded;
+}
+
+/*
+setKeyExpireLocked 函数
+主要功能：设置键的过期时间，同时维护按过期时间排序的索引；expireAt 为0表示键不再过期
+注意：调用者需独占 m_storeMtx；没有任何键带TTL时只有一次判空，不影响普通写入的性能
+*/
+void KvServer::setKeyExpireLocked(const std::string &key, int64_t expireAt) {
+  Partition &partition = partitionOf(key);
+  if (expireAt == 0 && partition.keyExpireAt.empty()) {
+    return;
+  }
+  auto it = partition.keyExpireAt.find(key);
+  if (it != partition.keyExpireAt.end()) {
+    partition.expireIndex.erase({it->second, key});
+    if (expireAt == 0) {
+      partition.keyExpireAt.erase(it);
+      return;
+    }
+    it->second = expireAt;
+  } else if (expireAt == 0) {
+    return;
+  } else {
+    partition.keyExpireAt.emplace(key, expireAt);
+  }
+  partition.expireIndex.emplace(expireAt, key);
+}
+
+/*
+expireKeysLocked 函数
+主要功能：执行Leader提交的过期删除命令，op.Keys 中属于该分区、在 op.Timestamp 时已经过期的键被删除
+注意：
+    调用者需独占 m_storeMtx。命令提交之后、apply之前，键可能被重新写入或者续期，
+    所以这里按日志中的时间重新判断一次，所有副本得到相同的结果，重复的命令也不会误删
+*/
+void KvServer::expireKeysLocked(size_t partition, const Op &op) {
+  Partition &part = *m_partitions[partition];
+  for (const auto &key : op.Keys) {
+    if (partitionIndexOf(key) != partition) {
+      continue;
+    }
+    auto it = part.keyExpireAt.find(key);
+    if (it == part.keyExpireAt.end() || it->second > op.Timestamp) {
+      continue;
+    }
+    part.expireIndex.erase({it->second, key});
+    part.keyExpireAt.erase(it);
+    if (part.store->Delete(key)) {
+      noteChangeLocked(raftKVRpcProctoc::WatchEvent::DELETE, key, "");
+    }
+  }
+}
+
+/*
+noteChangeLocked 函数
+主要功能：把正在apply的这条日志产生的一个键变更记在键所在的分区中，版本号就是日志索引，批末再统一交给 m_watchHub
+注意：调用者需独占 m_storeMtx；只访问键所在的分区，执行该分区命令的线程可以直接调用；本批不记录变更时只使读缓存失效
+*/
+void KvServer::noteChangeLocked(raftKVRpcProctoc::WatchEvent::Type type, const std::string &key,
+                                const std::string &value) {
+  m_readCache->Invalidate(key);   // 键被修改，缓存中的旧值作废
+  if (!m_recordChanges) {
+    return;
+  }
+  Partition &partition = partitionOf(key);
+  WatchHub::Event event;
+  event.revision = partition.applyingIndex;
+  event.type = type;
+  event.key = key;
+  event.value = value;
+  partition.changes.push_back(std::move(event));
+}
+
+/*
+ExecuteScanOpOnKVDB 函数
+主要功能：执行Scan，从 op.Key 开始在各分区的有序索引中顺序取出一页，op.Value 为空表示不限上界
+注意：调用者需持有 m_storeMtx（共享即可）
+*/
+bool KvServer::ExecuteScanOpOnKVDB(const Op &op, int limit, std::vector<std::string> *keys,
+                                   std::vector<std::string> *values, std::string *next) {
+  // 1. 每个分区各自取出最多 limit 个
+  struct Cursor {
+    std::vector<std::string> keys;
+    std::vector<std::string> values;
+    std::string next;
+    bool more = false;
+    size_t pos = 0;
+  };
+  std::vector<Cursor> cursors(m_partitions.size());
+  for (size_t p = 0; p < m_partitions.size(); ++p) {
+    Cursor &c = cursors[p];
+    c.more = m_partitions[p]->store->Scan(op.Key, op.Value, !op.Value.empty(), limit, &c.keys, &c.values, &c.next);
+  }
+
+  // 2. 按键归并，取最小的 limit 个
+  keys->clear();
+  values->clear();
+  while (keys->size() < static_cast<size_t>(limit)) {
+    Cursor *smallest = nullptr;
+    for (auto &c : cursors) {
+      if (c.pos < c.keys.size() && (smallest == nullptr || c.keys[c.pos] < smallest->keys[smallest->pos])) {
+        smallest = &c;
+      }
+    }
+    if (smallest == nullptr) {
+      break;
+    }
+    keys->push_back(std::move(smallest->keys[smallest->pos]));
+    values->push_back(std::move(smallest->values[smallest->pos]));
+    ++smallest->pos;
+  }
+
+  // 3. 剩下的元素中最小的键就是下一页的起点
+  bool more = false;
+  for (auto &c : cursors) {
+    const std::string *candidate = c.pos < c.keys.size() ? &c.keys[c.pos] : (c.more ? &c.next : nullptr);
+    if (candidate != nullptr && (!more || *candidate < *next)) {
+      *next = *candidate;
+      more = true;
+    }
+  }
+  return more;
+}
+
+/*
+KvServer::Get 函数
+主要功能：处理来自客户端的Get RPC请求（注意本函数不是RPC方法，而是在GetRPC方法中调用的处理函数）
+注意：
+    本函数只负责把命令交给raft并登记等待，然后立即返回，不会阻塞muduo的IO线程。
+    Get在apply线程中按日志顺序执行，执行完或超时后由apply线程填写reply并调用done->Run()，
+    因此同时在途的请求数只受内存限制，而不受RPC线程数限制。
+*/
+void KvServer::Get(const raftKVRpcProctoc::GetArgs *args, raftKVRpcProctoc::GetReply *reply,
+                   google::protobuf::Closure *done) {
+  // 1. 构造操作对象
+  Op op;
+  op.Operation = "Get";
+  op.Key = args->key();
+  op.Value = "";
+  op.ClientId = args->clientid();
+  op.RequestId = args->requestid();
+  op.Timestamp = leaderTimestamp();
+
+  // 2. 向Raft集群提交操作（客户端发来了Get操作请求，需要通知raft节点将这个请求转换成日志条目，以实现各个raft节点之间的同步），要大部分raft节点同步了这个日志条目，Leader才会真正去执行这个操作请求。
+  int raftIndex = -1;
+  int _ = -1;
+  bool isLeader = false;
+  m_raftNode->Start(op, &raftIndex, &_, &isLeader);     // 让raft节点（Leader）开始处理客户端的命令请求，并构造日志条目
+  if (!isLeader) {    // 说明本节点不是Leader，客户端不应该向非Leader节点发送请求，报错。
+    reply->set_err(ErrWrongLeader);
+    done->Run();
+    return;
+  }
+
+  // 3. 登记等待，命令apply后在apply线程中执行Get
+  WaitingRequest *request = m_waitingRequests.Acquire(raftIndex);
+  request->kind = WaitingRequest::GetRequest;
+  request->op = std::move(op);
+  request->reply = reply;
+  request->done = done;
+  addWaitingRequest(request);
+}
+
+/*
+Apply 函数
+主要功能：按日志顺序应用一批raft交过来的消息（命令或快照）
+实现：
+    1. 锁外解析所有命令
+    2. 整批只独占一次 m_storeMtx：依次去重、执行命令或安装快照，在这条日志上等待的写请求在这里填好reply
+    3. 解锁后统一回复写请求；读请求交给读线程池，在共享锁下并行执行，不占用apply线程
+    4. 最后对整批做一次快照检查
+*/
+void KvServer::Apply(std::span<ApplyMsg> messages) {
+  // 1. 解析命令，直接在共享的命令缓冲区上解析，值只在这里拷贝一次，之后移动进跳表
+  std::vector<Op> ops(messages.size());
+  std::vector<bool> decoded(messages.size(), false);   // 无法解析的命令按空操作处理，不能带着半解析的字段去执行
+  for (size_t i = 0; i < messages.size(); ++i) {
+    if (messages[i].CommandValid) {
+      decoded[i] = ops[i].parseFromString(messages[i].Command.view());
+      if (!decoded[i]) {
+        DPrintf("[KvServer::Apply-kvserver{%d}] failed to decode command at index {%d}, apply it as a no-op", m_me,
+                messages[i].CommandIndex);
+      }
+    }
+  }
+
+  // 2. 在一个临界区内应用整批消息
+  std::vector<WaitingRequest *> finished;
+  std::vector<WaitingRequest *> reads;
+  std::vector<google::protobuf::Closure *> watchers;   // 收到变更的 Watch 请求
+  int lastAppliedIndex = -1;    // 本批最后一条被应用的命令索引，快照只能在它之后没有安装过快照时制作
+  {
+    std::unique_lock<std::shared_mutex> lg(m_storeMtx);
+    m_recordChanges = m_watchHub.BeginBatch();
+    size_t i = 0;
+    while (i < messages.size()) {
+      const ApplyMsg &message = messages[i];
+      if (message.CommandValid && !decoded[i]) {
+        if (skipCommandLocked(message.CommandIndex, &finished, &reads)) {
+          lastAppliedIndex = message.CommandIndex;
+        }
+        ++i;
+        continue;
+      }
+      if (message.CommandValid && isPartitionable(ops[i])) {
+        // 连续的一段可以按分区拆开的命令一起执行，遇到快照、无法解析或者需要跨分区的命令时结束
+        size_t end = i + 1;
+        while (end < messages.size() && messages[end].CommandValid && decoded[end] && isPartitionable(ops[end])) {
+          ++end;
+        }
+        int applied = applyPartitionedLocked(messages, ops, i, end, &finished, &reads);
+        if (applied != -1) {
+          lastAppliedIndex = applied;
+        }
+        i = end;
+        continue;
+      }
+      if (message.CommandValid && applyCommandLocked(message.CommandIndex, ops[i], &finished, &reads)) {
+        lastAppliedIndex = message.CommandIndex;
+      }
+      if (message.SnapshotValid && installSnapshotLocked(message)) {
+        lastAppliedIndex = -1;
+        m_watchHub.Reset(message.SnapshotIndex, &watchers);
+      }
+      ++i;
+    }
+  }
+
+  // 3. 回复客户端，通知这些命令已经处理完毕
+  for (auto *request : finished) {
+    replyWaitingRequest(request);
+  }
+  for (auto *request : reads) {
+    m_readPool->scheduler([this, request]() -> void { serveReadRequest(request); });
+  }
+  m_watchHub.Dispatch(&watchers);
+  for (auto *done : watchers) {
+    done->Run();
+  }
+
+  // 4. 整批只检查一次是否需要快照
+  if (m_maxRaftState != -1 && lastAppliedIndex != -1) {
+    IfNeedToSendSnapShotCommand(lastAppliedIndex);
+  }
+
+  DprintfKVDB();
+}
+
+/*
+skipCommandLocked 函数
+主要功能：无法解析的命令不执行，也不登记会话（字段可能是半解析的垃圾值），但它仍然占用了这个日志索引：
+        推进 Watch 的版本，并用一个空的 Op 完成在该索引上等待的请求，客户端ID不匹配，请求会按未提交处理后重试
+注意：调用者需独占 m_storeMtx；返回是否推进了已应用的索引（已包含在快照中的命令返回 false）
+*/
+bool KvServer::skipCommandLocked(int raftIndex, std::vector<WaitingRequest *> *finished,
+                                 std::vector<WaitingRequest *> *reads) {
+  if (raftIndex <= m_lastSnapShotRaftLogIndex) {
+    return false;
+  }
+  publishChangesLocked(raftIndex);
+  completeCommandLocked(raftIndex, Op(), SessionDuplicate, nullptr, finished, reads);
+  return true;
+}
+
+/*
+applyCommandLocked 函数
+主要功能：kvserver 处理从 Raft 集群中收到的一条需要跨分区执行的命令（Txn），执行相应的操作，并完成在该日志索引上等待的请求
+注意：
+    调用者需独占 m_storeMtx；写请求只填写reply放进 finished，读请求放进 reads，由调用者在解锁后统一处理。
+    这样的命令是并行apply的分界：它之前的命令在所有分区上都已经执行完，它执行完之后才开始执行后面的命令
+*/
+bool KvServer::applyCommandLocked(int raftIndex, Op &op, std::vector<WaitingRequest *> *finished,
+                                  std::vector<WaitingRequest *> *reads) {
+  DPrintf("[KvServer::applyCommandLocked-kvserver{%d}] , Got Command --> Index:{%d} , ClientId {%llu}, RequestId {%d}, Opreation {%s}, Key :{%s}", m_me, raftIndex, (unsigned long long)op.ClientId, op.RequestId, op.Operation.c_str(), op.Key.c_str());
+
+  // 1. 检查日志索引
+  if (raftIndex <= m_lastSnapShotRaftLogIndex) {
+    // 命令的索引小于或等于最后的快照日志索引，说明该命令已经包含在快照中，不需要再次处理
+    return false;
+  }
+  for (auto &partition : m_partitions) {
+    partition->applyingIndex = raftIndex;
+  }
+
+  // 2. 去重和执行命令，会话已过期的命令不执行
+  SessionCheck check = applySession(raftIndex, op);
+  std::unique_ptr<raftKVRpcProctoc::TxnReply> txnResult;   // 本次执行的Txn结果，直接交给在这条日志上等待的请求
+  if (check == SessionFresh && op.Operation == "Txn") {
+    txnResult = std::make_unique<raftKVRpcProctoc::TxnReply>();
+    applyTxnLocked(op, txnResult.get());
+  }
+  publishChangesLocked(raftIndex);   // 这条日志的变更都已经记录，对 Watch 可见
+
+  // 3. 完成在该索引上等待的请求
+  completeCommandLocked(raftIndex, op, check, txnResult.get(), finished, reads);
+  return true;
+}
+
+/*
+isPartitionable 函数
+主要功能：判断命令能否拆到各分区独立执行
+    1. 单键命令只访问键所在的分区
+    2. MultiPut 和 ExpireKeys 涉及多个键，但每个键的处理互不依赖，各分区各自处理属于自己的键
+    3. Txn 的条件要同时读取多个分区，执行结果又决定写哪些分区，只能在所有分区都停下来时执行
+*/
+bool KvServer::isPartitionable(const Op &op) { return op.Operation != "Txn"; }
+
+/*
+applyPartitionedLocked 函数
+主要功能：apply [begin, end) 这一段可以按分区拆开的命令
+    1. 按日志顺序检查日志索引、维护会话表（会话表是全局的，必须顺序处理），确定哪些命令需要执行，分给各分区
+    2. 各分区并行执行分到的命令，每个分区内部仍然按日志顺序执行；不同分区的键互不相交，执行结果与顺序执行完全相同
+    3. 所有分区都执行完这一段之后，才按日志顺序记录读改写的结果、发布变更、完成等待的请求，
+       因此客户端收到回复时，这一段的所有命令在所有分区上都已经apply
+注意：调用者需独占 m_storeMtx；返回这一段最后一条被应用的命令索引，没有被应用的命令时返回 -1
+*/
+int KvServer::applyPartitionedLocked(std::span<ApplyMsg> messages, std::vector<Op> &ops, size_t begin, size_t end,
+                                     std::vector<WaitingRequest *> *finished, std::vector<WaitingRequest *> *reads) {
+  // 1. 顺序阶段：检查日志索引和会话，把需要执行的命令分给它访问的分区
+  std::vector<bool> applied(end - begin, false);
+  std::vector<SessionCheck> checks(end - begin, SessionDuplicate);
+  int lastAppliedIndex = -1;
+  for (size_t i = begin; i < end; ++i) {
+    int raftIndex = messages[i].CommandIndex;
+    const Op &op = ops[i];
+    DPrintf("[KvServer::applyPartitionedLocked-kvserver{%d}] , Got Command --> Index:{%d} , ClientId {%llu}, RequestId {%d}, Opreation {%s}, Key :{%s}", m_me, raftIndex, (unsigned long long)op.ClientId, op.RequestId, op.Operation.c_str(), op.Key.c_str());
+    if (raftIndex <= m_lastSnapShotRaftLogIndex) {
+      // 命令已经包含在快照中，不需要再次处理
+      continue;
+    }
+    applied[i - begin] = true;
+    lastAppliedIndex = raftIndex;
+    // 读请求的请求ID也在这里记录，所有副本按日志顺序得到完全一样的会话状态
+    checks[i - begin] = applySession(raftIndex, op);
+    if (checks[i - begin] != SessionFresh) {
+      continue;
+    }
+    if (op.Operation == "MultiPut" || op.Operation == "ExpireKeys") {
+      for (auto &partition : m_partitions) {
+        partition->tasks.push_back(i);
+      }
+    } else if (op.Operation == "Put" || op.Operation == "Append" || op.Operation == "CompareAndSwap" ||
+               op.Operation == "Increment" || op.Operation == "PutIfAbsent" || op.Operation == "Delete") {
+      partitionOf(op.Key).tasks.push_back(i);
+    }
+    // Get、MultiGet、Scan 由读线程池在共享锁下执行，RegisterSession 只修改会话表，都不需要分区执行
+    if (op.Operation == "ExpireKeys" && raftIndex >= m_expireProposalIndex.load()) {
+      m_expireProposalIndex.store(-1);   // 本节点提交的删除命令已经apply，可以提交下一批
+    }
+  }
+  if (lastAppliedIndex == -1) {
+    return -1;
+  }
+
+  // 2. 并行阶段：各分区执行分到的命令
+  std::vector<int> statuses(ops.size(), RmwOk);
+  std::vector<int64_t> results(ops.size(), 0);
+  runPartitionTasks(messages, ops, &statuses, &results);
+
+  // 3. 顺序阶段：读改写的结果缓存在会话中，回复（包括超时后重试的重复请求）都从缓存中取
+  for (size_t i = begin; i < end; ++i) {
+    const Op &op = ops[i];
+    if (checks[i - begin] == SessionFresh &&
+        (op.Operation == "CompareAndSwap" || op.Operation == "Increment" || op.Operation == "PutIfAbsent" ||
+         op.Operation == "Delete")) {
+      recordResult(op.ClientId, statuses[i], results[i]);
+    }
+  }
+  publishChangesLocked(lastAppliedIndex);
+  for (size_t i = begin; i < end; ++i) {
+    if (applied[i - begin]) {
+      completeCommandLocked(messages[i].CommandIndex, ops[i], checks[i - begin], nullptr, finished, reads);
+    }
+  }
+  return lastAppliedIndex;
+}
+
+/*
+runPartitionTasks 函数
+主要功能：各分区并行执行分到的命令（partition->tasks），全部完成后才返回
+注意：
+    调用者需独占 m_storeMtx，执行期间没有其他线程访问存储；每个分区只由一个线程访问，分区内不需要再加锁。
+    只有一个分区有命令时直接在apply线程执行；否则第一个分区在apply线程执行，其余的交给 m_applyPool
+*/
+void KvServer::runPartitionTasks(std::span<ApplyMsg> messages, std::vector<Op> &ops, std::vector<int> *statuses,
+                                 std::vector<int64_t> *results) {
+  std::vector<size_t> busy;
+  for (size_t p = 0; p < m_partitions.size(); ++p) {
+    if (!m_partitions[p]->tasks.empty()) {
+      busy.push_back(p);
+    }
+  }
+  auto run = [&](size_t p) -> void {
+    Partition &partition = *m_partitions[p];
+    for (size_t i : partition.tasks) {
+      partition.applyingIndex = messages[i].CommandIndex;
+      executeOnPartitionLocked(p, ops[i], &(*statuses)[i], &(*results)[i]);
+    }
+    partition.tasks.clear();
+  };
+  if (busy.size() <= 1) {
+    for (size_t p : busy) {
+      run(p);
+    }
+    return;
+  }
+
+  std::latch done(static_cast<std::ptrdiff_t>(busy.size() - 1));
+  for (size_t k = 1; k < busy.size(); ++k) {
+    size_t p = busy[k];
+    m_applyPool->scheduler([&run, &done, p]() -> void {
+      run(p);
+      done.count_down();
+    });
+  }
+  run(busy[0]);
+  done.wait();
+}
+
+/*
+executeOnPartitionLocked 函数
+主要功能：执行命令中属于该分区的部分；单键命令只会分给键所在的分区，读改写的执行结果写到 status 和 result 中
+注意：调用者需独占 m_storeMtx，并且保证同一时刻只有一个线程访问这个分区
+*/
+void KvServer::executeOnPartitionLocked(size_t partition, Op &op, int *status, int64_t *result) {
+  if (op.Operation == "Put") {
+    ExecutePutOpOnKVDB(op);
+  } else if (op.Operation == "Append") {
+    ExecuteAppendOpOnKVDB(op);
+  } else if (op.Operation == "MultiPut") {
+    multiPutLocked(partition, op);
+  } else if (op.Operation == "CompareAndSwap") {
+    *status = ExecuteCompareAndSwapOpOnKVDB(op);
+  } else if (op.Operation == "Increment") {
+    *status = ExecuteIncrementOpOnKVDB(op, result);
+  } else if (op.Operation == "PutIfAbsent") {
+    *status = ExecutePutIfAbsentOpOnKVDB(op);
+  } else if (op.Operation == "Delete") {
+    *status = ExecuteDeleteOpOnKVDB(op);
+  } else if (op.Operation == "ExpireKeys") {
+    expireKeysLocked(partition, op);
+  }
+}
+
+/*
+publishChangesLocked 函数
+主要功能：把各分区记录的变更按版本号合并后追加进 m_watchHub，再推进到 raftIndex，这之前的变更对 Watch 可见
+注意：调用者需独占 m_storeMtx；每个分区内的变更已经按版本号排列，合并时保持同一版本内的先后顺序
+*/
+void KvServer::publishChangesLocked(int raftIndex) {
+  std::vector<WatchHub::Event> changes;
+  for (auto &partition : m_partitions) {
+    std::move(partition->changes.begin(), partition->changes.end(), std::back_inserter(changes));
+    partition->changes.clear();
+  }
+  std::stable_sort(changes.begin(), changes.end(),
+                   [](const WatchHub::Event &a, const WatchHub::Event &b) { return a.revision < b.revision; });
+  for (auto &change : changes) {
+    m_watchHub.Append(std::move(change));
+  }
+  m_watchHub.Advance(raftIndex);
+}
+
+/*
+completeCommandLocked 函数
+主要功能：命令执行完之后，取出在该索引上等待的请求（只锁它所在的分片），填写reply
+注意：调用者需独占 m_storeMtx；txnResult 是刚执行的Txn的结果，不为空时直接交给等待的请求
+*/
+void KvServer::completeCommandLocked(int raftIndex, const Op &op, SessionCheck check,
+                                     raftKVRpcProctoc::TxnReply *txnResult, std::vector<WaitingRequest *> *finished,
+                                     std::vector<WaitingRequest *> *reads) {
+  m_waitingRequests.MarkApplied(raftIndex);
+  WaitingRequest *request = m_waitingRequests.Take(raftIndex);
+  if (request == nullptr) {
+    return;
+  }
+  bool isRead = request->kind == WaitingRequest::GetRequest || request->kind == WaitingRequest::MultiGetRequest ||
+                request->kind == WaitingRequest::ScanRequest;
+  bool committed = op.ClientId == request->op.ClientId && op.RequestId == request->op.RequestId;
+  request->sessionExpired = committed && check == SessionUnknown;
+  if (txnResult != nullptr && committed && request->kind == WaitingRequest::TxnRequest) {
+    auto *reply = static_cast<raftKVRpcProctoc::TxnReply *>(request->reply);
+    reply->Swap(txnResult);
+    reply->set_err(OK);
+    finished->push_back(request);
+  } else if (isRead && committed && !request->sessionExpired) {
+    // 读请求的日志已经apply，之后任何时刻读到的状态都不早于它，满足线性一致性，交给读线程池执行
+    reads->push_back(request);
+  } else {
+    fillWaitingReply(request, &op, true);
+    finished->push_back(request);
+  }
+}
+
+/*
+serveReadRequest 函数
+主要功能：在读线程池中执行一个已经提交的读请求，只持有 m_storeMtx 的共享锁，多个读请求以及快照制作可以并行
+*/
+void KvServer::serveReadRequest(WaitingRequest *request) {
+  {
+    std::shared_lock<std::shared_mutex> lg(m_storeMtx);
+    fillWaitingReply(request, &request->op, true);
+  }
+  replyWaitingRequest(request);
+}
+
+/*
+GetCommandFromRaft 函数
+主要功能：处理单条命令，等价于只有一条消息的 Apply
+*/
+void KvServer::GetCommandFromRaft(const ApplyMsg &message) {
+  ApplyMsg copy = message;    // 命令是共享缓冲区，这里只增加引用计数
+  Apply(std::span<ApplyMsg>(&copy, 1));
+}
+
+/*
+ifRequestDuplicate 函数
+主要功能：检查客户端的请求是否是重复的
+*/
+bool KvServer::ifRequestDuplicate(uint64_t ClientId, int RequestId) {
+  std::lock_guard<std::mutex> lg(m_sessionMtx);
+  const SessionTable::Session *session = m_sessions.Find(ClientId);
+  if (session == nullptr) {
+    // 这个客户端没有注册会话，或者会话已经过期
+    return false;
+  }
+
+  return RequestId <= session->lastRequestId;    // 与所记录的该客户端最后的请求序号比较
+}
+
+/*
+applySession 函数
+主要功能：apply一条命令时维护会话表，所有判断只依赖日志内容，各副本得到完全一致的结果
+    1. 用命令的时间戳推进会话时钟，删除超过 SESSION_EXPIRE_TIME 没有活动的会话
+    2. RegisterSession 命令以自己的日志索引为ID创建会话，会话数达到上限时淘汰最久未活跃的会话
+    3. 其他命令：会话不存在返回 SessionUnknown；请求ID不大于记录的最后请求ID返回 SessionDuplicate；否则记录请求ID
+注意：没有时间戳的命令是引入会话之前写入的日志，它们的客户端没有注册过程，第一次出现时直接创建会话，保持旧的行为
+*/
+KvServer::SessionCheck KvServer::applySession(int raftIndex, const Op &op) {
+  std::lock_guard<std::mutex> lg(m_sessionMtx);
+  if (op.Timestamp > m_sessionClock) {    // 会话时钟只前进不后退，新Leader的时钟稍慢也不会让会话"复活"
+    m_sessionClock = op.Timestamp;
+    m_sessions.ExpireBefore(m_sessionClock - SESSION_EXPIRE_TIME);
+  }
+
+  if (op.Operation == "RegisterSession") {
+    if (m_sessions.Size() >= SESSION_MAX_NUM) {
+      m_sessions.EvictOldest();
+    }
+    m_sessions.Insert(raftIndex, m_sessionClock);
+    return SessionFresh;
+  }
+  if (op.Operation == "ExpireKeys") {   // Leader自己提交的命令，不属于任何会话
+    return SessionFresh;
+  }
+
+  SessionTable::Session *session = m_sessions.Find(op.ClientId);
+  if (session == nullptr) {
+    if (op.Timestamp != 0) {
+      return SessionUnknown;
+    }
+    if (m_sessions.Size() >= SESSION_MAX_NUM) {
+      m_sessions.EvictOldest();
+    }
+    session = m_sessions.Insert(op.ClientId, m_sessionClock);
+  }
+  m_sessions.Touch(op.ClientId, m_sessionClock);    // 只调整链表，不移动槽位，session 指针仍然有效
+  if (op.RequestId <= session->lastRequestId) {
+    return SessionDuplicate;
+  }
+  session->lastRequestId = op.RequestId;    // 更新下这个客户端的请求ID
+  session->lastStatus = RmwOk;
+  session->lastResult = 0;
+  return SessionFresh;
+}
+
+void KvServer::recordResult(uint64_t ClientId, int status, int64_t result) {
+  std::lock_guard<std::mutex> lg(m_sessionMtx);
+  SessionTable::Session *session = m_sessions.Find(ClientId);
+  if (session != nullptr) {
+    session->lastStatus = status;
+    session->lastResult = result;
+  }
+}
+
+/*
+applyTxnLocked 函数
+主要功能：解析并执行一条Txn命令，条件是否成立缓存在会话中
+注意：调用者需独占 m_storeMtx；命令由Leader编码，解析失败说明数据损坏，按条件不成立且不执行任何操作处理
+*/
+void KvServer::applyTxnLocked(const Op &op, raftKVRpcProctoc::TxnReply *result) {
+  raftKVRpcProctoc::TxnArgs txn;
+  bool succeeded = txn.ParseFromString(op.Value) && ExecuteTxnOpOnKVDB(txn, result);
+  recordResult(op.ClientId, succeeded ? RmwOk : RmwFailed, 0);
+}
+
+/*
+readTxnResults 函数
+主要功能：重复的Txn请求不会再执行，条件是否成立来自会话缓存，GET的结果按当前状态重新读取
+注意：调用者需持有 m_storeMtx
+*/
+void KvServer::readTxnResults(const Op &op, bool succeeded, raftKVRpcProctoc::TxnReply *reply) {
+  raftKVRpcProctoc::TxnArgs txn;
+  reply->set_succeeded(succeeded);
+  reply->clear_results();
+  if (!txn.ParseFromString(op.Value)) {
+    return;
+  }
+  for (const auto &txnOp : succeeded ? txn.success() : txn.failure()) {
+    auto *opResult = reply->add_results();
+    if (txnOp.optype() == raftKVRpcProctoc::TxnOp::GET) {
+      opResult->set_exists(partitionOf(txnOp.key()).store->Get(txnOp.key(), opResult->mutable_value()));
+    }
+  }
+}
+
+/*
+lastResultOf 函数
+主要功能：取出请求缓存的执行结果；会话不存在或者会话已经处理了更新的请求时返回 false
+*/
+bool KvServer::lastResultOf(uint64_t ClientId, int RequestId, int *status, int64_t *result) {
+  std::lock_guard<std::mutex> lg(m_sessionMtx);
+  const SessionTable::Session *session = m_sessions.Find(ClientId);
+  if (session == nullptr || session->lastRequestId != RequestId) {
+    return false;
+  }
+  *status = session->lastStatus;
+  *result = session->lastResult;
+  return true;
+}
+
+/*
+KvServer::PutAppend函数
+主要功能：处理客户端发起的PutAppend RPC请求，并将这些请求提交给 Raft 集群
+注意：
+    get和put/append执行的具体细节是不一样的
+    与Get一样，本函数登记等待后立即返回，由apply线程完成回复
+*/
+void KvServer::PutAppend(const raftKVRpcProctoc::PutAppendArgs *args, raftKVRpcProctoc::PutAppendReply *reply,
+                         google::protobuf::Closure *done) {
+  // 1. 构造操作对象
+  Op op;
+  op.Operation = args->op();         // 设置操作类型（Put 或 Append）
+  op.Key = args->key();              // 设置键
+  op.ClientId = args->clientid();    // 设置客户端ID
+  op.RequestId = args->requestid();  // 设置请求ID
+  op.Timestamp = leaderTimestamp();  // 设置时间戳，用于会话过期
+  if (op.Operation == "Put" && args->ttlms() > 0) {
+    op.ExpireAt = op.Timestamp + args->ttlms();   // 过期时间按Leader的时钟计算后写进日志，各副本不再看本地时间
+  }
+  // 值不放进op：它只在编码时从请求中直接拷贝进日志命令，等待中的请求也不需要保存值
+
+  // 2. 提交请求给raft节点
+  int raftIndex = -1;   // 存储此命令所对应的日志索引
+  int _ = -1;
+  bool isLeader = false;
+  m_raftNode->Start(op.asStringWithValue(args->value()), &raftIndex, &_, &isLeader);
+
+  // 3. 检查Leader状态：当前节点不是 Leader，返回 ErrWrongLeader 错误。
+  if (!isLeader) {    
+    reply->set_err(ErrWrongLeader);
+    done->Run();
+    return;
+  }
+
+  // 4. 登记等待，等待 Raft 集群对该命令的处理结果
+  // 注意这里和Get方法的区别，put和append应用并不是在完成回调中执行的，而是由apply循环具体处理，回调只负责回复
+  WaitingRequest *request = m_waitingRequests.Acquire(raftIndex);
+  request->kind = WaitingRequest::PutAppendRequest;
+  request->op = std::move(op);
+  request->reply = reply;
+  request->done = done;
+  addWaitingRequest(request);
+}
+
+/*
+KvServer::MultiGet 函数
+主要功能：处理客户端的MultiGet请求，所有键作为一条命令提交给raft，apply后在同一次加锁内读出
+*/
+void KvServer::MultiGet(const raftKVRpcProctoc::MultiGetArgs *args, raftKVRpcProctoc::MultiGetReply *reply,
+                        google::protobuf::Closure *done) {
+  Op op;
+  op.Operation = "MultiGet";
+  op.Keys.assign(args->keys().begin(), args->keys().end());
+  op.ClientId = args->clientid();
+  op.RequestId = args->requestid();
+  op.Timestamp = leaderTimestamp();
+
+  int raftIndex = -1;
+  int _ = -1;
+  bool isLeader = false;
+  m_raftNode->Start(op, &raftIndex, &_, &isLeader);
+  if (!isLeader) {
+    reply->set_err(ErrWrongLeader);
+    done->Run();
+    return;
+  }
+
+  WaitingRequest *request = m_waitingRequests.Acquire(raftIndex);
+  request->kind = WaitingRequest::MultiGetRequest;
+  request->op = std::move(op);
+  request->reply = reply;
+  request->done = done;
+  addWaitingRequest(request);
+}
+
+/*
+KvServer::MultiPut 函数
+主要功能：处理客户端的MultiPut请求，整批键值对只对应一条raft日志，apply时原子地一次写入
+*/
+void KvServer::MultiPut(const raftKVRpcProctoc::MultiPutArgs *args, raftKVRpcProctoc::MultiPutReply *reply,
+                        google::protobuf::Closure *done) {
+  if (args->keys_size() != args->values_size()) {   // 键和值必须一一对应
+    reply->set_err(ErrBadArgs);
+    done->Run();
+    return;
+  }
+
+  Op op;
+  op.Operation = "MultiPut";
+  op.Keys.assign(args->keys().begin(), args->keys().end());
+  op.Values.assign(args->values().begin(), args->values().end());
+  op.ClientId = args->clientid();
+  op.RequestId = args->requestid();
+  op.Timestamp = leaderTimestamp();
+
+  int raftIndex = -1;
+  int _ = -1;
+  bool isLeader = false;
+  m_raftNode->Start(op, &raftIndex, &_, &isLeader);
+  if (!isLeader) {
+    reply->set_err(ErrWrongLeader);
+    done->Run();
+    return;
+  }
+  std::vector<std::string>().swap(op.Values);   // 值已经编码进日志，等待中的请求不再需要
 
-  DEFER {
-    m_skipList.display_list();
-  };
+  WaitingRequest *request = m_waitingRequests.Acquire(raftIndex);
+  request->kind = WaitingRequest::MultiPutRequest;
+  request->op = std::move(op);
+  request->reply = reply;
+  request->done = done;
+  addWaitingRequest(request);
 }
 
 /*
-ExecuteAppendOpOnKVDB 函数
-主要功能：执行append功能，添加键值对
+KvServer::Scan 函数
+主要功能：处理客户端的范围查找请求，返回一页键值对和翻页用的起始键
+注意：
+    与Get相同，请求作为一条命令经过raft日志，apply之后才读，保证读到的不早于请求到达时已提交的状态（线性一致）
+    每一页是一次独立的线性一致读，页与页之间可能有其他写入；翻页令牌就是下一页的起始键，服务端不需要保存游标
 */
-void KvServer::ExecuteAppendOpOnKVDB(Op op) {
-  m_mtx.lock();
-
-  m_skipList.insert_set_element(op.Key, op.Value);   // 在跳表中添加键值对
+void KvServer::Scan(const raftKVRpcProctoc::ScanArgs *args, raftKVRpcProctoc::ScanReply *reply,
+                    google::protobuf::Closure *done) {
+  Op op;
+  op.Operation = "Scan";
+  op.Key = args->startkey();
+  op.Value = args->endkey();
+  op.ClientId = args->clientid();
+  op.RequestId = args->requestid();
+  op.Timestamp = leaderTimestamp();
 
-  m_lastRequestId[op.ClientId] = op.RequestId;    // 更新下这个客户端的请求ID
-  m_mtx.unlock();
+  int raftIndex = -1;
+  int _ = -1;
+  bool isLeader = false;
+  m_raftNode->Start(op, &raftIndex, &_, &isLeader);
+  if (!isLeader) {
+    reply->set_err(ErrWrongLeader);
+    done->Run();
+    return;
+  }
 
-  DprintfKVDB();    // 打印下数据库内容
+  WaitingRequest *request = m_waitingRequests.Acquire(raftIndex);
+  request->kind = WaitingRequest::ScanRequest;
+  request->op = std::move(op);
+  request->scanLimit = args->limit() > 0 ? std::min(args->limit(), SCAN_PAGE_MAX) : SCAN_PAGE_MAX;
+  request->reply = reply;
+  request->done = done;
+  addWaitingRequest(request);
 }
 
 /*
-KvServer::ExecuteGetOpOnKVDB 函数
-主要功能：执行get功能，获取指定键所对应的值
+KvServer::CompareAndSwap 函数
+主要功能：处理客户端的比较并交换请求，比较和写入在apply时一起执行，只需要一轮共识
 */
-void KvServer::ExecuteGetOpOnKVDB(Op op, std::string *value, bool *exist) {
-  m_mtx.lock();
-
-  // 初始化
-  *value = "";
-  *exist = false;
+void KvServer::CompareAndSwap(const raftKVRpcProctoc::CompareAndSwapArgs *args,
+                              raftKVRpcProctoc::CompareAndSwapReply *reply, google::protobuf::Closure *done) {
+  Op op;
+  op.Operation = "CompareAndSwap";
+  op.Key = args->key();
+  op.Values.push_back(args->expected());
+  op.ClientId = args->clientid();
+  op.RequestId = args->requestid();
+  op.Timestamp = leaderTimestamp();
 
-  if (m_skipList.search_element(op.Key, *value)) {    // 在跳表中查询
-    *exist = true;
+  int raftIndex = -1;
+  int _ = -1;
+  bool isLeader = false;
+  m_raftNode->Start(op.asStringWithValue(args->value()), &raftIndex, &_, &isLeader);
+  if (!isLeader) {
+    reply->set_err(ErrWrongLeader);
+    done->Run();
+    return;
   }
+  std::vector<std::string>().swap(op.Values);   // 期望值已经编码进日志，等待中的请求不再需要
 
-  m_lastRequestId[op.ClientId] = op.RequestId;
-  m_mtx.unlock();
-
-  DprintfKVDB();
+  WaitingRequest *request = m_waitingRequests.Acquire(raftIndex);
+  request->kind = WaitingRequest::CompareAndSwapRequest;
+  request->op = std::move(op);
+  request->reply = reply;
+  request->done = done;
+  addWaitingRequest(request);
 }
 
 /*
-KvServer::ExecutePutOpOnKVDB
-主要功能：执行put功能，
+KvServer::Increment 函数
+主要功能：处理客户端的原子自增请求，增量以十进制字符串放在命令的 Value 中
 */
-void KvServer::ExecutePutOpOnKVDB(Op op) {
-  m_mtx.lock();
-  m_skipList.insert_set_element(op.Key, op.Value);
-  // m_kvDB[op.Key] = op.Value;
-  m_lastRequestId[op.ClientId] = op.RequestId;
-  m_mtx.unlock();
+void KvServer::Increment(const raftKVRpcProctoc::IncrementArgs *args, raftKVRpcProctoc::IncrementReply *reply,
+                         google::protobuf::Closure *done) {
+  Op op;
+  op.Operation = "Increment";
+  op.Key = args->key();
+  op.Value = std::to_string(args->delta());
+  op.ClientId = args->clientid();
+  op.RequestId = args->requestid();
+  op.Timestamp = leaderTimestamp();
 
-  //    DPrintf("[KVServerExePUT----]ClientId :%d ,RequestID :%d ,Key : %v, value : %v", op.ClientId, op.RequestId,
-  //    op.Key, op.Value)
-  DprintfKVDB();
+  int raftIndex = -1;
+  int _ = -1;
+  bool isLeader = false;
+  m_raftNode->Start(op, &raftIndex, &_, &isLeader);
+  if (!isLeader) {
+    reply->set_err(ErrWrongLeader);
+    done->Run();
+    return;
+  }
+
+  WaitingRequest *request = m_waitingRequests.Acquire(raftIndex);
+  request->kind = WaitingRequest::IncrementRequest;
+  request->op = std::move(op);
+  request->reply = reply;
+  request->done = done;
+  addWaitingRequest(request);
 }
 
 /*
-KvServer::Get 函数
-主要功能：处理来自客户端的Get RPC请求（注意本函数不是RPC方法，而是在GetRPC方法中调用的处理函数）
+KvServer::PutIfAbsent 函数
+主要功能：处理客户端的PutIfAbsent请求，键不存在时才写入，可以用来实现锁
 */
-void KvServer::Get(const raftKVRpcProctoc::GetArgs *args, raftKVRpcProctoc::GetReply *reply) {
-  // 1. 构造操作对象
+void KvServer::PutIfAbsent(const raftKVRpcProctoc::PutIfAbsentArgs *args, raftKVRpcProctoc::PutIfAbsentReply *reply,
+                           google::protobuf::Closure *done) {
   Op op;
-  op.Operation = "Get";
+  op.Operation = "PutIfAbsent";
   op.Key = args->key();
-  op.Value = "";
   op.ClientId = args->clientid();
   op.RequestId = args->requestid();
+  op.Timestamp = leaderTimestamp();
 
-  // 2. 向Raft集群提交操作（客户端发来了Get操作请求，需要通知raft节点将这个请求转换成日志条目，以实现各个raft节点之间的同步），要大部分raft节点同步了这个日志条目，Leader才会真正去执行这个操作请求。
   int raftIndex = -1;
   int _ = -1;
   bool isLeader = false;
-  m_raftNode->Start(op, &raftIndex, &_, &isLeader);     // 让raft节点（Leader）开始处理客户端的命令请求，并构造日志条目
-  if (!isLeader) {    // 说明本节点不是Leader，客户端不应该向非Leader节点发送请求，报错。
+  m_raftNode->Start(op.asStringWithValue(args->value()), &raftIndex, &_, &isLeader);
+  if (!isLeader) {
     reply->set_err(ErrWrongLeader);
+    done->Run();
     return;
   }
 
-  // 3. 创建等待通道（线程安全队列），用于在操作提交后进行等待和同步Leader节点是否commit
-  m_mtx.lock();
-  if (waitApplyCh.find(raftIndex) == waitApplyCh.end()) {   // raftIndex是raft节点为新的日志条目生成的索引
-    waitApplyCh.insert(std::make_pair(raftIndex, new LockQueue<Op>()));
-  }
-  auto chForRaftIndex = waitApplyCh[raftIndex];
-  m_mtx.unlock(); //直接解锁，等待任务执行完成，不能一直拿锁等待
-
-  // 4. 等待操作提交，并提供超时处理
-  Op raftCommitOp;
-
-  // 从通道中取出消息，并设置超时时间CONSENSUS_TIMEOUT，如果在时间内一直没能取出消息则触发超时
-  if (!chForRaftIndex->timeOutPop(CONSENSUS_TIMEOUT, &raftCommitOp)) {      
-    // 超时了，没有完成commit
-    int _ = -1;
-    bool isLeader = false;
-    m_raftNode->GetState(&_, &isLeader);      
-    // 检查请求是否重复以及当前节点是否仍为领导者
-    if (ifRequestDuplicate(op.ClientId, op.RequestId) && isLeader) {    
-      // 如果是重复的请求且节点是Leader，虽然超时了，raft集群不保证已经commitIndex该日志
-      // 但是如果是已经提交过的get请求，是可以再执行的。不会违反线性一致性
-      std::string value;
-      bool exist = false;
-      ExecuteGetOpOnKVDB(op, &value, &exist);   // 执行取出操作
-      if (exist) {    // 成功取出
-        reply->set_err(OK);   
-        reply->set_value(value);
-      } else {        // 失败，不存在该键
-        reply->set_err(ErrNoKey);
-        reply->set_value("");
-      }
-    } else {  // 否则，超时了即没完成
-      reply->set_err(ErrWrongLeader);  //返回这个，其实就是让clerk换一个节点重试
-    }
-  } else {
-    // 没超时，raft节点提交了这个命令，则可以正式执行了
-    // 再次检验下leader提交的命令和当前命令是否一致：其实不用检验，leader只要正确的提交了，那么这些肯定是符合的
-    if (raftCommitOp.ClientId == op.ClientId && raftCommitOp.RequestId == op.RequestId) {
-      std::string value;
-      bool exist = false;
-      ExecuteGetOpOnKVDB(op, &value, &exist);
-      if (exist) {
-        reply->set_err(OK);
-        reply->set_value(value);
-      } else {
-        reply->set_err(ErrNoKey);
-        reply->set_value("");
-      }
-    } else {
-      reply->set_err(ErrWrongLeader);
-    }
-  }
-  // 销毁线程安全队列资源
-  m_mtx.lock();  // todo 這個可以先弄一個defer，因爲刪除優先級並不高，先把rpc發回去更加重要
-  auto tmp = waitApplyCh[raftIndex];
-  waitApplyCh.erase(raftIndex);
-  delete tmp;
-  m_mtx.unlock();
+  WaitingRequest *request = m_waitingRequests.Acquire(raftIndex);
+  request->kind = WaitingRequest::PutIfAbsentRequest;
+  request->op = std::move(op);
+  request->reply = reply;
+  request->done = done;
+  addWaitingRequest(request);
 }
 
 /*
-GetCommandFromRaft 函数
-主要功能：kvserver 处理从 Raft 集群中收到的Get、Put/Append命令，解析Raft日志条目，执行相应的操作，并处理与客户端请求相关的状态同步问题
+KvServer::Txn 函数
+主要功能：处理客户端的事务请求，比较条件和两组操作序列化后放进一条命令，只需要一轮共识
 */
-void KvServer::GetCommandFromRaft(ApplyMsg message) {
-  // 1. 解析命令
-  Op op;
-  op.parseFromString(message.Command);    // 从string格式的命令获得op
+void KvServer::Txn(const raftKVRpcProctoc::TxnArgs *args, raftKVRpcProctoc::TxnReply *reply,
+                   google::protobuf::Closure *done) {
+  if (args->compares_size() + args->success_size() + args->failure_size() > TXN_MAX_OPS) {
+    reply->set_err(ErrBadArgs);
+    done->Run();
+    return;
+  }
 
-  DPrintf("[KvServer::GetCommandFromRaft-kvserver{%d}] , Got Command --> Index:{%d} , ClientId {%s}, RequestId {%d}, Opreation {%s}, Key :{%s}, Value :{%s}", m_me, message.CommandIndex, &op.ClientId, op.RequestId, &op.Operation, &op.Key, &op.Value);
+  Op op;
+  op.Operation = "Txn";
+  args->SerializeToString(&op.Value);
+  op.ClientId = args->clientid();
+  op.RequestId = args->requestid();
+  op.Timestamp = leaderTimestamp();
 
-  // 2. 检查日志索引  
-  if (message.CommandIndex <= m_lastSnapShotRaftLogIndex) {   
-    // 命令的索引小于或等于最后的快照日志索引，说明该命令已经包含在快照中，不需要再次处理
+  int raftIndex = -1;
+  int _ = -1;
+  bool isLeader = false;
+  m_raftNode->Start(op, &raftIndex, &_, &isLeader);
+  if (!isLeader) {
+    reply->set_err(ErrWrongLeader);
+    done->Run();
     return;
   }
 
-  // 3. 去重和执行命令，这里不需要执行Get，因为Get结果要返回给客户端所以不在这里执行
-  if (!ifRequestDuplicate(op.ClientId, op.RequestId)) {   
-    // put和append都不需要重复执行，如果重复了就不执行了
-    if (op.Operation == "Put") {
-      ExecutePutOpOnKVDB(op);   
-    }
-    if (op.Operation == "Append") {
-      ExecuteAppendOpOnKVDB(op);
-    }
-  }
+  WaitingRequest *request = m_waitingRequests.Acquire(raftIndex);
+  request->kind = WaitingRequest::TxnRequest;
+  request->op = std::move(op);    // 保留事务内容，重复的请求需要用它重新读取GET的结果
+  request->reply = reply;
+  request->done = done;
+  addWaitingRequest(request);
+}
+
+/*
+KvServer::Delete 函数
+主要功能：处理客户端的删除请求，结果（键删除前是否存在）与读改写操作一样缓存在会话中
+*/
+void KvServer::Delete(const raftKVRpcProctoc::DeleteArgs *args, raftKVRpcProctoc::DeleteReply *reply,
+                      google::protobuf::Closure *done) {
+  Op op;
+  op.Operation = "Delete";
+  op.Key = args->key();
+  op.ClientId = args->clientid();
+  op.RequestId = args->requestid();
+  op.Timestamp = leaderTimestamp();
 
-  // 4. 检查是否需要快照
-  if (m_maxRaftState != -1) {
-    IfNeedToSendSnapShotCommand(message.CommandIndex, 9);   
+  int raftIndex = -1;
+  int _ = -1;
+  bool isLeader = false;
+  m_raftNode->Start(op, &raftIndex, &_, &isLeader);
+  if (!isLeader) {
+    reply->set_err(ErrWrongLeader);
+    done->Run();
+    return;
   }
 
-  // 5. 发送消息到等待通道，通知客户端此命令已经处理完毕
-  SendMessageToWaitChan(op, message.CommandIndex);
+  WaitingRequest *request = m_waitingRequests.Acquire(raftIndex);
+  request->kind = WaitingRequest::DeleteRequest;
+  request->op = std::move(op);
+  request->reply = reply;
+  request->done = done;
+  addWaitingRequest(request);
 }
 
 /*
-ifRequestDuplicate 函数
-主要功能：检查客户端的请求是否是重复的
+KvServer::Watch 函数
+主要功能：处理客户端的 Watch 长轮询请求
+注意：
+    不提交raft日志，任何节点都可以回复；变更历史只来自已经apply的日志，客户端带着 NextRevision 换节点续传不会漏掉变更，
+    只是落后的Follower可能晚一些才能看到；挂起的请求由apply线程在有新变更或超时时回复
 */
-bool KvServer::ifRequestDuplicate(std::string ClientId, int RequestId) {
-  std::lock_guard<std::mutex> lg(m_mtx);
-  if (m_lastRequestId.find(ClientId) == m_lastRequestId.end()) {    
-    // 这个客户端没有发过请求
-    return false;
+void KvServer::Watch(const raftKVRpcProctoc::WatchArgs *args, raftKVRpcProctoc::WatchReply *reply,
+                     google::protobuf::Closure *done) {
+  if (m_watchHub.Watch(args, reply, done)) {
+    done->Run();
   }
-
-  return RequestId <= m_lastRequestId[ClientId];    // 与所记录的该客户端最后的请求序号比较
 }
 
 /*
-KvServer::PutAppend函数
-主要功能：处理客户端发起的PutAppend RPC请求，并将这些请求提交给 Raft 集群
+KvServer::RegisterSession 函数
+主要功能：处理客户端的会话注册请求，命令apply后这条日志的索引就是新会话的ID
 注意：
-    get和put/append执行的具体细节是不一样的
+    注册也要经过raft日志，否则各副本的会话表会不一致，Leader切换后客户端的请求会被当作未知会话
+    注册命令还没有客户端ID，ClientId 字段放一个随机数标识这次请求：这个索引被新Leader的日志覆盖时，
+    即使覆盖它的也是一条 RegisterSession，apply的命令也和等待的请求对不上，同一个会话ID不会回复给两个客户端
 */
-void KvServer::PutAppend(const raftKVRpcProctoc::PutAppendArgs *args, raftKVRpcProctoc::PutAppendReply *reply) {
-  // 1. 构造操作对象
+void KvServer::RegisterSession(raftKVRpcProctoc::RegisterSessionReply *reply, google::protobuf::Closure *done) {
+  static thread_local std::mt19937_64 rng(std::random_device{}());
   Op op;
-  op.Operation = args->op();         // 设置操作类型（Put 或 Append）
-  op.Key = args->key();              // 设置键
-  op.Value = args->value();          // 设置值
-  op.ClientId = args->clientid();    // 设置客户端ID
-  op.RequestId = args->requestid();  // 设置请求ID
+  op.Operation = "RegisterSession";
+  op.Timestamp = leaderTimestamp();
+  do {
+    op.ClientId = rng();
+  } while (op.ClientId == 0);   // 0 表示没有会话
 
-  // 2. 提交请求给raft节点
-  int raftIndex = -1;   // 存储此命令所对应的日志索引
+  int raftIndex = -1;
   int _ = -1;
   bool isLeader = false;
   m_raftNode->Start(op, &raftIndex, &_, &isLeader);
-
-  // 3. 检查Leader状态：当前节点不是 Leader，返回 ErrWrongLeader 错误。
-  if (!isLeader) {    
+  if (!isLeader) {
     reply->set_err(ErrWrongLeader);
+    done->Run();
     return;
   }
 
-  // 4. 创建等待通道，等待 Raft 集群对该命令的处理结果
-  m_mtx.lock();
-  if (waitApplyCh.find(raftIndex) == waitApplyCh.end()) {
-    waitApplyCh.insert(std::make_pair(raftIndex, new LockQueue<Op>()));
+  WaitingRequest *request = m_waitingRequests.Acquire(raftIndex);
+  request->kind = WaitingRequest::RegisterSessionRequest;
+  request->op = std::move(op);
+  request->reply = reply;
+  request->done = done;
+  addWaitingRequest(request);
+}
+
+/*
+addWaitingRequest 函数
+主要功能：登记一个等待apply的请求
+注意：
+    Start返回到登记之间该索引可能已经被apply了（或者该索引上已经有一个旧的等待请求，说明之前的日志被覆盖了），
+    这两种情况都无法确定结果，直接按超时处理，让客户端根据去重机制重试
+*/
+void KvServer::addWaitingRequest(WaitingRequest *request) {
+  request->sessionExpired = false;
+  request->deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(CONSENSUS_TIMEOUT);
+
+  WaitingRequest *displaced = nullptr;
+  if (!m_waitingRequests.Register(request, &displaced)) {
+    finishWaitingRequest(request, nullptr);
+  }
+  if (displaced != nullptr) {
+    finishWaitingRequest(displaced, nullptr);
+  }
+}
+
+/*
+finishWaitingRequest 函数
+主要功能：完成一个等待中的请求：填写reply、调用done->Run()，并把请求对象归还对象池
+输入参数：
+    request：等待中的请求
+    appliedOp：该日志索引上实际apply的命令；为空表示超时
+注意：apply一批日志时不走这里，而是在临界区内 fillWaitingReply，解锁后统一 replyWaitingRequest
+*/
+void KvServer::finishWaitingRequest(WaitingRequest *request, const Op *appliedOp) {
+  int _ = -1;
+  bool isLeader = false;
+  if (appliedOp == nullptr) {
+    m_raftNode->GetState(&_, &isLeader);    // 超时的读请求需要知道自己是否还是Leader，在加锁之前问好
+  }
+  {
+    std::shared_lock<std::shared_mutex> lg(m_storeMtx);
+    fillWaitingReply(request, appliedOp, isLeader);
   }
-  auto chForRaftIndex = waitApplyCh[raftIndex];
-  m_mtx.unlock();
+  replyWaitingRequest(request);
+}
+
+/*
+fillWaitingReply 函数
+主要功能：根据命令的apply结果填写reply，读请求在这里执行
+输入参数：
+    request：等待中的请求
+    appliedOp：该日志索引上实际apply的命令；为空表示超时
+    isLeader：超时时本节点是否是Leader
+注意：调用者需持有 m_storeMtx（共享或独占），不能持有 m_sessionMtx
+*/
+void KvServer::fillWaitingReply(WaitingRequest *request, const Op *appliedOp, bool isLeader) {
+  const Op &op = request->op;
+  // 再次检验下leader提交的命令和当前命令是否一致，不一致说明这个索引被新leader的日志覆盖了
+  bool committed = appliedOp != nullptr && appliedOp->ClientId == op.ClientId && appliedOp->RequestId == op.RequestId;
+  // 命令已经apply，但会话不存在，没有被执行，让客户端重新注册会话
+  const std::string *sessionErr = committed && request->sessionExpired ? &ErrSessionExpired : nullptr;
 
-  // 5. 超时处理
-  Op raftCommitOp;
-  if (!chForRaftIndex->timeOutPop(CONSENSUS_TIMEOUT, &raftCommitOp)) {
-    // 超时了，先判断请求是否是重复的
-    if (ifRequestDuplicate(op.ClientId, op.RequestId)) {
-      // 是重复的，不需要再操作，超时了也没事
-      reply->set_err(OK);
-    } else {
-      reply->set_err(ErrWrongLeader);
+  switch (request->kind) {
+    case WaitingRequest::GetRequest: {
+      auto *reply = static_cast<raftKVRpcProctoc::GetReply *>(request->reply);
+      if (sessionErr != nullptr) {
+        reply->set_err(*sessionErr);
+        break;
+      }
+      bool canRead = committed;
+      if (appliedOp == nullptr) {
+        // 超时了，没有完成commit
+        // 如果是重复的请求且节点是Leader，虽然超时了，raft集群不保证已经commitIndex该日志
+        // 但是如果是已经提交过的get请求，是可以再执行的。不会违反线性一致性
+        canRead = ifRequestDuplicate(op.ClientId, op.RequestId) && isLeader;
+      }
+      if (canRead) {
+        std::string value;
+        bool exist = false;
+        ExecuteGetOpOnKVDB(op, &value, &exist);
+        if (exist) {
+          reply->set_err(OK);
+          reply->set_value(std::move(value));
+        } else {
+          reply->set_err(ErrNoKey);
+          reply->set_value("");
+        }
+      } else {
+        reply->set_err(ErrWrongLeader);  //返回这个，其实就是让clerk换一个节点重试
+      }
+      break;
     }
-  } else {
-    // 没超时，则说明leader节点已经提交命令了
-    // 注意这里和Get方法的区别，put和append应用并不是在这里执行的，而是由后面的事件循环具体处理（实现异步）
-    DPrintf(
-    "[func -KvServer::PutAppend -kvserver{%d}]WaitChanGetRaftApplyMessage<--Server %d , get Command <-- Index:%d , "
-    "ClientId %s, RequestId %d, Opreation %s, Key :%s, Value :%s",
-    m_me, m_me, raftIndex, &op.ClientId, op.RequestId, &op.Operation, &op.Key, &op.Value);
-    if (raftCommitOp.ClientId == op.ClientId && raftCommitOp.RequestId == op.RequestId) {
-      reply->set_err(OK);
-    } else {
-      reply->set_err(ErrWrongLeader);
+    case WaitingRequest::PutAppendRequest: {
+      auto *reply = static_cast<raftKVRpcProctoc::PutAppendReply *>(request->reply);
+      if (sessionErr != nullptr) {
+        reply->set_err(*sessionErr);
+      } else if (appliedOp == nullptr) {
+        // 超时了，先判断请求是否是重复的，是重复的，不需要再操作，超时了也没事
+        reply->set_err(ifRequestDuplicate(op.ClientId, op.RequestId) ? OK : ErrWrongLeader);
+      } else {
+        reply->set_err(committed ? OK : ErrWrongLeader);
+      }
+      break;
+    }
+    case WaitingRequest::MultiGetRequest: {
+      auto *reply = static_cast<raftKVRpcProctoc::MultiGetReply *>(request->reply);
+      if (sessionErr != nullptr) {
+        reply->set_err(*sessionErr);
+        break;
+      }
+      bool canRead = committed;
+      if (appliedOp == nullptr) {   // 与Get相同，重复的请求在Leader上可以直接读
+        canRead = ifRequestDuplicate(op.ClientId, op.RequestId) && isLeader;
+      }
+      reply->clear_values();
+      reply->clear_exists();
+      if (canRead) {
+        std::vector<std::string> values;
+        std::vector<bool> exists;
+        ExecuteMultiGetOpOnKVDB(op, &values, &exists);
+        for (size_t i = 0; i < values.size(); ++i) {
+          reply->add_values(std::move(values[i]));
+          reply->add_exists(exists[i]);
+        }
+        reply->set_err(OK);
+      } else {
+        reply->set_err(ErrWrongLeader);
+      }
+      break;
+    }
+    case WaitingRequest::MultiPutRequest: {
+      auto *reply = static_cast<raftKVRpcProctoc::MultiPutReply *>(request->reply);
+      if (sessionErr != nullptr) {
+        reply->set_err(*sessionErr);
+      } else if (appliedOp == nullptr) {
+        reply->set_err(ifRequestDuplicate(op.ClientId, op.RequestId) ? OK : ErrWrongLeader);
+      } else {
+        reply->set_err(committed ? OK : ErrWrongLeader);
+      }
+      break;
+    }
+    case WaitingRequest::ScanRequest: {
+      auto *reply = static_cast<raftKVRpcProctoc::ScanReply *>(request->reply);
+      if (sessionErr != nullptr) {
+        reply->set_err(*sessionErr);
+        break;
+      }
+      bool canRead = committed;
+      if (appliedOp == nullptr) {   // 与Get相同，重复的请求在Leader上可以直接读
+        canRead = ifRequestDuplicate(op.ClientId, op.RequestId) && isLeader;
+      }
+      reply->clear_keys();
+      reply->clear_values();
+      if (canRead) {
+        std::vector<std::string> keys;
+        std::vector<std::string> values;
+        std::string next;
+        bool more = ExecuteScanOpOnKVDB(op, request->scanLimit, &keys, &values, &next);
+        for (size_t i = 0; i < keys.size(); ++i) {
+          reply->add_keys(std::move(keys[i]));
+          reply->add_values(std::move(values[i]));
+        }
+        reply->set_more(more);
+        reply->set_continuation(std::move(next));
+        reply->set_err(OK);
+      } else {
+        reply->set_err(ErrWrongLeader);
+      }
+      break;
+    }
+    case WaitingRequest::CompareAndSwapRequest:
+    case WaitingRequest::IncrementRequest:
+    case WaitingRequest::PutIfAbsentRequest:
+    case WaitingRequest::DeleteRequest: {
+      // 已经apply（或者超时但确认是重复的请求）时，结果从会话缓存中取，保证重试的请求拿到与第一次执行相同的结果
+      bool applied = committed || (appliedOp == nullptr && ifRequestDuplicate(op.ClientId, op.RequestId));
+      int status = RmwOk;
+      int64_t result = 0;
+      const std::string *err = sessionErr;
+      if (err == nullptr && !(applied && lastResultOf(op.ClientId, op.RequestId, &status, &result))) {
+        err = &ErrWrongLeader;
+      }
+      fillReadModifyWriteReply(request, err, status, result);
+      break;
+    }
+    case WaitingRequest::TxnRequest: {
+      // 刚执行的事务在apply时已经直接回复；走到这里的是重复的请求、超时或者日志被覆盖的情况
+      auto *reply = static_cast<raftKVRpcProctoc::TxnReply *>(request->reply);
+      bool applied = committed || (appliedOp == nullptr && ifRequestDuplicate(op.ClientId, op.RequestId));
+      int status = RmwOk;
+      int64_t result = 0;
+      if (sessionErr != nullptr) {
+        reply->set_err(*sessionErr);
+      } else if (applied && lastResultOf(op.ClientId, op.RequestId, &status, &result)) {
+        readTxnResults(op, status == RmwOk, reply);
+        reply->set_err(OK);
+      } else {
+        reply->set_err(ErrWrongLeader);
+      }
+      break;
+    }
+    case WaitingRequest::RegisterSessionRequest: {
+      // 超时无法确定会话是否创建，让客户端重新注册，多出来的会话没有活动，之后会过期
+      auto *reply = static_cast<raftKVRpcProctoc::RegisterSessionReply *>(request->reply);
+      bool registered = committed && appliedOp->Operation == "RegisterSession";
+      reply->set_err(registered ? OK : ErrWrongLeader);
+      reply->set_clientid(registered ? request->raftIndex : 0);
+      break;
     }
   }
+}
+
+/*
+fillReadModifyWriteReply 函数
+主要功能：填写读改写操作的reply，失败时附带键的当前值，调用者可以直接用它重试
+注意：调用者需持有 m_storeMtx；err 不为空时只填写错误信息
+*/
+void KvServer::fillReadModifyWriteReply(WaitingRequest *request, const std::string *err, int status, int64_t result) {
+  std::string current;
+  bool exist = false;
+  if (err == nullptr && status == RmwFailed) {
+    ExecuteGetOpOnKVDB(request->op, &current, &exist);
+  }
 
-  m_mtx.lock();
+  switch (request->kind) {
+    case WaitingRequest::CompareAndSwapRequest: {
+      auto *reply = static_cast<raftKVRpcProctoc::CompareAndSwapReply *>(request->reply);
+      reply->set_err(err != nullptr ? *err : OK);
+      reply->set_succeeded(err == nullptr && status == RmwOk);
+      reply->set_exists(exist);
+      reply->set_current(std::move(current));
+      break;
+    }
+    case WaitingRequest::IncrementRequest: {
+      auto *reply = static_cast<raftKVRpcProctoc::IncrementReply *>(request->reply);
+      reply->set_err(err != nullptr ? *err : (status == RmwOk ? OK : ErrNotInteger));
+      reply->set_value(result);
+      break;
+    }
+    case WaitingRequest::PutIfAbsentRequest: {
+      auto *reply = static_cast<raftKVRpcProctoc::PutIfAbsentReply *>(request->reply);
+      reply->set_err(err != nullptr ? *err : OK);
+      reply->set_succeeded(err == nullptr && status == RmwOk);
+      reply->set_current(std::move(current));
+      break;
+    }
+    case WaitingRequest::DeleteRequest: {
+      auto *reply = static_cast<raftKVRpcProctoc::DeleteReply *>(request->reply);
+      reply->set_err(err != nullptr ? *err : OK);
+      reply->set_deleted(err == nullptr && status == RmwOk);
+      break;
+    }
+    default:
+      break;
+  }
+}
 
-  auto tmp = waitApplyCh[raftIndex];
-  waitApplyCh.erase(raftIndex);
-  delete tmp;
-  m_mtx.unlock();
+/*
+replyWaitingRequest 函数
+主要功能：reply已经填好，归还请求对象并调用done->Run()把结果发给客户端
+*/
+void KvServer::replyWaitingRequest(WaitingRequest *request) {
+  google::protobuf::Closure *done = request->done;
+  request->reply = nullptr;
+  request->done = nullptr;
+  m_waitingRequests.Release(request);   // 先归还对象，再回复客户端
+  done->Run();
 }
 
 /*
@@ -279,34 +1617,53 @@ ReadRaftApplyCommandLoop 函数
 主要功能：实现了一个循环，监听并处理 Raft 协议应用的命令和快照，根据消息的类型进行处理
 */
 void KvServer::ReadRaftApplyCommandLoop() {
+  auto lastSweepTime = std::chrono::steady_clock::now();
+  std::vector<ApplyMsg> messages;   // 每批取出的消息，循环复用
   while (true) {
-    //如果只操作applyChan不用拿锁，因为applyChan自己带锁
-    auto message = applyChan->Pop();  // 弹出队头消息
-    DPrintf(
-        "---------------tmp-------------[func-KvServer::ReadRaftApplyCommandLoop()-kvserver{%d}] 收到了raft的消息",
-        m_me);
-    
-    // 根据是命令还是快照具体执行
-    if (message.CommandValid) {
-      GetCommandFromRaft(message);
+    // 定期检查等待的请求是否超时，超时的请求也由本线程回复
+    if (std::chrono::steady_clock::now() - lastSweepTime >= std::chrono::milliseconds(WAITING_SWEEP_INTERVAL)) {
+      TimeoutWaitingRequests();
+      lastSweepTime = std::chrono::steady_clock::now();
     }
-    if (message.SnapshotValid) {
-      GetSnapShotFromRaft(message);
+
+    // applyChan是无锁队列，没有消息时阻塞在它的eventfd上，raft写入后立即唤醒
+    // 一次取出队列中当前所有的消息，整批交给 Apply；没有消息时也要定期醒来检查超时
+    if (!applyChan->timeOutPopAll(WAITING_SWEEP_INTERVAL, &messages)) {
+      continue;
     }
+    DPrintf(
+        "---------------tmp-------------[func-KvServer::ReadRaftApplyCommandLoop()-kvserver{%d}] 收到了raft的%d条消息",
+        m_me, (int)messages.size());
+
+    Apply(messages);
   }
 }
 
 /*
 GetSnapShotFromRaft 函数
-主要功能：从 Raft 协议接收快照并处理，将快照中的数据恢复到本地状态中
+主要功能：从 Raft 协议接收快照并处理，将快照中的数据恢复到本地状态中（单条，等价于只有一条消息的 Apply）
 */
-void KvServer::GetSnapShotFromRaft(ApplyMsg message) {
-  std::lock_guard<std::mutex> lg(m_mtx);
+void KvServer::GetSnapShotFromRaft(const ApplyMsg &message) {
+  ApplyMsg copy = message;
+  Apply(std::span<ApplyMsg>(&copy, 1));
+}
 
-  if (m_raftNode->CondInstallSnapshot(message.SnapshotTerm, message.SnapshotIndex, message.Snapshot)) { // 将消息中的快照相关信息传递给 Raft 节点进行条件检查
+/*
+installSnapshotLocked 函数
+主要功能：安装raft发来的快照
+注意：调用者需独占 m_storeMtx
+*/
+bool KvServer::installSnapshotLocked(const ApplyMsg &message) {
+  if (!m_raftNode->CondInstallSnapshot(message.SnapshotTerm, message.SnapshotIndex, message.Snapshot)) { // 将消息中的快照相关信息传递给 Raft 节点进行条件检查
+    return false;
+  }
+  {
+    std::lock_guard<std::mutex> lg(m_sessionMtx);   // 快照中还包含去重表
     ReadSnapShotToInstall(message.Snapshot);  // 安装快照
-    m_lastSnapShotRaftLogIndex = message.SnapshotIndex;
   }
+  m_lastSnapShotRaftLogIndex = message.SnapshotIndex;
+  m_waitingRequests.MarkApplied(message.SnapshotIndex);
+  return true;
 }
 
 
@@ -314,7 +1671,7 @@ void KvServer::GetSnapShotFromRaft(ApplyMsg message) {
 ReadSnapShotToInstall 函数
 主要功能：将快照的状态信息恢复到当前 KvServer 实例中
 */
-void KvServer::ReadSnapShotToInstall(std::string snapshot) {
+void KvServer::ReadSnapShotToInstall(const std::string &snapshot) {
   if (snapshot.empty()) {
     return;
   }
@@ -324,37 +1681,77 @@ void KvServer::ReadSnapShotToInstall(std::string snapshot) {
 
 
 /*
-SendMessageToWaitChan 函数
-主要功能：将 Raft 节点中提交的操作（Op 对象）发送到等待队列waitApplyCh中，以便让kvserver去执行具体的操作
+TimeoutWaitingRequests 函数
+主要功能：找出所有超过 CONSENSUS_TIMEOUT 仍未apply的请求，按超时处理
 */
-bool KvServer::SendMessageToWaitChan(const Op &op, int raftIndex) {
-  std::lock_guard<std::mutex> lg(m_mtx);
-  DPrintf(
-      "[RaftApplyMessageSendToWaitChan--> raftserver{%d}] , Send Command --> Index:{%d} , ClientId {%d}, RequestId "
-      "{%d}, Opreation {%v}, Key :{%v}, Value :{%v}",
-      m_me, raftIndex, &op.ClientId, op.RequestId, &op.Operation, &op.Key, &op.Value);
-  
-  // 检查日志条目索引对应的等待队列是否存在
-  if (waitApplyCh.find(raftIndex) == waitApplyCh.end()) {
-    return false;
+void KvServer::TimeoutWaitingRequests() {
+  std::vector<WaitingRequest *> expired;
+  m_waitingRequests.CollectExpired(std::chrono::steady_clock::now(), &expired);
+  for (auto *request : expired) {
+    finishWaitingRequest(request, nullptr);
   }
 
-  waitApplyCh[raftIndex]->Push(op);   // 向等待队列waitApplyCh添加元素
-  DPrintf(
-      "[RaftApplyMessageSendToWaitChan--> raftserver{%d}] , Send Command --> Index:{%d} , ClientId {%d}, RequestId "
-      "{%d}, Opreation {%v}, Key :{%v}, Value :{%v}",
-      m_me, raftIndex, &op.ClientId, op.RequestId, &op.Operation, &op.Key, &op.Value);
-  return true;
+  std::vector<google::protobuf::Closure *> watchers;    // 长轮询超时的 Watch 请求回复空结果
+  m_watchHub.ExpireWatchers(std::chrono::steady_clock::now(), &watchers);
+  for (auto *done : watchers) {
+    done->Run();
+  }
+}
+
+/*
+ProposeExpiredKeys 函数
+主要功能：由读线程池的定时器每隔 TTL_SCAN_INTERVAL 调用，只有Leader工作：
+        从过期索引头部取出最多 TTL_DELETE_BATCH 个已经过期的键，作为一条 ExpireKeys 命令提交给raft
+注意：
+    删除必须经过日志，各副本才会在同一位置删除同一批键；上一条命令还没apply时不重复提交，
+    超过 CONSENSUS_TIMEOUT 仍没有apply（例如Leader切换导致日志被覆盖）才重新提交
+*/
+void KvServer::ProposeExpiredKeys() {
+  int _ = -1;
+  bool isLeader = false;
+  m_raftNode->GetState(&_, &isLeader);
+  if (!isLeader) {
+    return;
+  }
+  if (m_expireProposalIndex.load() != -1 && std::chrono::steady_clock::now() < m_expireProposalDeadline) {
+    return;
+  }
+
+  Op op;
+  op.Operation = "ExpireKeys";
+  op.Timestamp = leaderTimestamp();
+  {
+    std::shared_lock<std::shared_mutex> lg(m_storeMtx);
+    for (const auto &partition : m_partitions) {
+      for (auto it = partition->expireIndex.begin(); it != partition->expireIndex.end() &&
+           it->first <= op.Timestamp && op.Keys.size() < TTL_DELETE_BATCH; ++it) {
+        op.Keys.push_back(it->second);
+      }
+    }
+  }
+  if (op.Keys.empty()) {
+    return;
+  }
+
+  int raftIndex = -1;
+  m_raftNode->Start(op, &raftIndex, &_, &isLeader);
+  if (isLeader) {
+    m_expireProposalDeadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(CONSENSUS_TIMEOUT);
+    m_expireProposalIndex.store(raftIndex);
+  }
 }
 
 /*
 IfNeedToSendSnapShotCommand 函数
 主要功能：检查是否需要制作快照，需要的话就向raft发送命令
+注意：是否快照由 m_snapshotScheduler 决定，它会随机化触发点并按时间窗口错开各副本的快照时机
 */
-void KvServer::IfNeedToSendSnapShotCommand(int raftIndex, int proportion) {
-  if (m_raftNode->GetRaftStateSize() > m_maxRaftState / 10.0) {   // raft节点的状态大小超过了阈值，需要制作快照
+void KvServer::IfNeedToSendSnapShotCommand(int raftIndex) {
+  if (m_snapshotScheduler->ShouldSnapshot(m_raftNode->GetRaftStateSize())) {   // 调度器认为需要在这里制作快照
+    auto start = std::chrono::steady_clock::now();
     auto snapshot = MakeSnapShot();   // 制作快照
     m_raftNode->Snapshot(raftIndex, snapshot);     // 让raft节点根据快照信息更新节点的日志条目
+    m_snapshotScheduler->OnSnapshotDone(m_raftNode->GetRaftStateSize(), std::chrono::steady_clock::now() - start);
   }
 }
 
@@ -363,7 +1760,9 @@ MakeSnapShot 函数
 主要功能：将当前的跳表数据制作为快照（字符串）并返回
 */
 std::string KvServer::MakeSnapShot() {
-  std::lock_guard<std::mutex> lg(m_mtx);
+  // 只读取状态，对存储只加共享锁，制作快照期间读请求不会被阻塞
+  std::shared_lock<std::shared_mutex> storeLock(m_storeMtx);
+  std::lock_guard<std::mutex> sessionLock(m_sessionMtx);
   std::string snapshotData = getSnapshotData();
   return snapshotData;
 }
@@ -371,27 +1770,84 @@ std::string KvServer::MakeSnapShot() {
 /*-------------------------------------重写的RPC方法------------------------------------------*/
 void KvServer::PutAppend(google::protobuf::RpcController *controller, const ::raftKVRpcProctoc::PutAppendArgs *request,
                          ::raftKVRpcProctoc::PutAppendReply *response, ::google::protobuf::Closure *done) {
-  KvServer::PutAppend(request, response);   // 直接调用，类函数中对应的方法
-  done->Run();  // 执行回调函数
+  KvServer::PutAppend(request, response, done);   // 直接调用，类函数中对应的方法，done由它在完成时调用
 }
 
 void KvServer::Get(google::protobuf::RpcController *controller, const ::raftKVRpcProctoc::GetArgs *request,
                    ::raftKVRpcProctoc::GetReply *response, ::google::protobuf::Closure *done) {
-  KvServer::Get(request, response);
-  done->Run();
+  KvServer::Get(request, response, done);
+}
+
+void KvServer::MultiGet(google::protobuf::RpcController *controller, const ::raftKVRpcProctoc::MultiGetArgs *request,
+                        ::raftKVRpcProctoc::MultiGetReply *response, ::google::protobuf::Closure *done) {
+  KvServer::MultiGet(request, response, done);
+}
+
+void KvServer::MultiPut(google::protobuf::RpcController *controller, const ::raftKVRpcProctoc::MultiPutArgs *request,
+                        ::raftKVRpcProctoc::MultiPutReply *response, ::google::protobuf::Closure *done) {
+  KvServer::MultiPut(request, response, done);
+}
+
+void KvServer::RegisterSession(google::protobuf::RpcController *controller,
+                               const ::raftKVRpcProctoc::RegisterSessionArgs * /*request*/,
+                               ::raftKVRpcProctoc::RegisterSessionReply *response, ::google::protobuf::Closure *done) {
+  KvServer::RegisterSession(response, done);
+}
+
+void KvServer::Scan(google::protobuf::RpcController *controller, const ::raftKVRpcProctoc::ScanArgs *request,
+                    ::raftKVRpcProctoc::ScanReply *response, ::google::protobuf::Closure *done) {
+  KvServer::Scan(request, response, done);
+}
+
+void KvServer::CompareAndSwap(google::protobuf::RpcController *controller,
+                              const ::raftKVRpcProctoc::CompareAndSwapArgs *request,
+                              ::raftKVRpcProctoc::CompareAndSwapReply *response, ::google::protobuf::Closure *done) {
+  KvServer::CompareAndSwap(request, response, done);
+}
+
+void KvServer::Increment(google::protobuf::RpcController *controller, const ::raftKVRpcProctoc::IncrementArgs *request,
+                         ::raftKVRpcProctoc::IncrementReply *response, ::google::protobuf::Closure *done) {
+  KvServer::Increment(request, response, done);
+}
+
+void KvServer::PutIfAbsent(google::protobuf::RpcController *controller,
+                           const ::raftKVRpcProctoc::PutIfAbsentArgs *request,
+                           ::raftKVRpcProctoc::PutIfAbsentReply *response, ::google::protobuf::Closure *done) {
+  KvServer::PutIfAbsent(request, response, done);
+}
+
+void KvServer::Txn(google::protobuf::RpcController *controller, const ::raftKVRpcProctoc::TxnArgs *request,
+                   ::raftKVRpcProctoc::TxnReply *response, ::google::protobuf::Closure *done) {
+  KvServer::Txn(request, response, done);
+}
+
+void KvServer::Delete(google::protobuf::RpcController *controller, const ::raftKVRpcProctoc::DeleteArgs *request,
+                      ::raftKVRpcProctoc::DeleteReply *response, ::google::protobuf::Closure *done) {
+  KvServer::Delete(request, response, done);
+}
+
+void KvServer::Watch(google::protobuf::RpcController *controller, const ::raftKVRpcProctoc::WatchArgs *request,
+                     ::raftKVRpcProctoc::WatchReply *response, ::google::protobuf::Closure *done) {
+  KvServer::Watch(request, response, done);
 }
 
 
 /*----------------------------------构造函数----------------------------------------------------*/
-KvServer::KvServer(int me, int maxraftstate, std::string nodeInforFileName, short port):
-                  m_skipList(6) {   // 初始化跳表，最高层级是6
+KvServer::KvServer(int me, int maxraftstate, std::string nodeInforFileName, short port) {
   
   // 1. 初始化成员变量
   std::shared_ptr<Persister> persister = std::make_shared<Persister>(me);   // 初始化持久化对象
   // raft节点ID和节点存储最大值
   m_me = me;
   m_maxRaftState = maxraftstate;
-  applyChan = std::make_shared<LockQueue<ApplyMsg> >();    // 初始化用于kvserver与raft节点通信的消息队列
+  applyChan = std::make_shared<ApplyChannel>();    // 初始化用于kvserver与raft节点通信的消息队列
+  m_readPool = std::make_unique<monsoon::IOManager>(KV_READ_THREAD_NUM, false, "kvRead");   // 执行读请求的线程池
+  m_applyPool = std::make_unique<monsoon::IOManager>(KV_APPLY_THREAD_NUM, false, "kvApply");   // 并行apply各分区的线程池
+  ReadCachePolicy readCachePolicy;    // 热点键读缓存，配置文件中没有配置容量时关闭
+  readCachePolicy.LoadFromConfig(nodeInforFileName);
+  m_readCache = std::make_unique<HotKeyCache>(readCachePolicy);
+  m_storagePolicy.LoadFromConfig(nodeInforFileName);    // 存储引擎，默认使用跳表
+  resetPartitions();    // 按键的哈希划分存储分区
   m_raftNode = std::make_shared<Raft>();    // 本kvserver所对应的raft节点
 
 
@@ -424,6 +1880,12 @@ KvServer::KvServer(int me, int maxraftstate, std::string nodeInforFileName, shor
     ipPortVt.emplace_back(nodeIp, atoi(nodePortStr.c_str()));
   }
 
+  // 根据节点数量初始化快照调度器，配置文件中的快照策略项会覆盖默认值
+  SnapshotPolicy snapshotPolicy;
+  snapshotPolicy.LoadFromConfig(nodeInforFileName);
+  m_snapshotScheduler = std::make_unique<SnapshotScheduler>(m_me, ipPortVt.size(), m_maxRaftState);
+  m_snapshotScheduler->SetPolicy(snapshotPolicy);
+
   // 5. 连接其他Raft节点
   std::vector<std::shared_ptr<RaftRpcUtil>> servers;    // 存储此raft节点与其他raft节点的通信对象
   for (int i = 0; i < ipPortVt.size(); ++i) {
@@ -444,16 +1906,19 @@ KvServer::KvServer(int me, int maxraftstate, std::string nodeInforFileName, shor
   m_raftNode->init(servers, m_me, persister, applyChan);
 
   // 7. 检查是否存在快照进行恢复
-  m_skipList;
-  waitApplyCh;
-  m_lastRequestId;
   m_lastSnapShotRaftLogIndex = 0;
   auto snapshot = persister->ReadSnapshot();
   if (!snapshot.empty()) {    // 快照不为空
     ReadSnapShotToInstall(snapshot);
   }
 
-  // 8. 启动应用命令线程，持续运行处理Raft应用命令
+  // 8. 定期检查过期的键，只有Leader会真正提交删除命令
+  m_readPool->addTimer(TTL_SCAN_INTERVAL, [this]() -> void { ProposeExpiredKeys(); }, true);
+  if (m_readCache->Enabled()) {   // 定期输出读缓存的命中率
+    m_readPool->addTimer(READ_CACHE_REPORT_INTERVAL, [this]() -> void { DprintfReadCache(); }, true);
+  }
+
+  // 9. 启动应用命令线程，持续运行处理Raft应用命令
   std::thread t2(&KvServer::ReadRaftApplyCommandLoop, this);
   t2.join();    // 通过 t2.join() 达到阻塞效果，确保 ReadRaftApplyCommandLoop 线程一直运行，不会被主线程提前结束
 }
\ No newline at end of file
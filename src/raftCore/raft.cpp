@@ -91,20 +91,20 @@ void Raft::AppendEntries1(const raftRpcProctoc::AppendEntriesArgs* args, raftRpc
     for (int i = 0; i < args->entries_size(); i++) {
       auto log = args->entries(i);  // 遍历取出日志条目
       if (log.logindex() > getLastLogIndex()) {   //  超过follower中的最后一个日志，就直接添加日志
-        m_logs.push_back(log);
+        m_logs.push_back(std::make_shared<const raftRpcProctoc::LogEntry>(std::move(log)));
       } else {
          // 没超过就说明follower已经有这些新日志了，比较是否匹配，不匹配再更新，而不是直接截断(直接截断有可能会造成丢失)
-         if (m_logs[getSlicesIndexFromLogIndex(log.logindex())].logterm() == log.logterm() &&
-             m_logs[getSlicesIndexFromLogIndex(log.logindex())].command() != log.command()) {
+         if (m_logs[getSlicesIndexFromLogIndex(log.logindex())]->logterm() == log.logterm() &&
+             m_logs[getSlicesIndexFromLogIndex(log.logindex())]->command() != log.command()) {
           // term和index相等，则两个日志应该也相等（raft基本性质），这里却不符合，出现异常
           myAssert(false, format("[func-AppendEntries-rf{%d}] 两节点logIndex{%d}和term{%d}相同，但是其command{%d:%d}   "
                                  " {%d:%d}却不同！！\n",
                                  m_me, log.logindex(), log.logterm(), m_me,
-                                 m_logs[getSlicesIndexFromLogIndex(log.logindex())].command(), args->leaderid(),
+                                 m_logs[getSlicesIndexFromLogIndex(log.logindex())]->command(), args->leaderid(),
                                  log.command()));
          }
-         if (m_logs[getSlicesIndexFromLogIndex(log.logindex())].logterm() != log.logterm()) { // term不匹配
-            m_logs[getSlicesIndexFromLogIndex(log.logindex())] = log;  // 相同的索引位置上发现日志条目的任期不同，意味着日志存在不一致（这个来自于旧的领导者，替换为新的）
+         if (m_logs[getSlicesIndexFromLogIndex(log.logindex())]->logterm() != log.logterm()) { // term不匹配
+            m_logs[getSlicesIndexFromLogIndex(log.logindex())] = std::make_shared<const raftRpcProctoc::LogEntry>(std::move(log));  // 相同的索引位置上发现日志条目的任期不同，意味着日志存在不一致（这个来自于旧的领导者，替换为新的）
          }
       }
     }
@@ -117,6 +117,7 @@ void Raft::AppendEntries1(const raftRpcProctoc::AppendEntriesArgs* args, raftRpc
     // 更新提交索引，领导者的提交索引（args->leadercommit()落后于getLastLogIndex()的情况），或者是当前日志的最后一个索引（follower日志还没更新完全）
     if (args->leadercommit() > m_commitIndex) {
       m_commitIndex = std::min(args->leadercommit(), getLastLogIndex());
+      m_applyCond.notify_one();   // 提交索引前进了，唤醒applier
     }
 
     // l确保follower最后一个日志索引不小于follower提交索引
@@ -196,13 +197,13 @@ void Raft::doHeartBeat() {
         // 前一个日志条目在快照之外，应该从该索引之后开始发送日志条目
         for (int j = getSlicesIndexFromLogIndex(preLogIndex) + 1; j < m_logs.size(); ++j) {
           raftRpcProctoc::LogEntry* sendEntryPtr = appendEntriesArgs->add_entries();  // 返回一个指向新添加的日志条目的指针
-          *sendEntryPtr = m_logs[j];  // 将该指针指向日志条目，则完成这个条目的添加    
+          *sendEntryPtr = *m_logs[j];  // 将该指针指向日志条目，则完成这个条目的添加    
         }
       } else {  // 即 preLogIndex == m_lastSnapshotIncludeIndex
         // 前一个日志条目正好是快照的分界点，那可以把Leader的所以日志条目都加入
         for (const auto& item: m_logs) {
           raftRpcProctoc::LogEntry* sendEntryPtr = appendEntriesArgs->add_entries();
-          *sendEntryPtr = item; // =是可以点进去的，可以点进去看下protobuf如何重写这个赋值运算符的，实现直接将一个 protobuf 消息对象赋值给另一个消息对象
+          *sendEntryPtr = *item; // =是可以点进去的，可以点进去看下protobuf如何重写这个赋值运算符的，实现直接将一个 protobuf 消息对象赋值给另一个消息对象
         }
       }
 
@@ -365,6 +366,7 @@ bool Raft::sendAppendEntries(int server, std::shared_ptr<raftRpcProctoc::AppendE
             "from{%d} to{%d}",
             m_commitIndex, args->prevlogindex() + args->entries_size());
         m_commitIndex = std::max(m_commitIndex, args->prevlogindex() + args->entries_size());    // 更新leader的提交索引m_commitIndex
+        m_applyCond.notify_one();   // 唤醒applier，新提交的日志立即交给kv server
       }
 
       // 检查，提交索引不应该超过最新的日志索引
@@ -511,7 +513,7 @@ pushMsgToKvServer 函数
 主要功能：将消息应用到kv数据库中，在这里的实现是将其加入到一个队列，后续由其他方法管理
 */
 void Raft::pushMsgToKvServer(ApplyMsg msg) { 
-  applyChan->Push(msg);   // 将应用消息加入到一个线程安全的队列中
+  applyChan->Push(std::move(msg));   // 将应用消息加入到一个线程安全的队列中
 }  
 
 
@@ -773,32 +775,34 @@ bool Raft::UpToDate(int index, int term) {
 /*** ---------------------------------------------提交日志，向状态机应用---------------------------------------------------- ***/
 
 /*
-applierTicker：定时器功能，raft向状态机定时写入
-主要作用：通过定期检查是否有新的日志需要应用，并将这些日志条目应用到状态机上（即 kvserver）
+applierTicker：raft向状态机写入已提交的日志
+主要作用：等待提交索引前进（由 AppendEntries1 和 sendAppendEntries 通过 m_applyCond 通知），然后把新提交的日志条目应用到状态机上（即 kvserver）
+注意：
+    原来每 10 毫秒醒来一次检查，空闲时也要不停地加锁，每条写请求还要额外承受0~10ms的apply延迟；
+    现在没有新的提交时一直阻塞在条件变量上，提交后立即被唤醒
 */
 void Raft::applierTicker() {
+  std::unique_lock<std::mutex> lock(m_mtx);
   while (true) {    // 在一个无限循环中运行，使其能够持续地检查和应用日志条目。
-    m_mtx.lock();
+    m_applyCond.wait(lock, [this]() { return m_lastApplied < m_commitIndex; });   // 等待有新的已提交日志
+
     if (m_status == Leader) {
       DPrintf("[Raft::applierTicker() - raft{%d}]  m_lastApplied{%d}   m_commitIndex{%d}", m_me, m_lastApplied,
               m_commitIndex);
     }
 
-    // 获取要应用的日志条目
+    // 获取要应用的日志条目，命令只共享引用，不拷贝
     auto applyMsgs = getApplyLogs();
-    m_mtx.unlock();   // 可以解锁，因为下面applyChan是个线程安全的，早点解锁要保证并发性能
+    lock.unlock();   // 可以解锁，因为下面applyChan是个线程安全的，早点解锁要保证并发性能
 
     // 检查并处理应用日志条目
     if (!applyMsgs.empty()) {
       DPrintf("[func- Raft::applierTicker()-raft{%d}] 向kvserver报告的applyMsgs长度为：{%d}", m_me, applyMsgs.size());
+      // 整批写入通道，只占用一次写位置、只唤醒一次kv server
+      applyChan->PushBatch(applyMsgs);
     }
 
-    // 循环将所有应用消息应用到状态机上
-    for (auto& message: applyMsgs) {
-      applyChan->Push(message);   // 这是个线程安全的队列
-    }
-
-    sleepNMilliseconds(ApplyInterval);   // 睡眠一段时间，再检测
+    lock.lock();
   }
 }
 
@@ -816,19 +820,22 @@ std::vector<ApplyMsg> Raft::getApplyLogs() {
   while (m_lastApplied < m_commitIndex) {
     m_lastApplied++;
     // 确保日志条目的索引与 m_lastApplied 一致。
-    myAssert(m_logs[getSlicesIndexFromLogIndex(m_lastApplied)].logindex() == m_lastApplied,
+    myAssert(m_logs[getSlicesIndexFromLogIndex(m_lastApplied)]->logindex() == m_lastApplied,
              format("rf.logs[rf.getSlicesIndexFromLogIndex(rf.lastApplied)].LogIndex{%d} != rf.lastApplied{%d} ",
-                    m_logs[getSlicesIndexFromLogIndex(m_lastApplied)].logindex(), m_lastApplied));
+                    m_logs[getSlicesIndexFromLogIndex(m_lastApplied)]->logindex(), m_lastApplied));
 
     // 构造该日志的应用消息对象并初始化
     ApplyMsg applyMsg;   
     applyMsg.CommandValid = true;     // 表示是有效的日志命令，而不是快照
     applyMsg.SnapshotValid = false;   // 表示不是快照
-    applyMsg.Command = m_logs[getSlicesIndexFromLogIndex(m_lastApplied)].command();   // 该消息的命令就是日志条目的命令
+    // 该消息的命令就是日志条目的命令。日志条目是不可变的共享对象，这里只是共享它的命令字段（增加引用计数），不拷贝命令数据
+    // 即使之后日志因为快照被截断，这个条目也会一直存活到kv server用完为止
+    const LogEntryPtr &entry = m_logs[getSlicesIndexFromLogIndex(m_lastApplied)];
+    applyMsg.Command = SharedBuffer(std::shared_ptr<const std::string>(entry, &entry->command()));
     applyMsg.CommandIndex = m_lastApplied;    // 日志条目的索引
 
     // 加入到数组中
-    applyMsgs.emplace_back(applyMsg);
+    applyMsgs.emplace_back(std::move(applyMsg));
   }
 
   return applyMsgs;
@@ -872,7 +879,7 @@ std::string Raft::persistData() {
 
   // 将日志条目序列化并保存到对象中
   for (auto& item : m_logs) {
-    boostPersistRaftNode.m_logs.push_back(item.SerializeAsString());
+    boostPersistRaftNode.m_logs.push_back(item->SerializeAsString());
   }
 
   // 使用 stringstream 和 Boost 序列化库将对象序列化为字符串
@@ -911,9 +918,9 @@ void Raft::readPersist(std::string data) {
   // 恢复日志列表
   m_logs.clear();
   for (auto& item : boostPersistRaftNode.m_logs) {
-    raftRpcProctoc::LogEntry logEntry;
-    logEntry.ParseFromString(item);   // item被序列化成了字符串，再解析回来
-    m_logs.emplace_back(logEntry);
+    auto logEntry = std::make_shared<raftRpcProctoc::LogEntry>();
+    logEntry->ParseFromString(item);   // item被序列化成了字符串，再解析回来
+    m_logs.emplace_back(std::move(logEntry));
   }
 }
 
@@ -942,9 +949,9 @@ void Raft::Snapshot(int index, std::string snapshot) {
 
   // 创建新的快照所包含的索引和term
   int newLastSnapshotIncludeIndex = index;
-  int newLastSnapshotIncludeTerm = m_logs[getSlicesIndexFromLogIndex(index)].logterm();
+  int newLastSnapshotIncludeTerm = m_logs[getSlicesIndexFromLogIndex(index)]->logterm();
   
-  std::vector<raftRpcProctoc::LogEntry> trunckedLogs;   // 日志向量，保存快照后面剩余的日志（分界点以后的，没有被创建为快照）
+  std::vector<LogEntryPtr> trunckedLogs;   // 日志向量，保存快照后面剩余的日志（分界点以后的，没有被创建为快照）
   for (int i = index + 1; i <= getLastLogIndex(); i++) {
     trunckedLogs.push_back(m_logs[getSlicesIndexFromLogIndex(i)]);
   }
@@ -954,7 +961,7 @@ void Raft::Snapshot(int index, std::string snapshot) {
   m_lastSnapshotIncludeTerm = newLastSnapshotIncludeTerm;
 
   // 删除被创建快照的日志，替换为剩下的
-  m_logs = trunckedLogs;
+  m_logs = std::move(trunckedLogs);
 
   // 更新提交索引和应用索引
   m_commitIndex = std::max(m_commitIndex, index);
@@ -984,7 +991,7 @@ init 初始化函数
           本函数必须快速返回，因此它应该为任何长时间运行的工作启动 goroutines。
 */
 void Raft::init(std::vector<std::shared_ptr<RaftRpcUtil>> peers, int me, std::shared_ptr<Persister> persister, 
-                std::shared_ptr<LockQueue<ApplyMsg>> applyCh) {
+                std::shared_ptr<ApplyChannel> applyCh) {
   m_peers = peers;
   m_persister = persister;
   m_me = me;
@@ -1046,7 +1053,15 @@ start 函数
     int* newLogTerm: 输出参数，表示新日志条目的任期。
     bool* isLeader: 输出参数，表示当前节点是否为领导者。
 */
-void Raft::Start(Op command, int* newLogIndex, int* newLogTerm, bool* isLeader) {
+void Raft::Start(const Op& command, int* newLogIndex, int* newLogTerm, bool* isLeader) {
+  Start(command.asString(), newLogIndex, newLogTerm, isLeader);
+}
+
+/*
+start 函数（已编码命令的版本）
+主要功能：同上，command 是已经编码好的命令，按值传入后直接移动进日志条目，调用者传右值时全程不拷贝
+*/
+void Raft::Start(std::string command, int* newLogIndex, int* newLogTerm, bool* isLeader) {
   std::lock_guard<std::mutex> lg1(m_mtx);  // 加锁
 
   // 判断节点是否为Leader，只有Leader才会接收客户端的命令
@@ -1060,20 +1075,20 @@ void Raft::Start(Op command, int* newLogIndex, int* newLogTerm, bool* isLeader)
 
   // 根据命令创建新的日志条目
   raftRpcProctoc::LogEntry newLogEntry;
-  newLogEntry.set_command(command.asString());    // 命令
+  newLogEntry.set_command(std::move(command));    // 命令，移动而不是拷贝
   newLogEntry.set_logterm(m_currentTerm);     // term
   newLogEntry.set_logindex(getNewCommandIndex());    // index
+  *newLogIndex = newLogEntry.logindex();
+  *newLogTerm = newLogEntry.logterm();
 
-  m_logs.emplace_back(newLogEntry);  // 加入到日志条目数组中
+  m_logs.emplace_back(std::make_shared<const raftRpcProctoc::LogEntry>(std::move(newLogEntry)));  // 加入到日志条目数组中
 
   int lastLogIndex = getLastLogIndex();   // 最新的日志index
 
   // leader应该不停的向各个Follower发送AE来维护心跳和保持日志同步，目前的做法是新的命令来了不会直接执行，而是等待leader的心跳触发
-  DPrintf("[func-Start-rf{%d}]  lastLogIndex:%d,command:%s\n", m_me, lastLogIndex, &command);
+  DPrintf("[func-Start-rf{%d}]  lastLogIndex:%d\n", m_me, lastLogIndex);
 
   persist();
-  *newLogIndex = newLogEntry.logindex();
-  *newLogTerm = newLogEntry.logterm();
   *isLeader = true;
 }
 
@@ -1091,8 +1106,8 @@ void Raft::getLastLogIndexAndTerm(int* lastLogIndex, int* lastLogTerm) {
     *lastLogTerm = m_lastSnapshotIncludeTerm;
     return;
   } else {  // 否则，就找日志中最后面的
-    *lastLogIndex = m_logs[m_logs.size() - 1].logindex();
-    *lastLogTerm = m_logs[m_logs.size() - 1].logterm();
+    *lastLogIndex = m_logs[m_logs.size() - 1]->logindex();
+    *lastLogTerm = m_logs[m_logs.size() - 1]->logterm();
     return;
   }
 }
@@ -1143,7 +1158,7 @@ void Raft::getPrevLogInfo(int server, int* preIndex, int* preTerm) {
 
   auto nextIndex = m_nextIndex[server];
   *preIndex = nextIndex - 1;
-  *preTerm = m_logs[getSlicesIndexFromLogIndex(*preIndex)].logterm();
+  *preTerm = m_logs[getSlicesIndexFromLogIndex(*preIndex)]->logterm();
 }
 
 /*
@@ -1209,7 +1224,7 @@ int Raft::getLogTermFromLogIndex(int logIndex) {
   if (logIndex == m_lastSnapshotIncludeIndex) {
     return m_lastSnapshotIncludeTerm;
   } else {
-    return m_logs[getSlicesIndexFromLogIndex(logIndex)].logterm();
+    return m_logs[getSlicesIndexFromLogIndex(logIndex)]->logterm();
   }
 }
 
@@ -8,12 +8,12 @@
 #include <string>
 
 #include <google/protobuf/port_def.inc>
-#if PROTOBUF_VERSION < 3012000
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3012004 < PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
@@ -23,14 +23,14 @@
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
-#include <google/protobuf/generated_message_table_driven.h>
+#include <google/protobuf/generated_message_bases.h>
 #include <google/protobuf/generated_message_util.h>
-#include <google/protobuf/inlined_string_field.h>
 #include <google/protobuf/metadata_lite.h>
 #include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/message.h>
 #include <google/protobuf/repeated_field.h>  // IWYU pragma: export
 #include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
 #include <google/protobuf/service.h>
 #include <google/protobuf/unknown_field_set.h>
 // @@protoc_insertion_point(includes)
@@ -44,46 +44,216 @@ PROTOBUF_NAMESPACE_CLOSE
 
 // Internal implementation detail -- do not use these members.
 struct TableStruct_kvServerRPC_2eproto {
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTableField entries[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::AuxillaryParseTableField aux[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[4]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
-  static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
-  static const ::PROTOBUF_NAMESPACE_ID::uint32 offsets[];
+  static const uint32_t offsets[];
 };
 extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_kvServerRPC_2eproto;
 namespace raftKVRpcProctoc {
+class CompareAndSwapArgs;
+struct CompareAndSwapArgsDefaultTypeInternal;
+extern CompareAndSwapArgsDefaultTypeInternal _CompareAndSwapArgs_default_instance_;
+class CompareAndSwapReply;
+struct CompareAndSwapReplyDefaultTypeInternal;
+extern CompareAndSwapReplyDefaultTypeInternal _CompareAndSwapReply_default_instance_;
+class DeleteArgs;
+struct DeleteArgsDefaultTypeInternal;
+extern DeleteArgsDefaultTypeInternal _DeleteArgs_default_instance_;
+class DeleteReply;
+struct DeleteReplyDefaultTypeInternal;
+extern DeleteReplyDefaultTypeInternal _DeleteReply_default_instance_;
 class GetArgs;
-class GetArgsDefaultTypeInternal;
+struct GetArgsDefaultTypeInternal;
 extern GetArgsDefaultTypeInternal _GetArgs_default_instance_;
 class GetReply;
-class GetReplyDefaultTypeInternal;
+struct GetReplyDefaultTypeInternal;
 extern GetReplyDefaultTypeInternal _GetReply_default_instance_;
+class IncrementArgs;
+struct IncrementArgsDefaultTypeInternal;
+extern IncrementArgsDefaultTypeInternal _IncrementArgs_default_instance_;
+class IncrementReply;
+struct IncrementReplyDefaultTypeInternal;
+extern IncrementReplyDefaultTypeInternal _IncrementReply_default_instance_;
+class MultiGetArgs;
+struct MultiGetArgsDefaultTypeInternal;
+extern MultiGetArgsDefaultTypeInternal _MultiGetArgs_default_instance_;
+class MultiGetReply;
+struct MultiGetReplyDefaultTypeInternal;
+extern MultiGetReplyDefaultTypeInternal _MultiGetReply_default_instance_;
+class MultiPutArgs;
+struct MultiPutArgsDefaultTypeInternal;
+extern MultiPutArgsDefaultTypeInternal _MultiPutArgs_default_instance_;
+class MultiPutReply;
+struct MultiPutReplyDefaultTypeInternal;
+extern MultiPutReplyDefaultTypeInternal _MultiPutReply_default_instance_;
 class PutAppendArgs;
-class PutAppendArgsDefaultTypeInternal;
+struct PutAppendArgsDefaultTypeInternal;
 extern PutAppendArgsDefaultTypeInternal _PutAppendArgs_default_instance_;
 class PutAppendReply;
-class PutAppendReplyDefaultTypeInternal;
+struct PutAppendReplyDefaultTypeInternal;
 extern PutAppendReplyDefaultTypeInternal _PutAppendReply_default_instance_;
+class PutIfAbsentArgs;
+struct PutIfAbsentArgsDefaultTypeInternal;
+extern PutIfAbsentArgsDefaultTypeInternal _PutIfAbsentArgs_default_instance_;
+class PutIfAbsentReply;
+struct PutIfAbsentReplyDefaultTypeInternal;
+extern PutIfAbsentReplyDefaultTypeInternal _PutIfAbsentReply_default_instance_;
+class RegisterSessionArgs;
+struct RegisterSessionArgsDefaultTypeInternal;
+extern RegisterSessionArgsDefaultTypeInternal _RegisterSessionArgs_default_instance_;
+class RegisterSessionReply;
+struct RegisterSessionReplyDefaultTypeInternal;
+extern RegisterSessionReplyDefaultTypeInternal _RegisterSessionReply_default_instance_;
+class ScanArgs;
+struct ScanArgsDefaultTypeInternal;
+extern ScanArgsDefaultTypeInternal _ScanArgs_default_instance_;
+class ScanReply;
+struct ScanReplyDefaultTypeInternal;
+extern ScanReplyDefaultTypeInternal _ScanReply_default_instance_;
+class TxnArgs;
+struct TxnArgsDefaultTypeInternal;
+extern TxnArgsDefaultTypeInternal _TxnArgs_default_instance_;
+class TxnCompare;
+struct TxnCompareDefaultTypeInternal;
+extern TxnCompareDefaultTypeInternal _TxnCompare_default_instance_;
+class TxnOp;
+struct TxnOpDefaultTypeInternal;
+extern TxnOpDefaultTypeInternal _TxnOp_default_instance_;
+class TxnReply;
+struct TxnReplyDefaultTypeInternal;
+extern TxnReplyDefaultTypeInternal _TxnReply_default_instance_;
+class TxnResult;
+struct TxnResultDefaultTypeInternal;
+extern TxnResultDefaultTypeInternal _TxnResult_default_instance_;
+class WatchArgs;
+struct WatchArgsDefaultTypeInternal;
+extern WatchArgsDefaultTypeInternal _WatchArgs_default_instance_;
+class WatchEvent;
+struct WatchEventDefaultTypeInternal;
+extern WatchEventDefaultTypeInternal _WatchEvent_default_instance_;
+class WatchReply;
+struct WatchReplyDefaultTypeInternal;
+extern WatchReplyDefaultTypeInternal _WatchReply_default_instance_;
 }  // namespace raftKVRpcProctoc
 PROTOBUF_NAMESPACE_OPEN
+template<> ::raftKVRpcProctoc::CompareAndSwapArgs* Arena::CreateMaybeMessage<::raftKVRpcProctoc::CompareAndSwapArgs>(Arena*);
+template<> ::raftKVRpcProctoc::CompareAndSwapReply* Arena::CreateMaybeMessage<::raftKVRpcProctoc::CompareAndSwapReply>(Arena*);
+template<> ::raftKVRpcProctoc::DeleteArgs* Arena::CreateMaybeMessage<::raftKVRpcProctoc::DeleteArgs>(Arena*);
+template<> ::raftKVRpcProctoc::DeleteReply* Arena::CreateMaybeMessage<::raftKVRpcProctoc::DeleteReply>(Arena*);
 template<> ::raftKVRpcProctoc::GetArgs* Arena::CreateMaybeMessage<::raftKVRpcProctoc::GetArgs>(Arena*);
 template<> ::raftKVRpcProctoc::GetReply* Arena::CreateMaybeMessage<::raftKVRpcProctoc::GetReply>(Arena*);
+template<> ::raftKVRpcProctoc::IncrementArgs* Arena::CreateMaybeMessage<::raftKVRpcProctoc::IncrementArgs>(Arena*);
+template<> ::raftKVRpcProctoc::IncrementReply* Arena::CreateMaybeMessage<::raftKVRpcProctoc::IncrementReply>(Arena*);
+template<> ::raftKVRpcProctoc::MultiGetArgs* Arena::CreateMaybeMessage<::raftKVRpcProctoc::MultiGetArgs>(Arena*);
+template<> ::raftKVRpcProctoc::MultiGetReply* Arena::CreateMaybeMessage<::raftKVRpcProctoc::MultiGetReply>(Arena*);
+template<> ::raftKVRpcProctoc::MultiPutArgs* Arena::CreateMaybeMessage<::raftKVRpcProctoc::MultiPutArgs>(Arena*);
+template<> ::raftKVRpcProctoc::MultiPutReply* Arena::CreateMaybeMessage<::raftKVRpcProctoc::MultiPutReply>(Arena*);
 template<> ::raftKVRpcProctoc::PutAppendArgs* Arena::CreateMaybeMessage<::raftKVRpcProctoc::PutAppendArgs>(Arena*);
 template<> ::raftKVRpcProctoc::PutAppendReply* Arena::CreateMaybeMessage<::raftKVRpcProctoc::PutAppendReply>(Arena*);
+template<> ::raftKVRpcProctoc::PutIfAbsentArgs* Arena::CreateMaybeMessage<::raftKVRpcProctoc::PutIfAbsentArgs>(Arena*);
+template<> ::raftKVRpcProctoc::PutIfAbsentReply* Arena::CreateMaybeMessage<::raftKVRpcProctoc::PutIfAbsentReply>(Arena*);
+template<> ::raftKVRpcProctoc::RegisterSessionArgs* Arena::CreateMaybeMessage<::raftKVRpcProctoc::RegisterSessionArgs>(Arena*);
+template<> ::raftKVRpcProctoc::RegisterSessionReply* Arena::CreateMaybeMessage<::raftKVRpcProctoc::RegisterSessionReply>(Arena*);
+template<> ::raftKVRpcProctoc::ScanArgs* Arena::CreateMaybeMessage<::raftKVRpcProctoc::ScanArgs>(Arena*);
+template<> ::raftKVRpcProctoc::ScanReply* Arena::CreateMaybeMessage<::raftKVRpcProctoc::ScanReply>(Arena*);
+template<> ::raftKVRpcProctoc::TxnArgs* Arena::CreateMaybeMessage<::raftKVRpcProctoc::TxnArgs>(Arena*);
+template<> ::raftKVRpcProctoc::TxnCompare* Arena::CreateMaybeMessage<::raftKVRpcProctoc::TxnCompare>(Arena*);
+template<> ::raftKVRpcProctoc::TxnOp* Arena::CreateMaybeMessage<::raftKVRpcProctoc::TxnOp>(Arena*);
+template<> ::raftKVRpcProctoc::TxnReply* Arena::CreateMaybeMessage<::raftKVRpcProctoc::TxnReply>(Arena*);
+template<> ::raftKVRpcProctoc::TxnResult* Arena::CreateMaybeMessage<::raftKVRpcProctoc::TxnResult>(Arena*);
+template<> ::raftKVRpcProctoc::WatchArgs* Arena::CreateMaybeMessage<::raftKVRpcProctoc::WatchArgs>(Arena*);
+template<> ::raftKVRpcProctoc::WatchEvent* Arena::CreateMaybeMessage<::raftKVRpcProctoc::WatchEvent>(Arena*);
+template<> ::raftKVRpcProctoc::WatchReply* Arena::CreateMaybeMessage<::raftKVRpcProctoc::WatchReply>(Arena*);
 PROTOBUF_NAMESPACE_CLOSE
 namespace raftKVRpcProctoc {
 
+enum WatchEvent_Type : int {
+  WatchEvent_Type_PUT = 0,
+  WatchEvent_Type_DELETE = 1,
+  WatchEvent_Type_APPEND = 2,
+  WatchEvent_Type_WatchEvent_Type_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  WatchEvent_Type_WatchEvent_Type_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool WatchEvent_Type_IsValid(int value);
+constexpr WatchEvent_Type WatchEvent_Type_Type_MIN = WatchEvent_Type_PUT;
+constexpr WatchEvent_Type WatchEvent_Type_Type_MAX = WatchEvent_Type_APPEND;
+constexpr int WatchEvent_Type_Type_ARRAYSIZE = WatchEvent_Type_Type_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* WatchEvent_Type_descriptor();
+template<typename T>
+inline const std::string& WatchEvent_Type_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, WatchEvent_Type>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function WatchEvent_Type_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    WatchEvent_Type_descriptor(), enum_t_value);
+}
+inline bool WatchEvent_Type_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, WatchEvent_Type* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<WatchEvent_Type>(
+    WatchEvent_Type_descriptor(), name, value);
+}
+enum TxnCompare_Result : int {
+  TxnCompare_Result_EQUAL = 0,
+  TxnCompare_Result_NOT_EQUAL = 1,
+  TxnCompare_Result_LESS = 2,
+  TxnCompare_Result_GREATER = 3,
+  TxnCompare_Result_EXISTS = 4,
+  TxnCompare_Result_NOT_EXISTS = 5,
+  TxnCompare_Result_TxnCompare_Result_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  TxnCompare_Result_TxnCompare_Result_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool TxnCompare_Result_IsValid(int value);
+constexpr TxnCompare_Result TxnCompare_Result_Result_MIN = TxnCompare_Result_EQUAL;
+constexpr TxnCompare_Result TxnCompare_Result_Result_MAX = TxnCompare_Result_NOT_EXISTS;
+constexpr int TxnCompare_Result_Result_ARRAYSIZE = TxnCompare_Result_Result_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* TxnCompare_Result_descriptor();
+template<typename T>
+inline const std::string& TxnCompare_Result_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, TxnCompare_Result>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function TxnCompare_Result_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    TxnCompare_Result_descriptor(), enum_t_value);
+}
+inline bool TxnCompare_Result_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, TxnCompare_Result* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<TxnCompare_Result>(
+    TxnCompare_Result_descriptor(), name, value);
+}
+enum TxnOp_Type : int {
+  TxnOp_Type_PUT = 0,
+  TxnOp_Type_DELETE = 1,
+  TxnOp_Type_GET = 2,
+  TxnOp_Type_TxnOp_Type_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  TxnOp_Type_TxnOp_Type_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool TxnOp_Type_IsValid(int value);
+constexpr TxnOp_Type TxnOp_Type_Type_MIN = TxnOp_Type_PUT;
+constexpr TxnOp_Type TxnOp_Type_Type_MAX = TxnOp_Type_GET;
+constexpr int TxnOp_Type_Type_ARRAYSIZE = TxnOp_Type_Type_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* TxnOp_Type_descriptor();
+template<typename T>
+inline const std::string& TxnOp_Type_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, TxnOp_Type>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function TxnOp_Type_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    TxnOp_Type_descriptor(), enum_t_value);
+}
+inline bool TxnOp_Type_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, TxnOp_Type* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<TxnOp_Type>(
+    TxnOp_Type_descriptor(), name, value);
+}
 // ===================================================================
 
-class GetArgs PROTOBUF_FINAL :
+class GetArgs final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.GetArgs) */ {
  public:
-  inline GetArgs() : GetArgs(nullptr) {};
-  virtual ~GetArgs();
+  inline GetArgs() : GetArgs(nullptr) {}
+  ~GetArgs() override;
+  explicit PROTOBUF_CONSTEXPR GetArgs(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   GetArgs(const GetArgs& from);
   GetArgs(GetArgs&& from) noexcept
@@ -96,8 +266,13 @@ class GetArgs PROTOBUF_FINAL :
     return *this;
   }
   inline GetArgs& operator=(GetArgs&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -108,14 +283,14 @@ class GetArgs PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GetArgs& default_instance() {
+    return *internal_default_instance();
   }
-  static const GetArgs& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const GetArgs* internal_default_instance() {
     return reinterpret_cast<const GetArgs*>(
                &_GetArgs_default_instance_);
@@ -128,7 +303,12 @@ class GetArgs PROTOBUF_FINAL :
   }
   inline void Swap(GetArgs* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -136,56 +316,53 @@ class GetArgs PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(GetArgs* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline GetArgs* New() const final {
-    return CreateMaybeMessage<GetArgs>(nullptr);
-  }
-
-  GetArgs* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  GetArgs* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<GetArgs>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const GetArgs& from);
-  void MergeFrom(const GetArgs& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GetArgs& from) {
+    GetArgs::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(GetArgs* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "raftKVRpcProctoc.GetArgs";
   }
   protected:
-  explicit GetArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit GetArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_kvServerRPC_2eproto);
-    return ::descriptor_table_kvServerRPC_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -199,60 +376,33 @@ class GetArgs PROTOBUF_FINAL :
   // bytes Key = 1;
   void clear_key();
   const std::string& key() const;
-  void set_key(const std::string& value);
-  void set_key(std::string&& value);
-  void set_key(const char* value);
-  void set_key(const void* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
   std::string* mutable_key();
-  std::string* release_key();
+  PROTOBUF_NODISCARD std::string* release_key();
   void set_allocated_key(std::string* key);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_key();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_key(
-      std::string* key);
   private:
   const std::string& _internal_key() const;
-  void _internal_set_key(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
   std::string* _internal_mutable_key();
   public:
 
-  // bytes ClientId = 2;
+  // uint64 ClientId = 2;
   void clear_clientid();
-  const std::string& clientid() const;
-  void set_clientid(const std::string& value);
-  void set_clientid(std::string&& value);
-  void set_clientid(const char* value);
-  void set_clientid(const void* value, size_t size);
-  std::string* mutable_clientid();
-  std::string* release_clientid();
-  void set_allocated_clientid(std::string* clientid);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_clientid();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_clientid(
-      std::string* clientid);
-  private:
-  const std::string& _internal_clientid() const;
-  void _internal_set_clientid(const std::string& value);
-  std::string* _internal_mutable_clientid();
+  uint64_t clientid() const;
+  void set_clientid(uint64_t value);
+  private:
+  uint64_t _internal_clientid() const;
+  void _internal_set_clientid(uint64_t value);
   public:
 
   // int32 RequestId = 3;
   void clear_requestid();
-  ::PROTOBUF_NAMESPACE_ID::int32 requestid() const;
-  void set_requestid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t requestid() const;
+  void set_requestid(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_requestid() const;
-  void _internal_set_requestid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_requestid() const;
+  void _internal_set_requestid(int32_t value);
   public:
 
   // @@protoc_insertion_point(class_scope:raftKVRpcProctoc.GetArgs)
@@ -262,19 +412,23 @@ class GetArgs PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr clientid_;
-  ::PROTOBUF_NAMESPACE_ID::int32 requestid_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    uint64_t clientid_;
+    int32_t requestid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_kvServerRPC_2eproto;
 };
 // -------------------------------------------------------------------
 
-class GetReply PROTOBUF_FINAL :
+class GetReply final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.GetReply) */ {
  public:
-  inline GetReply() : GetReply(nullptr) {};
-  virtual ~GetReply();
+  inline GetReply() : GetReply(nullptr) {}
+  ~GetReply() override;
+  explicit PROTOBUF_CONSTEXPR GetReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   GetReply(const GetReply& from);
   GetReply(GetReply&& from) noexcept
@@ -287,8 +441,13 @@ class GetReply PROTOBUF_FINAL :
     return *this;
   }
   inline GetReply& operator=(GetReply&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -299,14 +458,14 @@ class GetReply PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GetReply& default_instance() {
+    return *internal_default_instance();
   }
-  static const GetReply& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const GetReply* internal_default_instance() {
     return reinterpret_cast<const GetReply*>(
                &_GetReply_default_instance_);
@@ -319,7 +478,12 @@ class GetReply PROTOBUF_FINAL :
   }
   inline void Swap(GetReply* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -327,56 +491,53 @@ class GetReply PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(GetReply* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline GetReply* New() const final {
-    return CreateMaybeMessage<GetReply>(nullptr);
-  }
-
-  GetReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  GetReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<GetReply>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const GetReply& from);
-  void MergeFrom(const GetReply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GetReply& from) {
+    GetReply::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(GetReply* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "raftKVRpcProctoc.GetReply";
   }
   protected:
-  explicit GetReply(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit GetReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_kvServerRPC_2eproto);
-    return ::descriptor_table_kvServerRPC_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -389,50 +550,28 @@ class GetReply PROTOBUF_FINAL :
   // bytes Err = 1;
   void clear_err();
   const std::string& err() const;
-  void set_err(const std::string& value);
-  void set_err(std::string&& value);
-  void set_err(const char* value);
-  void set_err(const void* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_err(ArgT0&& arg0, ArgT... args);
   std::string* mutable_err();
-  std::string* release_err();
+  PROTOBUF_NODISCARD std::string* release_err();
   void set_allocated_err(std::string* err);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_err();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_err(
-      std::string* err);
   private:
   const std::string& _internal_err() const;
-  void _internal_set_err(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_err(const std::string& value);
   std::string* _internal_mutable_err();
   public:
 
   // bytes Value = 2;
   void clear_value();
   const std::string& value() const;
-  void set_value(const std::string& value);
-  void set_value(std::string&& value);
-  void set_value(const char* value);
-  void set_value(const void* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
   std::string* mutable_value();
-  std::string* release_value();
+  PROTOBUF_NODISCARD std::string* release_value();
   void set_allocated_value(std::string* value);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_value();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_value(
-      std::string* value);
   private:
   const std::string& _internal_value() const;
-  void _internal_set_value(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
   std::string* _internal_mutable_value();
   public:
 
@@ -443,18 +582,22 @@ class GetReply PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr err_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr err_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_kvServerRPC_2eproto;
 };
 // -------------------------------------------------------------------
 
-class PutAppendArgs PROTOBUF_FINAL :
+class PutAppendArgs final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.PutAppendArgs) */ {
  public:
-  inline PutAppendArgs() : PutAppendArgs(nullptr) {};
-  virtual ~PutAppendArgs();
+  inline PutAppendArgs() : PutAppendArgs(nullptr) {}
+  ~PutAppendArgs() override;
+  explicit PROTOBUF_CONSTEXPR PutAppendArgs(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   PutAppendArgs(const PutAppendArgs& from);
   PutAppendArgs(PutAppendArgs&& from) noexcept
@@ -467,8 +610,13 @@ class PutAppendArgs PROTOBUF_FINAL :
     return *this;
   }
   inline PutAppendArgs& operator=(PutAppendArgs&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -479,14 +627,14 @@ class PutAppendArgs PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PutAppendArgs& default_instance() {
+    return *internal_default_instance();
   }
-  static const PutAppendArgs& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const PutAppendArgs* internal_default_instance() {
     return reinterpret_cast<const PutAppendArgs*>(
                &_PutAppendArgs_default_instance_);
@@ -499,7 +647,12 @@ class PutAppendArgs PROTOBUF_FINAL :
   }
   inline void Swap(PutAppendArgs* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -507,56 +660,53 @@ class PutAppendArgs PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(PutAppendArgs* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline PutAppendArgs* New() const final {
-    return CreateMaybeMessage<PutAppendArgs>(nullptr);
-  }
-
-  PutAppendArgs* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  PutAppendArgs* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<PutAppendArgs>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const PutAppendArgs& from);
-  void MergeFrom(const PutAppendArgs& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PutAppendArgs& from) {
+    PutAppendArgs::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(PutAppendArgs* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "raftKVRpcProctoc.PutAppendArgs";
   }
   protected:
-  explicit PutAppendArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit PutAppendArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_kvServerRPC_2eproto);
-    return ::descriptor_table_kvServerRPC_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -567,115 +717,76 @@ class PutAppendArgs PROTOBUF_FINAL :
     kValueFieldNumber = 2,
     kOpFieldNumber = 3,
     kClientIdFieldNumber = 4,
+    kTtlMsFieldNumber = 6,
     kRequestIdFieldNumber = 5,
   };
   // bytes Key = 1;
   void clear_key();
   const std::string& key() const;
-  void set_key(const std::string& value);
-  void set_key(std::string&& value);
-  void set_key(const char* value);
-  void set_key(const void* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
   std::string* mutable_key();
-  std::string* release_key();
+  PROTOBUF_NODISCARD std::string* release_key();
   void set_allocated_key(std::string* key);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_key();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_key(
-      std::string* key);
   private:
   const std::string& _internal_key() const;
-  void _internal_set_key(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
   std::string* _internal_mutable_key();
   public:
 
   // bytes Value = 2;
   void clear_value();
   const std::string& value() const;
-  void set_value(const std::string& value);
-  void set_value(std::string&& value);
-  void set_value(const char* value);
-  void set_value(const void* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
   std::string* mutable_value();
-  std::string* release_value();
+  PROTOBUF_NODISCARD std::string* release_value();
   void set_allocated_value(std::string* value);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_value();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_value(
-      std::string* value);
   private:
   const std::string& _internal_value() const;
-  void _internal_set_value(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
   std::string* _internal_mutable_value();
   public:
 
   // bytes Op = 3;
   void clear_op();
   const std::string& op() const;
-  void set_op(const std::string& value);
-  void set_op(std::string&& value);
-  void set_op(const char* value);
-  void set_op(const void* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_op(ArgT0&& arg0, ArgT... args);
   std::string* mutable_op();
-  std::string* release_op();
+  PROTOBUF_NODISCARD std::string* release_op();
   void set_allocated_op(std::string* op);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_op();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_op(
-      std::string* op);
   private:
   const std::string& _internal_op() const;
-  void _internal_set_op(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_op(const std::string& value);
   std::string* _internal_mutable_op();
   public:
 
-  // bytes ClientId = 4;
+  // uint64 ClientId = 4;
   void clear_clientid();
-  const std::string& clientid() const;
-  void set_clientid(const std::string& value);
-  void set_clientid(std::string&& value);
-  void set_clientid(const char* value);
-  void set_clientid(const void* value, size_t size);
-  std::string* mutable_clientid();
-  std::string* release_clientid();
-  void set_allocated_clientid(std::string* clientid);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_clientid();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_clientid(
-      std::string* clientid);
-  private:
-  const std::string& _internal_clientid() const;
-  void _internal_set_clientid(const std::string& value);
-  std::string* _internal_mutable_clientid();
+  uint64_t clientid() const;
+  void set_clientid(uint64_t value);
+  private:
+  uint64_t _internal_clientid() const;
+  void _internal_set_clientid(uint64_t value);
+  public:
+
+  // int64 TtlMs = 6;
+  void clear_ttlms();
+  int64_t ttlms() const;
+  void set_ttlms(int64_t value);
+  private:
+  int64_t _internal_ttlms() const;
+  void _internal_set_ttlms(int64_t value);
   public:
 
   // int32 RequestId = 5;
   void clear_requestid();
-  ::PROTOBUF_NAMESPACE_ID::int32 requestid() const;
-  void set_requestid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t requestid() const;
+  void set_requestid(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_requestid() const;
-  void _internal_set_requestid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_requestid() const;
+  void _internal_set_requestid(int32_t value);
   public:
 
   // @@protoc_insertion_point(class_scope:raftKVRpcProctoc.PutAppendArgs)
@@ -685,21 +796,26 @@ class PutAppendArgs PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr op_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr clientid_;
-  ::PROTOBUF_NAMESPACE_ID::int32 requestid_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr op_;
+    uint64_t clientid_;
+    int64_t ttlms_;
+    int32_t requestid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_kvServerRPC_2eproto;
 };
 // -------------------------------------------------------------------
 
-class PutAppendReply PROTOBUF_FINAL :
+class PutAppendReply final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.PutAppendReply) */ {
  public:
-  inline PutAppendReply() : PutAppendReply(nullptr) {};
-  virtual ~PutAppendReply();
+  inline PutAppendReply() : PutAppendReply(nullptr) {}
+  ~PutAppendReply() override;
+  explicit PROTOBUF_CONSTEXPR PutAppendReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   PutAppendReply(const PutAppendReply& from);
   PutAppendReply(PutAppendReply&& from) noexcept
@@ -712,8 +828,13 @@ class PutAppendReply PROTOBUF_FINAL :
     return *this;
   }
   inline PutAppendReply& operator=(PutAppendReply&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -724,14 +845,14 @@ class PutAppendReply PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PutAppendReply& default_instance() {
+    return *internal_default_instance();
   }
-  static const PutAppendReply& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const PutAppendReply* internal_default_instance() {
     return reinterpret_cast<const PutAppendReply*>(
                &_PutAppendReply_default_instance_);
@@ -744,7 +865,12 @@ class PutAppendReply PROTOBUF_FINAL :
   }
   inline void Swap(PutAppendReply* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -752,56 +878,53 @@ class PutAppendReply PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(PutAppendReply* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline PutAppendReply* New() const final {
-    return CreateMaybeMessage<PutAppendReply>(nullptr);
-  }
-
-  PutAppendReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  PutAppendReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<PutAppendReply>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const PutAppendReply& from);
-  void MergeFrom(const PutAppendReply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PutAppendReply& from) {
+    PutAppendReply::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(PutAppendReply* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "raftKVRpcProctoc.PutAppendReply";
   }
   protected:
-  explicit PutAppendReply(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit PutAppendReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_kvServerRPC_2eproto);
-    return ::descriptor_table_kvServerRPC_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -813,25 +936,14 @@ class PutAppendReply PROTOBUF_FINAL :
   // bytes Err = 1;
   void clear_err();
   const std::string& err() const;
-  void set_err(const std::string& value);
-  void set_err(std::string&& value);
-  void set_err(const char* value);
-  void set_err(const void* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_err(ArgT0&& arg0, ArgT... args);
   std::string* mutable_err();
-  std::string* release_err();
+  PROTOBUF_NODISCARD std::string* release_err();
   void set_allocated_err(std::string* err);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_err();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_err(
-      std::string* err);
   private:
   const std::string& _internal_err() const;
-  void _internal_set_err(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_err(const std::string& value);
   std::string* _internal_mutable_err();
   public:
 
@@ -842,867 +954,8109 @@ class PutAppendReply PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr err_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr err_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_kvServerRPC_2eproto;
 };
-// ===================================================================
-
-class kvServerRpc_Stub;
+// -------------------------------------------------------------------
 
-class kvServerRpc : public ::PROTOBUF_NAMESPACE_ID::Service {
- protected:
-  // This class should be treated as an abstract interface.
-  inline kvServerRpc() {};
+class MultiGetArgs final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.MultiGetArgs) */ {
  public:
-  virtual ~kvServerRpc();
-
-  typedef kvServerRpc_Stub Stub;
-
-  static const ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor* descriptor();
-
-  virtual void PutAppend(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
-                       const ::raftKVRpcProctoc::PutAppendArgs* request,
-                       ::raftKVRpcProctoc::PutAppendReply* response,
-                       ::google::protobuf::Closure* done);
-  virtual void Get(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
-                       const ::raftKVRpcProctoc::GetArgs* request,
-                       ::raftKVRpcProctoc::GetReply* response,
-                       ::google::protobuf::Closure* done);
+  inline MultiGetArgs() : MultiGetArgs(nullptr) {}
+  ~MultiGetArgs() override;
+  explicit PROTOBUF_CONSTEXPR MultiGetArgs(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  // implements Service ----------------------------------------------
+  MultiGetArgs(const MultiGetArgs& from);
+  MultiGetArgs(MultiGetArgs&& from) noexcept
+    : MultiGetArgs() {
+    *this = ::std::move(from);
+  }
 
-  const ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor* GetDescriptor();
-  void CallMethod(const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method,
-                  ::PROTOBUF_NAMESPACE_ID::RpcController* controller,
-                  const ::PROTOBUF_NAMESPACE_ID::Message* request,
-                  ::PROTOBUF_NAMESPACE_ID::Message* response,
-                  ::google::protobuf::Closure* done);
-  const ::PROTOBUF_NAMESPACE_ID::Message& GetRequestPrototype(
-    const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method) const;
-  const ::PROTOBUF_NAMESPACE_ID::Message& GetResponsePrototype(
-    const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method) const;
+  inline MultiGetArgs& operator=(const MultiGetArgs& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MultiGetArgs& operator=(MultiGetArgs&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
- private:
-  GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(kvServerRpc);
-};
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MultiGetArgs& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MultiGetArgs* internal_default_instance() {
+    return reinterpret_cast<const MultiGetArgs*>(
+               &_MultiGetArgs_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
 
-class kvServerRpc_Stub : public kvServerRpc {
- public:
-  kvServerRpc_Stub(::PROTOBUF_NAMESPACE_ID::RpcChannel* channel);
-  kvServerRpc_Stub(::PROTOBUF_NAMESPACE_ID::RpcChannel* channel,
-                   ::PROTOBUF_NAMESPACE_ID::Service::ChannelOwnership ownership);
-  ~kvServerRpc_Stub();
+  friend void swap(MultiGetArgs& a, MultiGetArgs& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MultiGetArgs* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MultiGetArgs* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
-  inline ::PROTOBUF_NAMESPACE_ID::RpcChannel* channel() { return channel_; }
+  // implements Message ----------------------------------------------
 
-  // implements kvServerRpc ------------------------------------------
+  MultiGetArgs* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MultiGetArgs>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const MultiGetArgs& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MultiGetArgs& from) {
+    MultiGetArgs::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
 
-  void PutAppend(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
-                       const ::raftKVRpcProctoc::PutAppendArgs* request,
-                       ::raftKVRpcProctoc::PutAppendReply* response,
-                       ::google::protobuf::Closure* done);
-  void Get(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
-                       const ::raftKVRpcProctoc::GetArgs* request,
-                       ::raftKVRpcProctoc::GetReply* response,
-                       ::google::protobuf::Closure* done);
- private:
-  ::PROTOBUF_NAMESPACE_ID::RpcChannel* channel_;
-  bool owns_channel_;
-  GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(kvServerRpc_Stub);
-};
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MultiGetArgs* other);
 
-// ===================================================================
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftKVRpcProctoc.MultiGetArgs";
+  }
+  protected:
+  explicit MultiGetArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
 
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-// ===================================================================
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
-#ifdef __GNUC__
-  #pragma GCC diagnostic push
-  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
-#endif  // __GNUC__
-// GetArgs
+  // nested types ----------------------------------------------------
 
-// bytes Key = 1;
-inline void GetArgs::clear_key() {
-  key_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-}
-inline const std::string& GetArgs::key() const {
-  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.GetArgs.Key)
-  return _internal_key();
-}
-inline void GetArgs::set_key(const std::string& value) {
-  _internal_set_key(value);
-  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.GetArgs.Key)
-}
-inline std::string* GetArgs::mutable_key() {
-  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.GetArgs.Key)
-  return _internal_mutable_key();
-}
-inline const std::string& GetArgs::_internal_key() const {
-  return key_.Get();
-}
-inline void GetArgs::_internal_set_key(const std::string& value) {
+  // accessors -------------------------------------------------------
 
-  key_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
-}
-inline void GetArgs::set_key(std::string&& value) {
+  enum : int {
+    kKeysFieldNumber = 1,
+    kClientIdFieldNumber = 2,
+    kRequestIdFieldNumber = 3,
+  };
+  // repeated bytes Keys = 1;
+  int keys_size() const;
+  private:
+  int _internal_keys_size() const;
+  public:
+  void clear_keys();
+  const std::string& keys(int index) const;
+  std::string* mutable_keys(int index);
+  void set_keys(int index, const std::string& value);
+  void set_keys(int index, std::string&& value);
+  void set_keys(int index, const char* value);
+  void set_keys(int index, const void* value, size_t size);
+  std::string* add_keys();
+  void add_keys(const std::string& value);
+  void add_keys(std::string&& value);
+  void add_keys(const char* value);
+  void add_keys(const void* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& keys() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_keys();
+  private:
+  const std::string& _internal_keys(int index) const;
+  std::string* _internal_add_keys();
+  public:
 
-  key_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:raftKVRpcProctoc.GetArgs.Key)
-}
-inline void GetArgs::set_key(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
+  // uint64 ClientId = 2;
+  void clear_clientid();
+  uint64_t clientid() const;
+  void set_clientid(uint64_t value);
+  private:
+  uint64_t _internal_clientid() const;
+  void _internal_set_clientid(uint64_t value);
+  public:
 
-  key_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:raftKVRpcProctoc.GetArgs.Key)
-}
-inline void GetArgs::set_key(const void* value,
-    size_t size) {
+  // int32 RequestId = 3;
+  void clear_requestid();
+  int32_t requestid() const;
+  void set_requestid(int32_t value);
+  private:
+  int32_t _internal_requestid() const;
+  void _internal_set_requestid(int32_t value);
+  public:
 
-  key_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:raftKVRpcProctoc.GetArgs.Key)
-}
-inline std::string* GetArgs::_internal_mutable_key() {
+  // @@protoc_insertion_point(class_scope:raftKVRpcProctoc.MultiGetArgs)
+ private:
+  class _Internal;
 
-  return key_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-}
-inline std::string* GetArgs::release_key() {
-  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.GetArgs.Key)
-  return key_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-}
-inline void GetArgs::set_allocated_key(std::string* key) {
-  if (key != nullptr) {
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> keys_;
+    uint64_t clientid_;
+    int32_t requestid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvServerRPC_2eproto;
+};
+// -------------------------------------------------------------------
 
-  } else {
+class MultiGetReply final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.MultiGetReply) */ {
+ public:
+  inline MultiGetReply() : MultiGetReply(nullptr) {}
+  ~MultiGetReply() override;
+  explicit PROTOBUF_CONSTEXPR MultiGetReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
+  MultiGetReply(const MultiGetReply& from);
+  MultiGetReply(MultiGetReply&& from) noexcept
+    : MultiGetReply() {
+    *this = ::std::move(from);
   }
-  key_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), key,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.GetArgs.Key)
-}
-inline std::string* GetArgs::unsafe_arena_release_key() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:raftKVRpcProctoc.GetArgs.Key)
-  GOOGLE_DCHECK(GetArena() != nullptr);
-
-  return key_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
-}
-inline void GetArgs::unsafe_arena_set_allocated_key(
-    std::string* key) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (key != nullptr) {
-
-  } else {
 
+  inline MultiGetReply& operator=(const MultiGetReply& from) {
+    CopyFrom(from);
+    return *this;
   }
-  key_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      key, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:raftKVRpcProctoc.GetArgs.Key)
-}
-
-// bytes ClientId = 2;
-inline void GetArgs::clear_clientid() {
-  clientid_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-}
-inline const std::string& GetArgs::clientid() const {
-  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.GetArgs.ClientId)
+  inline MultiGetReply& operator=(MultiGetReply&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MultiGetReply& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MultiGetReply* internal_default_instance() {
+    return reinterpret_cast<const MultiGetReply*>(
+               &_MultiGetReply_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(MultiGetReply& a, MultiGetReply& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MultiGetReply* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MultiGetReply* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MultiGetReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MultiGetReply>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const MultiGetReply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MultiGetReply& from) {
+    MultiGetReply::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MultiGetReply* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftKVRpcProctoc.MultiGetReply";
+  }
+  protected:
+  explicit MultiGetReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kValuesFieldNumber = 2,
+    kExistsFieldNumber = 3,
+    kErrFieldNumber = 1,
+  };
+  // repeated bytes Values = 2;
+  int values_size() const;
+  private:
+  int _internal_values_size() const;
+  public:
+  void clear_values();
+  const std::string& values(int index) const;
+  std::string* mutable_values(int index);
+  void set_values(int index, const std::string& value);
+  void set_values(int index, std::string&& value);
+  void set_values(int index, const char* value);
+  void set_values(int index, const void* value, size_t size);
+  std::string* add_values();
+  void add_values(const std::string& value);
+  void add_values(std::string&& value);
+  void add_values(const char* value);
+  void add_values(const void* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& values() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_values();
+  private:
+  const std::string& _internal_values(int index) const;
+  std::string* _internal_add_values();
+  public:
+
+  // repeated bool Exists = 3;
+  int exists_size() const;
+  private:
+  int _internal_exists_size() const;
+  public:
+  void clear_exists();
+  private:
+  bool _internal_exists(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >&
+      _internal_exists() const;
+  void _internal_add_exists(bool value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >*
+      _internal_mutable_exists();
+  public:
+  bool exists(int index) const;
+  void set_exists(int index, bool value);
+  void add_exists(bool value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >&
+      exists() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >*
+      mutable_exists();
+
+  // bytes Err = 1;
+  void clear_err();
+  const std::string& err() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_err(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_err();
+  PROTOBUF_NODISCARD std::string* release_err();
+  void set_allocated_err(std::string* err);
+  private:
+  const std::string& _internal_err() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_err(const std::string& value);
+  std::string* _internal_mutable_err();
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftKVRpcProctoc.MultiGetReply)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> values_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool > exists_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr err_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvServerRPC_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MultiPutArgs final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.MultiPutArgs) */ {
+ public:
+  inline MultiPutArgs() : MultiPutArgs(nullptr) {}
+  ~MultiPutArgs() override;
+  explicit PROTOBUF_CONSTEXPR MultiPutArgs(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  MultiPutArgs(const MultiPutArgs& from);
+  MultiPutArgs(MultiPutArgs&& from) noexcept
+    : MultiPutArgs() {
+    *this = ::std::move(from);
+  }
+
+  inline MultiPutArgs& operator=(const MultiPutArgs& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MultiPutArgs& operator=(MultiPutArgs&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MultiPutArgs& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MultiPutArgs* internal_default_instance() {
+    return reinterpret_cast<const MultiPutArgs*>(
+               &_MultiPutArgs_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  friend void swap(MultiPutArgs& a, MultiPutArgs& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MultiPutArgs* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MultiPutArgs* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MultiPutArgs* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MultiPutArgs>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const MultiPutArgs& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MultiPutArgs& from) {
+    MultiPutArgs::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MultiPutArgs* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftKVRpcProctoc.MultiPutArgs";
+  }
+  protected:
+  explicit MultiPutArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKeysFieldNumber = 1,
+    kValuesFieldNumber = 2,
+    kClientIdFieldNumber = 3,
+    kRequestIdFieldNumber = 4,
+  };
+  // repeated bytes Keys = 1;
+  int keys_size() const;
+  private:
+  int _internal_keys_size() const;
+  public:
+  void clear_keys();
+  const std::string& keys(int index) const;
+  std::string* mutable_keys(int index);
+  void set_keys(int index, const std::string& value);
+  void set_keys(int index, std::string&& value);
+  void set_keys(int index, const char* value);
+  void set_keys(int index, const void* value, size_t size);
+  std::string* add_keys();
+  void add_keys(const std::string& value);
+  void add_keys(std::string&& value);
+  void add_keys(const char* value);
+  void add_keys(const void* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& keys() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_keys();
+  private:
+  const std::string& _internal_keys(int index) const;
+  std::string* _internal_add_keys();
+  public:
+
+  // repeated bytes Values = 2;
+  int values_size() const;
+  private:
+  int _internal_values_size() const;
+  public:
+  void clear_values();
+  const std::string& values(int index) const;
+  std::string* mutable_values(int index);
+  void set_values(int index, const std::string& value);
+  void set_values(int index, std::string&& value);
+  void set_values(int index, const char* value);
+  void set_values(int index, const void* value, size_t size);
+  std::string* add_values();
+  void add_values(const std::string& value);
+  void add_values(std::string&& value);
+  void add_values(const char* value);
+  void add_values(const void* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& values() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_values();
+  private:
+  const std::string& _internal_values(int index) const;
+  std::string* _internal_add_values();
+  public:
+
+  // uint64 ClientId = 3;
+  void clear_clientid();
+  uint64_t clientid() const;
+  void set_clientid(uint64_t value);
+  private:
+  uint64_t _internal_clientid() const;
+  void _internal_set_clientid(uint64_t value);
+  public:
+
+  // int32 RequestId = 4;
+  void clear_requestid();
+  int32_t requestid() const;
+  void set_requestid(int32_t value);
+  private:
+  int32_t _internal_requestid() const;
+  void _internal_set_requestid(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftKVRpcProctoc.MultiPutArgs)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> keys_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> values_;
+    uint64_t clientid_;
+    int32_t requestid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvServerRPC_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MultiPutReply final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.MultiPutReply) */ {
+ public:
+  inline MultiPutReply() : MultiPutReply(nullptr) {}
+  ~MultiPutReply() override;
+  explicit PROTOBUF_CONSTEXPR MultiPutReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  MultiPutReply(const MultiPutReply& from);
+  MultiPutReply(MultiPutReply&& from) noexcept
+    : MultiPutReply() {
+    *this = ::std::move(from);
+  }
+
+  inline MultiPutReply& operator=(const MultiPutReply& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MultiPutReply& operator=(MultiPutReply&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MultiPutReply& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MultiPutReply* internal_default_instance() {
+    return reinterpret_cast<const MultiPutReply*>(
+               &_MultiPutReply_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
+
+  friend void swap(MultiPutReply& a, MultiPutReply& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MultiPutReply* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MultiPutReply* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MultiPutReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MultiPutReply>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const MultiPutReply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MultiPutReply& from) {
+    MultiPutReply::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MultiPutReply* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftKVRpcProctoc.MultiPutReply";
+  }
+  protected:
+  explicit MultiPutReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kErrFieldNumber = 1,
+  };
+  // bytes Err = 1;
+  void clear_err();
+  const std::string& err() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_err(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_err();
+  PROTOBUF_NODISCARD std::string* release_err();
+  void set_allocated_err(std::string* err);
+  private:
+  const std::string& _internal_err() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_err(const std::string& value);
+  std::string* _internal_mutable_err();
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftKVRpcProctoc.MultiPutReply)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr err_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvServerRPC_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ScanArgs final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.ScanArgs) */ {
+ public:
+  inline ScanArgs() : ScanArgs(nullptr) {}
+  ~ScanArgs() override;
+  explicit PROTOBUF_CONSTEXPR ScanArgs(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ScanArgs(const ScanArgs& from);
+  ScanArgs(ScanArgs&& from) noexcept
+    : ScanArgs() {
+    *this = ::std::move(from);
+  }
+
+  inline ScanArgs& operator=(const ScanArgs& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ScanArgs& operator=(ScanArgs&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ScanArgs& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ScanArgs* internal_default_instance() {
+    return reinterpret_cast<const ScanArgs*>(
+               &_ScanArgs_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    8;
+
+  friend void swap(ScanArgs& a, ScanArgs& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ScanArgs* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ScanArgs* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ScanArgs* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ScanArgs>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ScanArgs& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ScanArgs& from) {
+    ScanArgs::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ScanArgs* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftKVRpcProctoc.ScanArgs";
+  }
+  protected:
+  explicit ScanArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kStartKeyFieldNumber = 1,
+    kEndKeyFieldNumber = 2,
+    kClientIdFieldNumber = 4,
+    kLimitFieldNumber = 3,
+    kRequestIdFieldNumber = 5,
+  };
+  // bytes StartKey = 1;
+  void clear_startkey();
+  const std::string& startkey() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_startkey(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_startkey();
+  PROTOBUF_NODISCARD std::string* release_startkey();
+  void set_allocated_startkey(std::string* startkey);
+  private:
+  const std::string& _internal_startkey() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_startkey(const std::string& value);
+  std::string* _internal_mutable_startkey();
+  public:
+
+  // bytes EndKey = 2;
+  void clear_endkey();
+  const std::string& endkey() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_endkey(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_endkey();
+  PROTOBUF_NODISCARD std::string* release_endkey();
+  void set_allocated_endkey(std::string* endkey);
+  private:
+  const std::string& _internal_endkey() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_endkey(const std::string& value);
+  std::string* _internal_mutable_endkey();
+  public:
+
+  // uint64 ClientId = 4;
+  void clear_clientid();
+  uint64_t clientid() const;
+  void set_clientid(uint64_t value);
+  private:
+  uint64_t _internal_clientid() const;
+  void _internal_set_clientid(uint64_t value);
+  public:
+
+  // int32 Limit = 3;
+  void clear_limit();
+  int32_t limit() const;
+  void set_limit(int32_t value);
+  private:
+  int32_t _internal_limit() const;
+  void _internal_set_limit(int32_t value);
+  public:
+
+  // int32 RequestId = 5;
+  void clear_requestid();
+  int32_t requestid() const;
+  void set_requestid(int32_t value);
+  private:
+  int32_t _internal_requestid() const;
+  void _internal_set_requestid(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftKVRpcProctoc.ScanArgs)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr startkey_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr endkey_;
+    uint64_t clientid_;
+    int32_t limit_;
+    int32_t requestid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvServerRPC_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ScanReply final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.ScanReply) */ {
+ public:
+  inline ScanReply() : ScanReply(nullptr) {}
+  ~ScanReply() override;
+  explicit PROTOBUF_CONSTEXPR ScanReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ScanReply(const ScanReply& from);
+  ScanReply(ScanReply&& from) noexcept
+    : ScanReply() {
+    *this = ::std::move(from);
+  }
+
+  inline ScanReply& operator=(const ScanReply& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ScanReply& operator=(ScanReply&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ScanReply& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ScanReply* internal_default_instance() {
+    return reinterpret_cast<const ScanReply*>(
+               &_ScanReply_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    9;
+
+  friend void swap(ScanReply& a, ScanReply& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ScanReply* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ScanReply* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ScanReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ScanReply>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ScanReply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ScanReply& from) {
+    ScanReply::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ScanReply* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftKVRpcProctoc.ScanReply";
+  }
+  protected:
+  explicit ScanReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKeysFieldNumber = 2,
+    kValuesFieldNumber = 3,
+    kErrFieldNumber = 1,
+    kContinuationFieldNumber = 5,
+    kMoreFieldNumber = 4,
+  };
+  // repeated bytes Keys = 2;
+  int keys_size() const;
+  private:
+  int _internal_keys_size() const;
+  public:
+  void clear_keys();
+  const std::string& keys(int index) const;
+  std::string* mutable_keys(int index);
+  void set_keys(int index, const std::string& value);
+  void set_keys(int index, std::string&& value);
+  void set_keys(int index, const char* value);
+  void set_keys(int index, const void* value, size_t size);
+  std::string* add_keys();
+  void add_keys(const std::string& value);
+  void add_keys(std::string&& value);
+  void add_keys(const char* value);
+  void add_keys(const void* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& keys() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_keys();
+  private:
+  const std::string& _internal_keys(int index) const;
+  std::string* _internal_add_keys();
+  public:
+
+  // repeated bytes Values = 3;
+  int values_size() const;
+  private:
+  int _internal_values_size() const;
+  public:
+  void clear_values();
+  const std::string& values(int index) const;
+  std::string* mutable_values(int index);
+  void set_values(int index, const std::string& value);
+  void set_values(int index, std::string&& value);
+  void set_values(int index, const char* value);
+  void set_values(int index, const void* value, size_t size);
+  std::string* add_values();
+  void add_values(const std::string& value);
+  void add_values(std::string&& value);
+  void add_values(const char* value);
+  void add_values(const void* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& values() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_values();
+  private:
+  const std::string& _internal_values(int index) const;
+  std::string* _internal_add_values();
+  public:
+
+  // bytes Err = 1;
+  void clear_err();
+  const std::string& err() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_err(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_err();
+  PROTOBUF_NODISCARD std::string* release_err();
+  void set_allocated_err(std::string* err);
+  private:
+  const std::string& _internal_err() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_err(const std::string& value);
+  std::string* _internal_mutable_err();
+  public:
+
+  // bytes Continuation = 5;
+  void clear_continuation();
+  const std::string& continuation() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_continuation(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_continuation();
+  PROTOBUF_NODISCARD std::string* release_continuation();
+  void set_allocated_continuation(std::string* continuation);
+  private:
+  const std::string& _internal_continuation() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_continuation(const std::string& value);
+  std::string* _internal_mutable_continuation();
+  public:
+
+  // bool More = 4;
+  void clear_more();
+  bool more() const;
+  void set_more(bool value);
+  private:
+  bool _internal_more() const;
+  void _internal_set_more(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftKVRpcProctoc.ScanReply)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> keys_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> values_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr err_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr continuation_;
+    bool more_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvServerRPC_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CompareAndSwapArgs final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.CompareAndSwapArgs) */ {
+ public:
+  inline CompareAndSwapArgs() : CompareAndSwapArgs(nullptr) {}
+  ~CompareAndSwapArgs() override;
+  explicit PROTOBUF_CONSTEXPR CompareAndSwapArgs(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CompareAndSwapArgs(const CompareAndSwapArgs& from);
+  CompareAndSwapArgs(CompareAndSwapArgs&& from) noexcept
+    : CompareAndSwapArgs() {
+    *this = ::std::move(from);
+  }
+
+  inline CompareAndSwapArgs& operator=(const CompareAndSwapArgs& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CompareAndSwapArgs& operator=(CompareAndSwapArgs&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CompareAndSwapArgs& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CompareAndSwapArgs* internal_default_instance() {
+    return reinterpret_cast<const CompareAndSwapArgs*>(
+               &_CompareAndSwapArgs_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    10;
+
+  friend void swap(CompareAndSwapArgs& a, CompareAndSwapArgs& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CompareAndSwapArgs* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CompareAndSwapArgs* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CompareAndSwapArgs* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CompareAndSwapArgs>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CompareAndSwapArgs& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CompareAndSwapArgs& from) {
+    CompareAndSwapArgs::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CompareAndSwapArgs* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftKVRpcProctoc.CompareAndSwapArgs";
+  }
+  protected:
+  explicit CompareAndSwapArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKeyFieldNumber = 1,
+    kExpectedFieldNumber = 2,
+    kValueFieldNumber = 3,
+    kClientIdFieldNumber = 4,
+    kRequestIdFieldNumber = 5,
+  };
+  // bytes Key = 1;
+  void clear_key();
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
+  private:
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
+  public:
+
+  // bytes Expected = 2;
+  void clear_expected();
+  const std::string& expected() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_expected(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_expected();
+  PROTOBUF_NODISCARD std::string* release_expected();
+  void set_allocated_expected(std::string* expected);
+  private:
+  const std::string& _internal_expected() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_expected(const std::string& value);
+  std::string* _internal_mutable_expected();
+  public:
+
+  // bytes Value = 3;
+  void clear_value();
+  const std::string& value() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_value();
+  PROTOBUF_NODISCARD std::string* release_value();
+  void set_allocated_value(std::string* value);
+  private:
+  const std::string& _internal_value() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
+  std::string* _internal_mutable_value();
+  public:
+
+  // uint64 ClientId = 4;
+  void clear_clientid();
+  uint64_t clientid() const;
+  void set_clientid(uint64_t value);
+  private:
+  uint64_t _internal_clientid() const;
+  void _internal_set_clientid(uint64_t value);
+  public:
+
+  // int32 RequestId = 5;
+  void clear_requestid();
+  int32_t requestid() const;
+  void set_requestid(int32_t value);
+  private:
+  int32_t _internal_requestid() const;
+  void _internal_set_requestid(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftKVRpcProctoc.CompareAndSwapArgs)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr expected_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+    uint64_t clientid_;
+    int32_t requestid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvServerRPC_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CompareAndSwapReply final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.CompareAndSwapReply) */ {
+ public:
+  inline CompareAndSwapReply() : CompareAndSwapReply(nullptr) {}
+  ~CompareAndSwapReply() override;
+  explicit PROTOBUF_CONSTEXPR CompareAndSwapReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CompareAndSwapReply(const CompareAndSwapReply& from);
+  CompareAndSwapReply(CompareAndSwapReply&& from) noexcept
+    : CompareAndSwapReply() {
+    *this = ::std::move(from);
+  }
+
+  inline CompareAndSwapReply& operator=(const CompareAndSwapReply& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CompareAndSwapReply& operator=(CompareAndSwapReply&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CompareAndSwapReply& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CompareAndSwapReply* internal_default_instance() {
+    return reinterpret_cast<const CompareAndSwapReply*>(
+               &_CompareAndSwapReply_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    11;
+
+  friend void swap(CompareAndSwapReply& a, CompareAndSwapReply& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CompareAndSwapReply* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CompareAndSwapReply* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CompareAndSwapReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CompareAndSwapReply>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CompareAndSwapReply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CompareAndSwapReply& from) {
+    CompareAndSwapReply::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CompareAndSwapReply* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftKVRpcProctoc.CompareAndSwapReply";
+  }
+  protected:
+  explicit CompareAndSwapReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kErrFieldNumber = 1,
+    kCurrentFieldNumber = 4,
+    kSucceededFieldNumber = 2,
+    kExistsFieldNumber = 3,
+  };
+  // bytes Err = 1;
+  void clear_err();
+  const std::string& err() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_err(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_err();
+  PROTOBUF_NODISCARD std::string* release_err();
+  void set_allocated_err(std::string* err);
+  private:
+  const std::string& _internal_err() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_err(const std::string& value);
+  std::string* _internal_mutable_err();
+  public:
+
+  // bytes Current = 4;
+  void clear_current();
+  const std::string& current() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_current(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_current();
+  PROTOBUF_NODISCARD std::string* release_current();
+  void set_allocated_current(std::string* current);
+  private:
+  const std::string& _internal_current() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_current(const std::string& value);
+  std::string* _internal_mutable_current();
+  public:
+
+  // bool Succeeded = 2;
+  void clear_succeeded();
+  bool succeeded() const;
+  void set_succeeded(bool value);
+  private:
+  bool _internal_succeeded() const;
+  void _internal_set_succeeded(bool value);
+  public:
+
+  // bool Exists = 3;
+  void clear_exists();
+  bool exists() const;
+  void set_exists(bool value);
+  private:
+  bool _internal_exists() const;
+  void _internal_set_exists(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftKVRpcProctoc.CompareAndSwapReply)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr err_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr current_;
+    bool succeeded_;
+    bool exists_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvServerRPC_2eproto;
+};
+// -------------------------------------------------------------------
+
+class IncrementArgs final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.IncrementArgs) */ {
+ public:
+  inline IncrementArgs() : IncrementArgs(nullptr) {}
+  ~IncrementArgs() override;
+  explicit PROTOBUF_CONSTEXPR IncrementArgs(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  IncrementArgs(const IncrementArgs& from);
+  IncrementArgs(IncrementArgs&& from) noexcept
+    : IncrementArgs() {
+    *this = ::std::move(from);
+  }
+
+  inline IncrementArgs& operator=(const IncrementArgs& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline IncrementArgs& operator=(IncrementArgs&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const IncrementArgs& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const IncrementArgs* internal_default_instance() {
+    return reinterpret_cast<const IncrementArgs*>(
+               &_IncrementArgs_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    12;
+
+  friend void swap(IncrementArgs& a, IncrementArgs& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(IncrementArgs* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(IncrementArgs* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  IncrementArgs* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<IncrementArgs>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const IncrementArgs& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const IncrementArgs& from) {
+    IncrementArgs::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(IncrementArgs* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftKVRpcProctoc.IncrementArgs";
+  }
+  protected:
+  explicit IncrementArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKeyFieldNumber = 1,
+    kDeltaFieldNumber = 2,
+    kClientIdFieldNumber = 3,
+    kRequestIdFieldNumber = 4,
+  };
+  // bytes Key = 1;
+  void clear_key();
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
+  private:
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
+  public:
+
+  // int64 Delta = 2;
+  void clear_delta();
+  int64_t delta() const;
+  void set_delta(int64_t value);
+  private:
+  int64_t _internal_delta() const;
+  void _internal_set_delta(int64_t value);
+  public:
+
+  // uint64 ClientId = 3;
+  void clear_clientid();
+  uint64_t clientid() const;
+  void set_clientid(uint64_t value);
+  private:
+  uint64_t _internal_clientid() const;
+  void _internal_set_clientid(uint64_t value);
+  public:
+
+  // int32 RequestId = 4;
+  void clear_requestid();
+  int32_t requestid() const;
+  void set_requestid(int32_t value);
+  private:
+  int32_t _internal_requestid() const;
+  void _internal_set_requestid(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftKVRpcProctoc.IncrementArgs)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    int64_t delta_;
+    uint64_t clientid_;
+    int32_t requestid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvServerRPC_2eproto;
+};
+// -------------------------------------------------------------------
+
+class IncrementReply final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.IncrementReply) */ {
+ public:
+  inline IncrementReply() : IncrementReply(nullptr) {}
+  ~IncrementReply() override;
+  explicit PROTOBUF_CONSTEXPR IncrementReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  IncrementReply(const IncrementReply& from);
+  IncrementReply(IncrementReply&& from) noexcept
+    : IncrementReply() {
+    *this = ::std::move(from);
+  }
+
+  inline IncrementReply& operator=(const IncrementReply& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline IncrementReply& operator=(IncrementReply&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const IncrementReply& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const IncrementReply* internal_default_instance() {
+    return reinterpret_cast<const IncrementReply*>(
+               &_IncrementReply_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    13;
+
+  friend void swap(IncrementReply& a, IncrementReply& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(IncrementReply* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(IncrementReply* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  IncrementReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<IncrementReply>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const IncrementReply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const IncrementReply& from) {
+    IncrementReply::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(IncrementReply* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftKVRpcProctoc.IncrementReply";
+  }
+  protected:
+  explicit IncrementReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kErrFieldNumber = 1,
+    kValueFieldNumber = 2,
+  };
+  // bytes Err = 1;
+  void clear_err();
+  const std::string& err() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_err(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_err();
+  PROTOBUF_NODISCARD std::string* release_err();
+  void set_allocated_err(std::string* err);
+  private:
+  const std::string& _internal_err() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_err(const std::string& value);
+  std::string* _internal_mutable_err();
+  public:
+
+  // int64 Value = 2;
+  void clear_value();
+  int64_t value() const;
+  void set_value(int64_t value);
+  private:
+  int64_t _internal_value() const;
+  void _internal_set_value(int64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftKVRpcProctoc.IncrementReply)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr err_;
+    int64_t value_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvServerRPC_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PutIfAbsentArgs final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.PutIfAbsentArgs) */ {
+ public:
+  inline PutIfAbsentArgs() : PutIfAbsentArgs(nullptr) {}
+  ~PutIfAbsentArgs() override;
+  explicit PROTOBUF_CONSTEXPR PutIfAbsentArgs(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PutIfAbsentArgs(const PutIfAbsentArgs& from);
+  PutIfAbsentArgs(PutIfAbsentArgs&& from) noexcept
+    : PutIfAbsentArgs() {
+    *this = ::std::move(from);
+  }
+
+  inline PutIfAbsentArgs& operator=(const PutIfAbsentArgs& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PutIfAbsentArgs& operator=(PutIfAbsentArgs&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PutIfAbsentArgs& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PutIfAbsentArgs* internal_default_instance() {
+    return reinterpret_cast<const PutIfAbsentArgs*>(
+               &_PutIfAbsentArgs_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    14;
+
+  friend void swap(PutIfAbsentArgs& a, PutIfAbsentArgs& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PutIfAbsentArgs* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PutIfAbsentArgs* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PutIfAbsentArgs* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PutIfAbsentArgs>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PutIfAbsentArgs& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PutIfAbsentArgs& from) {
+    PutIfAbsentArgs::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PutIfAbsentArgs* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftKVRpcProctoc.PutIfAbsentArgs";
+  }
+  protected:
+  explicit PutIfAbsentArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKeyFieldNumber = 1,
+    kValueFieldNumber = 2,
+    kClientIdFieldNumber = 3,
+    kRequestIdFieldNumber = 4,
+  };
+  // bytes Key = 1;
+  void clear_key();
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
+  private:
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
+  public:
+
+  // bytes Value = 2;
+  void clear_value();
+  const std::string& value() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_value();
+  PROTOBUF_NODISCARD std::string* release_value();
+  void set_allocated_value(std::string* value);
+  private:
+  const std::string& _internal_value() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
+  std::string* _internal_mutable_value();
+  public:
+
+  // uint64 ClientId = 3;
+  void clear_clientid();
+  uint64_t clientid() const;
+  void set_clientid(uint64_t value);
+  private:
+  uint64_t _internal_clientid() const;
+  void _internal_set_clientid(uint64_t value);
+  public:
+
+  // int32 RequestId = 4;
+  void clear_requestid();
+  int32_t requestid() const;
+  void set_requestid(int32_t value);
+  private:
+  int32_t _internal_requestid() const;
+  void _internal_set_requestid(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftKVRpcProctoc.PutIfAbsentArgs)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+    uint64_t clientid_;
+    int32_t requestid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvServerRPC_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PutIfAbsentReply final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.PutIfAbsentReply) */ {
+ public:
+  inline PutIfAbsentReply() : PutIfAbsentReply(nullptr) {}
+  ~PutIfAbsentReply() override;
+  explicit PROTOBUF_CONSTEXPR PutIfAbsentReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PutIfAbsentReply(const PutIfAbsentReply& from);
+  PutIfAbsentReply(PutIfAbsentReply&& from) noexcept
+    : PutIfAbsentReply() {
+    *this = ::std::move(from);
+  }
+
+  inline PutIfAbsentReply& operator=(const PutIfAbsentReply& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PutIfAbsentReply& operator=(PutIfAbsentReply&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PutIfAbsentReply& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PutIfAbsentReply* internal_default_instance() {
+    return reinterpret_cast<const PutIfAbsentReply*>(
+               &_PutIfAbsentReply_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    15;
+
+  friend void swap(PutIfAbsentReply& a, PutIfAbsentReply& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PutIfAbsentReply* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PutIfAbsentReply* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PutIfAbsentReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PutIfAbsentReply>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PutIfAbsentReply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PutIfAbsentReply& from) {
+    PutIfAbsentReply::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PutIfAbsentReply* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftKVRpcProctoc.PutIfAbsentReply";
+  }
+  protected:
+  explicit PutIfAbsentReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kErrFieldNumber = 1,
+    kCurrentFieldNumber = 3,
+    kSucceededFieldNumber = 2,
+  };
+  // bytes Err = 1;
+  void clear_err();
+  const std::string& err() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_err(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_err();
+  PROTOBUF_NODISCARD std::string* release_err();
+  void set_allocated_err(std::string* err);
+  private:
+  const std::string& _internal_err() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_err(const std::string& value);
+  std::string* _internal_mutable_err();
+  public:
+
+  // bytes Current = 3;
+  void clear_current();
+  const std::string& current() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_current(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_current();
+  PROTOBUF_NODISCARD std::string* release_current();
+  void set_allocated_current(std::string* current);
+  private:
+  const std::string& _internal_current() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_current(const std::string& value);
+  std::string* _internal_mutable_current();
+  public:
+
+  // bool Succeeded = 2;
+  void clear_succeeded();
+  bool succeeded() const;
+  void set_succeeded(bool value);
+  private:
+  bool _internal_succeeded() const;
+  void _internal_set_succeeded(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftKVRpcProctoc.PutIfAbsentReply)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr err_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr current_;
+    bool succeeded_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvServerRPC_2eproto;
+};
+// -------------------------------------------------------------------
+
+class DeleteArgs final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.DeleteArgs) */ {
+ public:
+  inline DeleteArgs() : DeleteArgs(nullptr) {}
+  ~DeleteArgs() override;
+  explicit PROTOBUF_CONSTEXPR DeleteArgs(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  DeleteArgs(const DeleteArgs& from);
+  DeleteArgs(DeleteArgs&& from) noexcept
+    : DeleteArgs() {
+    *this = ::std::move(from);
+  }
+
+  inline DeleteArgs& operator=(const DeleteArgs& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline DeleteArgs& operator=(DeleteArgs&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const DeleteArgs& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const DeleteArgs* internal_default_instance() {
+    return reinterpret_cast<const DeleteArgs*>(
+               &_DeleteArgs_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    16;
+
+  friend void swap(DeleteArgs& a, DeleteArgs& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(DeleteArgs* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(DeleteArgs* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  DeleteArgs* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<DeleteArgs>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const DeleteArgs& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const DeleteArgs& from) {
+    DeleteArgs::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(DeleteArgs* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftKVRpcProctoc.DeleteArgs";
+  }
+  protected:
+  explicit DeleteArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKeyFieldNumber = 1,
+    kClientIdFieldNumber = 2,
+    kRequestIdFieldNumber = 3,
+  };
+  // bytes Key = 1;
+  void clear_key();
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
+  private:
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
+  public:
+
+  // uint64 ClientId = 2;
+  void clear_clientid();
+  uint64_t clientid() const;
+  void set_clientid(uint64_t value);
+  private:
+  uint64_t _internal_clientid() const;
+  void _internal_set_clientid(uint64_t value);
+  public:
+
+  // int32 RequestId = 3;
+  void clear_requestid();
+  int32_t requestid() const;
+  void set_requestid(int32_t value);
+  private:
+  int32_t _internal_requestid() const;
+  void _internal_set_requestid(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftKVRpcProctoc.DeleteArgs)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    uint64_t clientid_;
+    int32_t requestid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvServerRPC_2eproto;
+};
+// -------------------------------------------------------------------
+
+class DeleteReply final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.DeleteReply) */ {
+ public:
+  inline DeleteReply() : DeleteReply(nullptr) {}
+  ~DeleteReply() override;
+  explicit PROTOBUF_CONSTEXPR DeleteReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  DeleteReply(const DeleteReply& from);
+  DeleteReply(DeleteReply&& from) noexcept
+    : DeleteReply() {
+    *this = ::std::move(from);
+  }
+
+  inline DeleteReply& operator=(const DeleteReply& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline DeleteReply& operator=(DeleteReply&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const DeleteReply& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const DeleteReply* internal_default_instance() {
+    return reinterpret_cast<const DeleteReply*>(
+               &_DeleteReply_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    17;
+
+  friend void swap(DeleteReply& a, DeleteReply& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(DeleteReply* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(DeleteReply* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  DeleteReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<DeleteReply>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const DeleteReply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const DeleteReply& from) {
+    DeleteReply::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(DeleteReply* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftKVRpcProctoc.DeleteReply";
+  }
+  protected:
+  explicit DeleteReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kErrFieldNumber = 1,
+    kDeletedFieldNumber = 2,
+  };
+  // bytes Err = 1;
+  void clear_err();
+  const std::string& err() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_err(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_err();
+  PROTOBUF_NODISCARD std::string* release_err();
+  void set_allocated_err(std::string* err);
+  private:
+  const std::string& _internal_err() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_err(const std::string& value);
+  std::string* _internal_mutable_err();
+  public:
+
+  // bool Deleted = 2;
+  void clear_deleted();
+  bool deleted() const;
+  void set_deleted(bool value);
+  private:
+  bool _internal_deleted() const;
+  void _internal_set_deleted(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftKVRpcProctoc.DeleteReply)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr err_;
+    bool deleted_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvServerRPC_2eproto;
+};
+// -------------------------------------------------------------------
+
+class WatchArgs final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.WatchArgs) */ {
+ public:
+  inline WatchArgs() : WatchArgs(nullptr) {}
+  ~WatchArgs() override;
+  explicit PROTOBUF_CONSTEXPR WatchArgs(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  WatchArgs(const WatchArgs& from);
+  WatchArgs(WatchArgs&& from) noexcept
+    : WatchArgs() {
+    *this = ::std::move(from);
+  }
+
+  inline WatchArgs& operator=(const WatchArgs& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline WatchArgs& operator=(WatchArgs&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const WatchArgs& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const WatchArgs* internal_default_instance() {
+    return reinterpret_cast<const WatchArgs*>(
+               &_WatchArgs_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    18;
+
+  friend void swap(WatchArgs& a, WatchArgs& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(WatchArgs* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(WatchArgs* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  WatchArgs* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<WatchArgs>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const WatchArgs& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const WatchArgs& from) {
+    WatchArgs::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(WatchArgs* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftKVRpcProctoc.WatchArgs";
+  }
+  protected:
+  explicit WatchArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKeyFieldNumber = 1,
+    kFromRevisionFieldNumber = 3,
+    kPrefixFieldNumber = 2,
+  };
+  // bytes Key = 1;
+  void clear_key();
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
+  private:
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
+  public:
+
+  // int64 FromRevision = 3;
+  void clear_fromrevision();
+  int64_t fromrevision() const;
+  void set_fromrevision(int64_t value);
+  private:
+  int64_t _internal_fromrevision() const;
+  void _internal_set_fromrevision(int64_t value);
+  public:
+
+  // bool Prefix = 2;
+  void clear_prefix();
+  bool prefix() const;
+  void set_prefix(bool value);
+  private:
+  bool _internal_prefix() const;
+  void _internal_set_prefix(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftKVRpcProctoc.WatchArgs)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    int64_t fromrevision_;
+    bool prefix_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvServerRPC_2eproto;
+};
+// -------------------------------------------------------------------
+
+class WatchEvent final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.WatchEvent) */ {
+ public:
+  inline WatchEvent() : WatchEvent(nullptr) {}
+  ~WatchEvent() override;
+  explicit PROTOBUF_CONSTEXPR WatchEvent(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  WatchEvent(const WatchEvent& from);
+  WatchEvent(WatchEvent&& from) noexcept
+    : WatchEvent() {
+    *this = ::std::move(from);
+  }
+
+  inline WatchEvent& operator=(const WatchEvent& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline WatchEvent& operator=(WatchEvent&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const WatchEvent& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const WatchEvent* internal_default_instance() {
+    return reinterpret_cast<const WatchEvent*>(
+               &_WatchEvent_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    19;
+
+  friend void swap(WatchEvent& a, WatchEvent& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(WatchEvent* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(WatchEvent* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  WatchEvent* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<WatchEvent>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const WatchEvent& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const WatchEvent& from) {
+    WatchEvent::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(WatchEvent* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftKVRpcProctoc.WatchEvent";
+  }
+  protected:
+  explicit WatchEvent(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef WatchEvent_Type Type;
+  static constexpr Type PUT =
+    WatchEvent_Type_PUT;
+  static constexpr Type DELETE =
+    WatchEvent_Type_DELETE;
+  static constexpr Type APPEND =
+    WatchEvent_Type_APPEND;
+  static inline bool Type_IsValid(int value) {
+    return WatchEvent_Type_IsValid(value);
+  }
+  static constexpr Type Type_MIN =
+    WatchEvent_Type_Type_MIN;
+  static constexpr Type Type_MAX =
+    WatchEvent_Type_Type_MAX;
+  static constexpr int Type_ARRAYSIZE =
+    WatchEvent_Type_Type_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  Type_descriptor() {
+    return WatchEvent_Type_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& Type_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, Type>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function Type_Name.");
+    return WatchEvent_Type_Name(enum_t_value);
+  }
+  static inline bool Type_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      Type* value) {
+    return WatchEvent_Type_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKeyFieldNumber = 2,
+    kValueFieldNumber = 3,
+    kRevisionFieldNumber = 4,
+    kEventTypeFieldNumber = 1,
+  };
+  // bytes Key = 2;
+  void clear_key();
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
+  private:
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
+  public:
+
+  // bytes Value = 3;
+  void clear_value();
+  const std::string& value() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_value();
+  PROTOBUF_NODISCARD std::string* release_value();
+  void set_allocated_value(std::string* value);
+  private:
+  const std::string& _internal_value() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
+  std::string* _internal_mutable_value();
+  public:
+
+  // int64 Revision = 4;
+  void clear_revision();
+  int64_t revision() const;
+  void set_revision(int64_t value);
+  private:
+  int64_t _internal_revision() const;
+  void _internal_set_revision(int64_t value);
+  public:
+
+  // .raftKVRpcProctoc.WatchEvent.Type EventType = 1;
+  void clear_eventtype();
+  ::raftKVRpcProctoc::WatchEvent_Type eventtype() const;
+  void set_eventtype(::raftKVRpcProctoc::WatchEvent_Type value);
+  private:
+  ::raftKVRpcProctoc::WatchEvent_Type _internal_eventtype() const;
+  void _internal_set_eventtype(::raftKVRpcProctoc::WatchEvent_Type value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftKVRpcProctoc.WatchEvent)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+    int64_t revision_;
+    int eventtype_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvServerRPC_2eproto;
+};
+// -------------------------------------------------------------------
+
+class WatchReply final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.WatchReply) */ {
+ public:
+  inline WatchReply() : WatchReply(nullptr) {}
+  ~WatchReply() override;
+  explicit PROTOBUF_CONSTEXPR WatchReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  WatchReply(const WatchReply& from);
+  WatchReply(WatchReply&& from) noexcept
+    : WatchReply() {
+    *this = ::std::move(from);
+  }
+
+  inline WatchReply& operator=(const WatchReply& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline WatchReply& operator=(WatchReply&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const WatchReply& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const WatchReply* internal_default_instance() {
+    return reinterpret_cast<const WatchReply*>(
+               &_WatchReply_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    20;
+
+  friend void swap(WatchReply& a, WatchReply& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(WatchReply* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(WatchReply* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  WatchReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<WatchReply>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const WatchReply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const WatchReply& from) {
+    WatchReply::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(WatchReply* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftKVRpcProctoc.WatchReply";
+  }
+  protected:
+  explicit WatchReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kEventsFieldNumber = 2,
+    kErrFieldNumber = 1,
+    kNextRevisionFieldNumber = 3,
+  };
+  // repeated .raftKVRpcProctoc.WatchEvent Events = 2;
+  int events_size() const;
+  private:
+  int _internal_events_size() const;
+  public:
+  void clear_events();
+  ::raftKVRpcProctoc::WatchEvent* mutable_events(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::WatchEvent >*
+      mutable_events();
+  private:
+  const ::raftKVRpcProctoc::WatchEvent& _internal_events(int index) const;
+  ::raftKVRpcProctoc::WatchEvent* _internal_add_events();
+  public:
+  const ::raftKVRpcProctoc::WatchEvent& events(int index) const;
+  ::raftKVRpcProctoc::WatchEvent* add_events();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::WatchEvent >&
+      events() const;
+
+  // bytes Err = 1;
+  void clear_err();
+  const std::string& err() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_err(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_err();
+  PROTOBUF_NODISCARD std::string* release_err();
+  void set_allocated_err(std::string* err);
+  private:
+  const std::string& _internal_err() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_err(const std::string& value);
+  std::string* _internal_mutable_err();
+  public:
+
+  // int64 NextRevision = 3;
+  void clear_nextrevision();
+  int64_t nextrevision() const;
+  void set_nextrevision(int64_t value);
+  private:
+  int64_t _internal_nextrevision() const;
+  void _internal_set_nextrevision(int64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftKVRpcProctoc.WatchReply)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::WatchEvent > events_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr err_;
+    int64_t nextrevision_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvServerRPC_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TxnCompare final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.TxnCompare) */ {
+ public:
+  inline TxnCompare() : TxnCompare(nullptr) {}
+  ~TxnCompare() override;
+  explicit PROTOBUF_CONSTEXPR TxnCompare(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TxnCompare(const TxnCompare& from);
+  TxnCompare(TxnCompare&& from) noexcept
+    : TxnCompare() {
+    *this = ::std::move(from);
+  }
+
+  inline TxnCompare& operator=(const TxnCompare& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TxnCompare& operator=(TxnCompare&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TxnCompare& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TxnCompare* internal_default_instance() {
+    return reinterpret_cast<const TxnCompare*>(
+               &_TxnCompare_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    21;
+
+  friend void swap(TxnCompare& a, TxnCompare& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TxnCompare* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TxnCompare* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TxnCompare* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TxnCompare>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TxnCompare& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TxnCompare& from) {
+    TxnCompare::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TxnCompare* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftKVRpcProctoc.TxnCompare";
+  }
+  protected:
+  explicit TxnCompare(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef TxnCompare_Result Result;
+  static constexpr Result EQUAL =
+    TxnCompare_Result_EQUAL;
+  static constexpr Result NOT_EQUAL =
+    TxnCompare_Result_NOT_EQUAL;
+  static constexpr Result LESS =
+    TxnCompare_Result_LESS;
+  static constexpr Result GREATER =
+    TxnCompare_Result_GREATER;
+  static constexpr Result EXISTS =
+    TxnCompare_Result_EXISTS;
+  static constexpr Result NOT_EXISTS =
+    TxnCompare_Result_NOT_EXISTS;
+  static inline bool Result_IsValid(int value) {
+    return TxnCompare_Result_IsValid(value);
+  }
+  static constexpr Result Result_MIN =
+    TxnCompare_Result_Result_MIN;
+  static constexpr Result Result_MAX =
+    TxnCompare_Result_Result_MAX;
+  static constexpr int Result_ARRAYSIZE =
+    TxnCompare_Result_Result_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  Result_descriptor() {
+    return TxnCompare_Result_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& Result_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, Result>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function Result_Name.");
+    return TxnCompare_Result_Name(enum_t_value);
+  }
+  static inline bool Result_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      Result* value) {
+    return TxnCompare_Result_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKeyFieldNumber = 1,
+    kValueFieldNumber = 3,
+    kCmpFieldNumber = 2,
+  };
+  // bytes Key = 1;
+  void clear_key();
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
+  private:
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
+  public:
+
+  // bytes Value = 3;
+  void clear_value();
+  const std::string& value() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_value();
+  PROTOBUF_NODISCARD std::string* release_value();
+  void set_allocated_value(std::string* value);
+  private:
+  const std::string& _internal_value() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
+  std::string* _internal_mutable_value();
+  public:
+
+  // .raftKVRpcProctoc.TxnCompare.Result Cmp = 2;
+  void clear_cmp();
+  ::raftKVRpcProctoc::TxnCompare_Result cmp() const;
+  void set_cmp(::raftKVRpcProctoc::TxnCompare_Result value);
+  private:
+  ::raftKVRpcProctoc::TxnCompare_Result _internal_cmp() const;
+  void _internal_set_cmp(::raftKVRpcProctoc::TxnCompare_Result value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftKVRpcProctoc.TxnCompare)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+    int cmp_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvServerRPC_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TxnOp final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.TxnOp) */ {
+ public:
+  inline TxnOp() : TxnOp(nullptr) {}
+  ~TxnOp() override;
+  explicit PROTOBUF_CONSTEXPR TxnOp(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TxnOp(const TxnOp& from);
+  TxnOp(TxnOp&& from) noexcept
+    : TxnOp() {
+    *this = ::std::move(from);
+  }
+
+  inline TxnOp& operator=(const TxnOp& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TxnOp& operator=(TxnOp&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TxnOp& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TxnOp* internal_default_instance() {
+    return reinterpret_cast<const TxnOp*>(
+               &_TxnOp_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    22;
+
+  friend void swap(TxnOp& a, TxnOp& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TxnOp* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TxnOp* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TxnOp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TxnOp>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TxnOp& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TxnOp& from) {
+    TxnOp::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TxnOp* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftKVRpcProctoc.TxnOp";
+  }
+  protected:
+  explicit TxnOp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef TxnOp_Type Type;
+  static constexpr Type PUT =
+    TxnOp_Type_PUT;
+  static constexpr Type DELETE =
+    TxnOp_Type_DELETE;
+  static constexpr Type GET =
+    TxnOp_Type_GET;
+  static inline bool Type_IsValid(int value) {
+    return TxnOp_Type_IsValid(value);
+  }
+  static constexpr Type Type_MIN =
+    TxnOp_Type_Type_MIN;
+  static constexpr Type Type_MAX =
+    TxnOp_Type_Type_MAX;
+  static constexpr int Type_ARRAYSIZE =
+    TxnOp_Type_Type_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  Type_descriptor() {
+    return TxnOp_Type_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& Type_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, Type>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function Type_Name.");
+    return TxnOp_Type_Name(enum_t_value);
+  }
+  static inline bool Type_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      Type* value) {
+    return TxnOp_Type_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKeyFieldNumber = 2,
+    kValueFieldNumber = 3,
+    kOpTypeFieldNumber = 1,
+  };
+  // bytes Key = 2;
+  void clear_key();
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
+  private:
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
+  public:
+
+  // bytes Value = 3;
+  void clear_value();
+  const std::string& value() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_value();
+  PROTOBUF_NODISCARD std::string* release_value();
+  void set_allocated_value(std::string* value);
+  private:
+  const std::string& _internal_value() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
+  std::string* _internal_mutable_value();
+  public:
+
+  // .raftKVRpcProctoc.TxnOp.Type OpType = 1;
+  void clear_optype();
+  ::raftKVRpcProctoc::TxnOp_Type optype() const;
+  void set_optype(::raftKVRpcProctoc::TxnOp_Type value);
+  private:
+  ::raftKVRpcProctoc::TxnOp_Type _internal_optype() const;
+  void _internal_set_optype(::raftKVRpcProctoc::TxnOp_Type value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftKVRpcProctoc.TxnOp)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+    int optype_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvServerRPC_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TxnArgs final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.TxnArgs) */ {
+ public:
+  inline TxnArgs() : TxnArgs(nullptr) {}
+  ~TxnArgs() override;
+  explicit PROTOBUF_CONSTEXPR TxnArgs(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TxnArgs(const TxnArgs& from);
+  TxnArgs(TxnArgs&& from) noexcept
+    : TxnArgs() {
+    *this = ::std::move(from);
+  }
+
+  inline TxnArgs& operator=(const TxnArgs& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TxnArgs& operator=(TxnArgs&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TxnArgs& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TxnArgs* internal_default_instance() {
+    return reinterpret_cast<const TxnArgs*>(
+               &_TxnArgs_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    23;
+
+  friend void swap(TxnArgs& a, TxnArgs& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TxnArgs* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TxnArgs* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TxnArgs* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TxnArgs>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TxnArgs& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TxnArgs& from) {
+    TxnArgs::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TxnArgs* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftKVRpcProctoc.TxnArgs";
+  }
+  protected:
+  explicit TxnArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kComparesFieldNumber = 1,
+    kSuccessFieldNumber = 2,
+    kFailureFieldNumber = 3,
+    kClientIdFieldNumber = 4,
+    kRequestIdFieldNumber = 5,
+  };
+  // repeated .raftKVRpcProctoc.TxnCompare Compares = 1;
+  int compares_size() const;
+  private:
+  int _internal_compares_size() const;
+  public:
+  void clear_compares();
+  ::raftKVRpcProctoc::TxnCompare* mutable_compares(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::TxnCompare >*
+      mutable_compares();
+  private:
+  const ::raftKVRpcProctoc::TxnCompare& _internal_compares(int index) const;
+  ::raftKVRpcProctoc::TxnCompare* _internal_add_compares();
+  public:
+  const ::raftKVRpcProctoc::TxnCompare& compares(int index) const;
+  ::raftKVRpcProctoc::TxnCompare* add_compares();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::TxnCompare >&
+      compares() const;
+
+  // repeated .raftKVRpcProctoc.TxnOp Success = 2;
+  int success_size() const;
+  private:
+  int _internal_success_size() const;
+  public:
+  void clear_success();
+  ::raftKVRpcProctoc::TxnOp* mutable_success(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::TxnOp >*
+      mutable_success();
+  private:
+  const ::raftKVRpcProctoc::TxnOp& _internal_success(int index) const;
+  ::raftKVRpcProctoc::TxnOp* _internal_add_success();
+  public:
+  const ::raftKVRpcProctoc::TxnOp& success(int index) const;
+  ::raftKVRpcProctoc::TxnOp* add_success();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::TxnOp >&
+      success() const;
+
+  // repeated .raftKVRpcProctoc.TxnOp Failure = 3;
+  int failure_size() const;
+  private:
+  int _internal_failure_size() const;
+  public:
+  void clear_failure();
+  ::raftKVRpcProctoc::TxnOp* mutable_failure(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::TxnOp >*
+      mutable_failure();
+  private:
+  const ::raftKVRpcProctoc::TxnOp& _internal_failure(int index) const;
+  ::raftKVRpcProctoc::TxnOp* _internal_add_failure();
+  public:
+  const ::raftKVRpcProctoc::TxnOp& failure(int index) const;
+  ::raftKVRpcProctoc::TxnOp* add_failure();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::TxnOp >&
+      failure() const;
+
+  // uint64 ClientId = 4;
+  void clear_clientid();
+  uint64_t clientid() const;
+  void set_clientid(uint64_t value);
+  private:
+  uint64_t _internal_clientid() const;
+  void _internal_set_clientid(uint64_t value);
+  public:
+
+  // int32 RequestId = 5;
+  void clear_requestid();
+  int32_t requestid() const;
+  void set_requestid(int32_t value);
+  private:
+  int32_t _internal_requestid() const;
+  void _internal_set_requestid(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftKVRpcProctoc.TxnArgs)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::TxnCompare > compares_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::TxnOp > success_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::TxnOp > failure_;
+    uint64_t clientid_;
+    int32_t requestid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvServerRPC_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TxnResult final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.TxnResult) */ {
+ public:
+  inline TxnResult() : TxnResult(nullptr) {}
+  ~TxnResult() override;
+  explicit PROTOBUF_CONSTEXPR TxnResult(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TxnResult(const TxnResult& from);
+  TxnResult(TxnResult&& from) noexcept
+    : TxnResult() {
+    *this = ::std::move(from);
+  }
+
+  inline TxnResult& operator=(const TxnResult& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TxnResult& operator=(TxnResult&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TxnResult& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TxnResult* internal_default_instance() {
+    return reinterpret_cast<const TxnResult*>(
+               &_TxnResult_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    24;
+
+  friend void swap(TxnResult& a, TxnResult& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TxnResult* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TxnResult* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TxnResult* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TxnResult>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TxnResult& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TxnResult& from) {
+    TxnResult::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TxnResult* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftKVRpcProctoc.TxnResult";
+  }
+  protected:
+  explicit TxnResult(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kValueFieldNumber = 2,
+    kExistsFieldNumber = 1,
+  };
+  // bytes Value = 2;
+  void clear_value();
+  const std::string& value() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_value();
+  PROTOBUF_NODISCARD std::string* release_value();
+  void set_allocated_value(std::string* value);
+  private:
+  const std::string& _internal_value() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
+  std::string* _internal_mutable_value();
+  public:
+
+  // bool Exists = 1;
+  void clear_exists();
+  bool exists() const;
+  void set_exists(bool value);
+  private:
+  bool _internal_exists() const;
+  void _internal_set_exists(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftKVRpcProctoc.TxnResult)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+    bool exists_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvServerRPC_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TxnReply final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.TxnReply) */ {
+ public:
+  inline TxnReply() : TxnReply(nullptr) {}
+  ~TxnReply() override;
+  explicit PROTOBUF_CONSTEXPR TxnReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TxnReply(const TxnReply& from);
+  TxnReply(TxnReply&& from) noexcept
+    : TxnReply() {
+    *this = ::std::move(from);
+  }
+
+  inline TxnReply& operator=(const TxnReply& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TxnReply& operator=(TxnReply&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TxnReply& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TxnReply* internal_default_instance() {
+    return reinterpret_cast<const TxnReply*>(
+               &_TxnReply_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    25;
+
+  friend void swap(TxnReply& a, TxnReply& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TxnReply* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TxnReply* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TxnReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TxnReply>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TxnReply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TxnReply& from) {
+    TxnReply::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TxnReply* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftKVRpcProctoc.TxnReply";
+  }
+  protected:
+  explicit TxnReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kResultsFieldNumber = 3,
+    kErrFieldNumber = 1,
+    kSucceededFieldNumber = 2,
+  };
+  // repeated .raftKVRpcProctoc.TxnResult Results = 3;
+  int results_size() const;
+  private:
+  int _internal_results_size() const;
+  public:
+  void clear_results();
+  ::raftKVRpcProctoc::TxnResult* mutable_results(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::TxnResult >*
+      mutable_results();
+  private:
+  const ::raftKVRpcProctoc::TxnResult& _internal_results(int index) const;
+  ::raftKVRpcProctoc::TxnResult* _internal_add_results();
+  public:
+  const ::raftKVRpcProctoc::TxnResult& results(int index) const;
+  ::raftKVRpcProctoc::TxnResult* add_results();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::TxnResult >&
+      results() const;
+
+  // bytes Err = 1;
+  void clear_err();
+  const std::string& err() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_err(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_err();
+  PROTOBUF_NODISCARD std::string* release_err();
+  void set_allocated_err(std::string* err);
+  private:
+  const std::string& _internal_err() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_err(const std::string& value);
+  std::string* _internal_mutable_err();
+  public:
+
+  // bool Succeeded = 2;
+  void clear_succeeded();
+  bool succeeded() const;
+  void set_succeeded(bool value);
+  private:
+  bool _internal_succeeded() const;
+  void _internal_set_succeeded(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftKVRpcProctoc.TxnReply)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::TxnResult > results_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr err_;
+    bool succeeded_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvServerRPC_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RegisterSessionArgs final :
+    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.RegisterSessionArgs) */ {
+ public:
+  inline RegisterSessionArgs() : RegisterSessionArgs(nullptr) {}
+  explicit PROTOBUF_CONSTEXPR RegisterSessionArgs(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RegisterSessionArgs(const RegisterSessionArgs& from);
+  RegisterSessionArgs(RegisterSessionArgs&& from) noexcept
+    : RegisterSessionArgs() {
+    *this = ::std::move(from);
+  }
+
+  inline RegisterSessionArgs& operator=(const RegisterSessionArgs& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RegisterSessionArgs& operator=(RegisterSessionArgs&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RegisterSessionArgs& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RegisterSessionArgs* internal_default_instance() {
+    return reinterpret_cast<const RegisterSessionArgs*>(
+               &_RegisterSessionArgs_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    26;
+
+  friend void swap(RegisterSessionArgs& a, RegisterSessionArgs& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RegisterSessionArgs* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RegisterSessionArgs* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RegisterSessionArgs* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RegisterSessionArgs>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const RegisterSessionArgs& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const RegisterSessionArgs& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftKVRpcProctoc.RegisterSessionArgs";
+  }
+  protected:
+  explicit RegisterSessionArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // @@protoc_insertion_point(class_scope:raftKVRpcProctoc.RegisterSessionArgs)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+  };
+  friend struct ::TableStruct_kvServerRPC_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RegisterSessionReply final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.RegisterSessionReply) */ {
+ public:
+  inline RegisterSessionReply() : RegisterSessionReply(nullptr) {}
+  ~RegisterSessionReply() override;
+  explicit PROTOBUF_CONSTEXPR RegisterSessionReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RegisterSessionReply(const RegisterSessionReply& from);
+  RegisterSessionReply(RegisterSessionReply&& from) noexcept
+    : RegisterSessionReply() {
+    *this = ::std::move(from);
+  }
+
+  inline RegisterSessionReply& operator=(const RegisterSessionReply& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RegisterSessionReply& operator=(RegisterSessionReply&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RegisterSessionReply& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RegisterSessionReply* internal_default_instance() {
+    return reinterpret_cast<const RegisterSessionReply*>(
+               &_RegisterSessionReply_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    27;
+
+  friend void swap(RegisterSessionReply& a, RegisterSessionReply& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RegisterSessionReply* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RegisterSessionReply* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RegisterSessionReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RegisterSessionReply>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RegisterSessionReply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RegisterSessionReply& from) {
+    RegisterSessionReply::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RegisterSessionReply* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftKVRpcProctoc.RegisterSessionReply";
+  }
+  protected:
+  explicit RegisterSessionReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kErrFieldNumber = 1,
+    kClientIdFieldNumber = 2,
+  };
+  // bytes Err = 1;
+  void clear_err();
+  const std::string& err() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_err(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_err();
+  PROTOBUF_NODISCARD std::string* release_err();
+  void set_allocated_err(std::string* err);
+  private:
+  const std::string& _internal_err() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_err(const std::string& value);
+  std::string* _internal_mutable_err();
+  public:
+
+  // uint64 ClientId = 2;
+  void clear_clientid();
+  uint64_t clientid() const;
+  void set_clientid(uint64_t value);
+  private:
+  uint64_t _internal_clientid() const;
+  void _internal_set_clientid(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftKVRpcProctoc.RegisterSessionReply)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr err_;
+    uint64_t clientid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvServerRPC_2eproto;
+};
+// ===================================================================
+
+class kvServerRpc_Stub;
+
+class kvServerRpc : public ::PROTOBUF_NAMESPACE_ID::Service {
+ protected:
+  // This class should be treated as an abstract interface.
+  inline kvServerRpc() {};
+ public:
+  virtual ~kvServerRpc();
+
+  typedef kvServerRpc_Stub Stub;
+
+  static const ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor* descriptor();
+
+  virtual void PutAppend(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftKVRpcProctoc::PutAppendArgs* request,
+                       ::raftKVRpcProctoc::PutAppendReply* response,
+                       ::google::protobuf::Closure* done);
+  virtual void Get(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftKVRpcProctoc::GetArgs* request,
+                       ::raftKVRpcProctoc::GetReply* response,
+                       ::google::protobuf::Closure* done);
+  virtual void MultiGet(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftKVRpcProctoc::MultiGetArgs* request,
+                       ::raftKVRpcProctoc::MultiGetReply* response,
+                       ::google::protobuf::Closure* done);
+  virtual void MultiPut(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftKVRpcProctoc::MultiPutArgs* request,
+                       ::raftKVRpcProctoc::MultiPutReply* response,
+                       ::google::protobuf::Closure* done);
+  virtual void RegisterSession(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftKVRpcProctoc::RegisterSessionArgs* request,
+                       ::raftKVRpcProctoc::RegisterSessionReply* response,
+                       ::google::protobuf::Closure* done);
+  virtual void Scan(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftKVRpcProctoc::ScanArgs* request,
+                       ::raftKVRpcProctoc::ScanReply* response,
+                       ::google::protobuf::Closure* done);
+  virtual void CompareAndSwap(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftKVRpcProctoc::CompareAndSwapArgs* request,
+                       ::raftKVRpcProctoc::CompareAndSwapReply* response,
+                       ::google::protobuf::Closure* done);
+  virtual void Increment(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftKVRpcProctoc::IncrementArgs* request,
+                       ::raftKVRpcProctoc::IncrementReply* response,
+                       ::google::protobuf::Closure* done);
+  virtual void PutIfAbsent(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftKVRpcProctoc::PutIfAbsentArgs* request,
+                       ::raftKVRpcProctoc::PutIfAbsentReply* response,
+                       ::google::protobuf::Closure* done);
+  virtual void Txn(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftKVRpcProctoc::TxnArgs* request,
+                       ::raftKVRpcProctoc::TxnReply* response,
+                       ::google::protobuf::Closure* done);
+  virtual void Delete(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftKVRpcProctoc::DeleteArgs* request,
+                       ::raftKVRpcProctoc::DeleteReply* response,
+                       ::google::protobuf::Closure* done);
+  virtual void Watch(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftKVRpcProctoc::WatchArgs* request,
+                       ::raftKVRpcProctoc::WatchReply* response,
+                       ::google::protobuf::Closure* done);
+
+  // implements Service ----------------------------------------------
+
+  const ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor* GetDescriptor();
+  void CallMethod(const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method,
+                  ::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                  const ::PROTOBUF_NAMESPACE_ID::Message* request,
+                  ::PROTOBUF_NAMESPACE_ID::Message* response,
+                  ::google::protobuf::Closure* done);
+  const ::PROTOBUF_NAMESPACE_ID::Message& GetRequestPrototype(
+    const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method) const;
+  const ::PROTOBUF_NAMESPACE_ID::Message& GetResponsePrototype(
+    const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method) const;
+
+ private:
+  GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(kvServerRpc);
+};
+
+class kvServerRpc_Stub : public kvServerRpc {
+ public:
+  kvServerRpc_Stub(::PROTOBUF_NAMESPACE_ID::RpcChannel* channel);
+  kvServerRpc_Stub(::PROTOBUF_NAMESPACE_ID::RpcChannel* channel,
+                   ::PROTOBUF_NAMESPACE_ID::Service::ChannelOwnership ownership);
+  ~kvServerRpc_Stub();
+
+  inline ::PROTOBUF_NAMESPACE_ID::RpcChannel* channel() { return channel_; }
+
+  // implements kvServerRpc ------------------------------------------
+
+  void PutAppend(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftKVRpcProctoc::PutAppendArgs* request,
+                       ::raftKVRpcProctoc::PutAppendReply* response,
+                       ::google::protobuf::Closure* done);
+  void Get(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftKVRpcProctoc::GetArgs* request,
+                       ::raftKVRpcProctoc::GetReply* response,
+                       ::google::protobuf::Closure* done);
+  void MultiGet(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftKVRpcProctoc::MultiGetArgs* request,
+                       ::raftKVRpcProctoc::MultiGetReply* response,
+                       ::google::protobuf::Closure* done);
+  void MultiPut(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftKVRpcProctoc::MultiPutArgs* request,
+                       ::raftKVRpcProctoc::MultiPutReply* response,
+                       ::google::protobuf::Closure* done);
+  void RegisterSession(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftKVRpcProctoc::RegisterSessionArgs* request,
+                       ::raftKVRpcProctoc::RegisterSessionReply* response,
+                       ::google::protobuf::Closure* done);
+  void Scan(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftKVRpcProctoc::ScanArgs* request,
+                       ::raftKVRpcProctoc::ScanReply* response,
+                       ::google::protobuf::Closure* done);
+  void CompareAndSwap(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftKVRpcProctoc::CompareAndSwapArgs* request,
+                       ::raftKVRpcProctoc::CompareAndSwapReply* response,
+                       ::google::protobuf::Closure* done);
+  void Increment(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftKVRpcProctoc::IncrementArgs* request,
+                       ::raftKVRpcProctoc::IncrementReply* response,
+                       ::google::protobuf::Closure* done);
+  void PutIfAbsent(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftKVRpcProctoc::PutIfAbsentArgs* request,
+                       ::raftKVRpcProctoc::PutIfAbsentReply* response,
+                       ::google::protobuf::Closure* done);
+  void Txn(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftKVRpcProctoc::TxnArgs* request,
+                       ::raftKVRpcProctoc::TxnReply* response,
+                       ::google::protobuf::Closure* done);
+  void Delete(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftKVRpcProctoc::DeleteArgs* request,
+                       ::raftKVRpcProctoc::DeleteReply* response,
+                       ::google::protobuf::Closure* done);
+  void Watch(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftKVRpcProctoc::WatchArgs* request,
+                       ::raftKVRpcProctoc::WatchReply* response,
+                       ::google::protobuf::Closure* done);
+ private:
+  ::PROTOBUF_NAMESPACE_ID::RpcChannel* channel_;
+  bool owns_channel_;
+  GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(kvServerRpc_Stub);
+};
+
+
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// GetArgs
+
+// bytes Key = 1;
+inline void GetArgs::clear_key() {
+  _impl_.key_.ClearToEmpty();
+}
+inline const std::string& GetArgs::key() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.GetArgs.Key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GetArgs::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.GetArgs.Key)
+}
+inline std::string* GetArgs::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.GetArgs.Key)
+  return _s;
+}
+inline const std::string& GetArgs::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void GetArgs::_internal_set_key(const std::string& value) {
+  
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* GetArgs::_internal_mutable_key() {
+  
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* GetArgs::release_key() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.GetArgs.Key)
+  return _impl_.key_.Release();
+}
+inline void GetArgs::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.GetArgs.Key)
+}
+
+// uint64 ClientId = 2;
+inline void GetArgs::clear_clientid() {
+  _impl_.clientid_ = uint64_t{0u};
+}
+inline uint64_t GetArgs::_internal_clientid() const {
+  return _impl_.clientid_;
+}
+inline uint64_t GetArgs::clientid() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.GetArgs.ClientId)
+  return _internal_clientid();
+}
+inline void GetArgs::_internal_set_clientid(uint64_t value) {
+  
+  _impl_.clientid_ = value;
+}
+inline void GetArgs::set_clientid(uint64_t value) {
+  _internal_set_clientid(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.GetArgs.ClientId)
+}
+
+// int32 RequestId = 3;
+inline void GetArgs::clear_requestid() {
+  _impl_.requestid_ = 0;
+}
+inline int32_t GetArgs::_internal_requestid() const {
+  return _impl_.requestid_;
+}
+inline int32_t GetArgs::requestid() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.GetArgs.RequestId)
+  return _internal_requestid();
+}
+inline void GetArgs::_internal_set_requestid(int32_t value) {
+  
+  _impl_.requestid_ = value;
+}
+inline void GetArgs::set_requestid(int32_t value) {
+  _internal_set_requestid(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.GetArgs.RequestId)
+}
+
+// -------------------------------------------------------------------
+
+// GetReply
+
+// bytes Err = 1;
+inline void GetReply::clear_err() {
+  _impl_.err_.ClearToEmpty();
+}
+inline const std::string& GetReply::err() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.GetReply.Err)
+  return _internal_err();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GetReply::set_err(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.err_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.GetReply.Err)
+}
+inline std::string* GetReply::mutable_err() {
+  std::string* _s = _internal_mutable_err();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.GetReply.Err)
+  return _s;
+}
+inline const std::string& GetReply::_internal_err() const {
+  return _impl_.err_.Get();
+}
+inline void GetReply::_internal_set_err(const std::string& value) {
+  
+  _impl_.err_.Set(value, GetArenaForAllocation());
+}
+inline std::string* GetReply::_internal_mutable_err() {
+  
+  return _impl_.err_.Mutable(GetArenaForAllocation());
+}
+inline std::string* GetReply::release_err() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.GetReply.Err)
+  return _impl_.err_.Release();
+}
+inline void GetReply::set_allocated_err(std::string* err) {
+  if (err != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.err_.SetAllocated(err, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.err_.IsDefault()) {
+    _impl_.err_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.GetReply.Err)
+}
+
+// bytes Value = 2;
+inline void GetReply::clear_value() {
+  _impl_.value_.ClearToEmpty();
+}
+inline const std::string& GetReply::value() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.GetReply.Value)
+  return _internal_value();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GetReply::set_value(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.value_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.GetReply.Value)
+}
+inline std::string* GetReply::mutable_value() {
+  std::string* _s = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.GetReply.Value)
+  return _s;
+}
+inline const std::string& GetReply::_internal_value() const {
+  return _impl_.value_.Get();
+}
+inline void GetReply::_internal_set_value(const std::string& value) {
+  
+  _impl_.value_.Set(value, GetArenaForAllocation());
+}
+inline std::string* GetReply::_internal_mutable_value() {
+  
+  return _impl_.value_.Mutable(GetArenaForAllocation());
+}
+inline std::string* GetReply::release_value() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.GetReply.Value)
+  return _impl_.value_.Release();
+}
+inline void GetReply::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.GetReply.Value)
+}
+
+// -------------------------------------------------------------------
+
+// PutAppendArgs
+
+// bytes Key = 1;
+inline void PutAppendArgs::clear_key() {
+  _impl_.key_.ClearToEmpty();
+}
+inline const std::string& PutAppendArgs::key() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.PutAppendArgs.Key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PutAppendArgs::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.PutAppendArgs.Key)
+}
+inline std::string* PutAppendArgs::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.PutAppendArgs.Key)
+  return _s;
+}
+inline const std::string& PutAppendArgs::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void PutAppendArgs::_internal_set_key(const std::string& value) {
+  
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PutAppendArgs::_internal_mutable_key() {
+  
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PutAppendArgs::release_key() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.PutAppendArgs.Key)
+  return _impl_.key_.Release();
+}
+inline void PutAppendArgs::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.PutAppendArgs.Key)
+}
+
+// bytes Value = 2;
+inline void PutAppendArgs::clear_value() {
+  _impl_.value_.ClearToEmpty();
+}
+inline const std::string& PutAppendArgs::value() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.PutAppendArgs.Value)
+  return _internal_value();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PutAppendArgs::set_value(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.value_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.PutAppendArgs.Value)
+}
+inline std::string* PutAppendArgs::mutable_value() {
+  std::string* _s = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.PutAppendArgs.Value)
+  return _s;
+}
+inline const std::string& PutAppendArgs::_internal_value() const {
+  return _impl_.value_.Get();
+}
+inline void PutAppendArgs::_internal_set_value(const std::string& value) {
+  
+  _impl_.value_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PutAppendArgs::_internal_mutable_value() {
+  
+  return _impl_.value_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PutAppendArgs::release_value() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.PutAppendArgs.Value)
+  return _impl_.value_.Release();
+}
+inline void PutAppendArgs::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.PutAppendArgs.Value)
+}
+
+// bytes Op = 3;
+inline void PutAppendArgs::clear_op() {
+  _impl_.op_.ClearToEmpty();
+}
+inline const std::string& PutAppendArgs::op() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.PutAppendArgs.Op)
+  return _internal_op();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PutAppendArgs::set_op(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.op_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.PutAppendArgs.Op)
+}
+inline std::string* PutAppendArgs::mutable_op() {
+  std::string* _s = _internal_mutable_op();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.PutAppendArgs.Op)
+  return _s;
+}
+inline const std::string& PutAppendArgs::_internal_op() const {
+  return _impl_.op_.Get();
+}
+inline void PutAppendArgs::_internal_set_op(const std::string& value) {
+  
+  _impl_.op_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PutAppendArgs::_internal_mutable_op() {
+  
+  return _impl_.op_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PutAppendArgs::release_op() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.PutAppendArgs.Op)
+  return _impl_.op_.Release();
+}
+inline void PutAppendArgs::set_allocated_op(std::string* op) {
+  if (op != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.op_.SetAllocated(op, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.op_.IsDefault()) {
+    _impl_.op_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.PutAppendArgs.Op)
+}
+
+// uint64 ClientId = 4;
+inline void PutAppendArgs::clear_clientid() {
+  _impl_.clientid_ = uint64_t{0u};
+}
+inline uint64_t PutAppendArgs::_internal_clientid() const {
+  return _impl_.clientid_;
+}
+inline uint64_t PutAppendArgs::clientid() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.PutAppendArgs.ClientId)
+  return _internal_clientid();
+}
+inline void PutAppendArgs::_internal_set_clientid(uint64_t value) {
+  
+  _impl_.clientid_ = value;
+}
+inline void PutAppendArgs::set_clientid(uint64_t value) {
+  _internal_set_clientid(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.PutAppendArgs.ClientId)
+}
+
+// int32 RequestId = 5;
+inline void PutAppendArgs::clear_requestid() {
+  _impl_.requestid_ = 0;
+}
+inline int32_t PutAppendArgs::_internal_requestid() const {
+  return _impl_.requestid_;
+}
+inline int32_t PutAppendArgs::requestid() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.PutAppendArgs.RequestId)
+  return _internal_requestid();
+}
+inline void PutAppendArgs::_internal_set_requestid(int32_t value) {
+  
+  _impl_.requestid_ = value;
+}
+inline void PutAppendArgs::set_requestid(int32_t value) {
+  _internal_set_requestid(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.PutAppendArgs.RequestId)
+}
+
+// int64 TtlMs = 6;
+inline void PutAppendArgs::clear_ttlms() {
+  _impl_.ttlms_ = int64_t{0};
+}
+inline int64_t PutAppendArgs::_internal_ttlms() const {
+  return _impl_.ttlms_;
+}
+inline int64_t PutAppendArgs::ttlms() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.PutAppendArgs.TtlMs)
+  return _internal_ttlms();
+}
+inline void PutAppendArgs::_internal_set_ttlms(int64_t value) {
+  
+  _impl_.ttlms_ = value;
+}
+inline void PutAppendArgs::set_ttlms(int64_t value) {
+  _internal_set_ttlms(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.PutAppendArgs.TtlMs)
+}
+
+// -------------------------------------------------------------------
+
+// PutAppendReply
+
+// bytes Err = 1;
+inline void PutAppendReply::clear_err() {
+  _impl_.err_.ClearToEmpty();
+}
+inline const std::string& PutAppendReply::err() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.PutAppendReply.Err)
+  return _internal_err();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PutAppendReply::set_err(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.err_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.PutAppendReply.Err)
+}
+inline std::string* PutAppendReply::mutable_err() {
+  std::string* _s = _internal_mutable_err();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.PutAppendReply.Err)
+  return _s;
+}
+inline const std::string& PutAppendReply::_internal_err() const {
+  return _impl_.err_.Get();
+}
+inline void PutAppendReply::_internal_set_err(const std::string& value) {
+  
+  _impl_.err_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PutAppendReply::_internal_mutable_err() {
+  
+  return _impl_.err_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PutAppendReply::release_err() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.PutAppendReply.Err)
+  return _impl_.err_.Release();
+}
+inline void PutAppendReply::set_allocated_err(std::string* err) {
+  if (err != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.err_.SetAllocated(err, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.err_.IsDefault()) {
+    _impl_.err_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.PutAppendReply.Err)
+}
+
+// -------------------------------------------------------------------
+
+// MultiGetArgs
+
+// repeated bytes Keys = 1;
+inline int MultiGetArgs::_internal_keys_size() const {
+  return _impl_.keys_.size();
+}
+inline int MultiGetArgs::keys_size() const {
+  return _internal_keys_size();
+}
+inline void MultiGetArgs::clear_keys() {
+  _impl_.keys_.Clear();
+}
+inline std::string* MultiGetArgs::add_keys() {
+  std::string* _s = _internal_add_keys();
+  // @@protoc_insertion_point(field_add_mutable:raftKVRpcProctoc.MultiGetArgs.Keys)
+  return _s;
+}
+inline const std::string& MultiGetArgs::_internal_keys(int index) const {
+  return _impl_.keys_.Get(index);
+}
+inline const std::string& MultiGetArgs::keys(int index) const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.MultiGetArgs.Keys)
+  return _internal_keys(index);
+}
+inline std::string* MultiGetArgs::mutable_keys(int index) {
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.MultiGetArgs.Keys)
+  return _impl_.keys_.Mutable(index);
+}
+inline void MultiGetArgs::set_keys(int index, const std::string& value) {
+  _impl_.keys_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.MultiGetArgs.Keys)
+}
+inline void MultiGetArgs::set_keys(int index, std::string&& value) {
+  _impl_.keys_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.MultiGetArgs.Keys)
+}
+inline void MultiGetArgs::set_keys(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.keys_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:raftKVRpcProctoc.MultiGetArgs.Keys)
+}
+inline void MultiGetArgs::set_keys(int index, const void* value, size_t size) {
+  _impl_.keys_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:raftKVRpcProctoc.MultiGetArgs.Keys)
+}
+inline std::string* MultiGetArgs::_internal_add_keys() {
+  return _impl_.keys_.Add();
+}
+inline void MultiGetArgs::add_keys(const std::string& value) {
+  _impl_.keys_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:raftKVRpcProctoc.MultiGetArgs.Keys)
+}
+inline void MultiGetArgs::add_keys(std::string&& value) {
+  _impl_.keys_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:raftKVRpcProctoc.MultiGetArgs.Keys)
+}
+inline void MultiGetArgs::add_keys(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.keys_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:raftKVRpcProctoc.MultiGetArgs.Keys)
+}
+inline void MultiGetArgs::add_keys(const void* value, size_t size) {
+  _impl_.keys_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:raftKVRpcProctoc.MultiGetArgs.Keys)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+MultiGetArgs::keys() const {
+  // @@protoc_insertion_point(field_list:raftKVRpcProctoc.MultiGetArgs.Keys)
+  return _impl_.keys_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+MultiGetArgs::mutable_keys() {
+  // @@protoc_insertion_point(field_mutable_list:raftKVRpcProctoc.MultiGetArgs.Keys)
+  return &_impl_.keys_;
+}
+
+// uint64 ClientId = 2;
+inline void MultiGetArgs::clear_clientid() {
+  _impl_.clientid_ = uint64_t{0u};
+}
+inline uint64_t MultiGetArgs::_internal_clientid() const {
+  return _impl_.clientid_;
+}
+inline uint64_t MultiGetArgs::clientid() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.MultiGetArgs.ClientId)
+  return _internal_clientid();
+}
+inline void MultiGetArgs::_internal_set_clientid(uint64_t value) {
+  
+  _impl_.clientid_ = value;
+}
+inline void MultiGetArgs::set_clientid(uint64_t value) {
+  _internal_set_clientid(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.MultiGetArgs.ClientId)
+}
+
+// int32 RequestId = 3;
+inline void MultiGetArgs::clear_requestid() {
+  _impl_.requestid_ = 0;
+}
+inline int32_t MultiGetArgs::_internal_requestid() const {
+  return _impl_.requestid_;
+}
+inline int32_t MultiGetArgs::requestid() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.MultiGetArgs.RequestId)
+  return _internal_requestid();
+}
+inline void MultiGetArgs::_internal_set_requestid(int32_t value) {
+  
+  _impl_.requestid_ = value;
+}
+inline void MultiGetArgs::set_requestid(int32_t value) {
+  _internal_set_requestid(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.MultiGetArgs.RequestId)
+}
+
+// -------------------------------------------------------------------
+
+// MultiGetReply
+
+// bytes Err = 1;
+inline void MultiGetReply::clear_err() {
+  _impl_.err_.ClearToEmpty();
+}
+inline const std::string& MultiGetReply::err() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.MultiGetReply.Err)
+  return _internal_err();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void MultiGetReply::set_err(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.err_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.MultiGetReply.Err)
+}
+inline std::string* MultiGetReply::mutable_err() {
+  std::string* _s = _internal_mutable_err();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.MultiGetReply.Err)
+  return _s;
+}
+inline const std::string& MultiGetReply::_internal_err() const {
+  return _impl_.err_.Get();
+}
+inline void MultiGetReply::_internal_set_err(const std::string& value) {
+  
+  _impl_.err_.Set(value, GetArenaForAllocation());
+}
+inline std::string* MultiGetReply::_internal_mutable_err() {
+  
+  return _impl_.err_.Mutable(GetArenaForAllocation());
+}
+inline std::string* MultiGetReply::release_err() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.MultiGetReply.Err)
+  return _impl_.err_.Release();
+}
+inline void MultiGetReply::set_allocated_err(std::string* err) {
+  if (err != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.err_.SetAllocated(err, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.err_.IsDefault()) {
+    _impl_.err_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.MultiGetReply.Err)
+}
+
+// repeated bytes Values = 2;
+inline int MultiGetReply::_internal_values_size() const {
+  return _impl_.values_.size();
+}
+inline int MultiGetReply::values_size() const {
+  return _internal_values_size();
+}
+inline void MultiGetReply::clear_values() {
+  _impl_.values_.Clear();
+}
+inline std::string* MultiGetReply::add_values() {
+  std::string* _s = _internal_add_values();
+  // @@protoc_insertion_point(field_add_mutable:raftKVRpcProctoc.MultiGetReply.Values)
+  return _s;
+}
+inline const std::string& MultiGetReply::_internal_values(int index) const {
+  return _impl_.values_.Get(index);
+}
+inline const std::string& MultiGetReply::values(int index) const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.MultiGetReply.Values)
+  return _internal_values(index);
+}
+inline std::string* MultiGetReply::mutable_values(int index) {
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.MultiGetReply.Values)
+  return _impl_.values_.Mutable(index);
+}
+inline void MultiGetReply::set_values(int index, const std::string& value) {
+  _impl_.values_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.MultiGetReply.Values)
+}
+inline void MultiGetReply::set_values(int index, std::string&& value) {
+  _impl_.values_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.MultiGetReply.Values)
+}
+inline void MultiGetReply::set_values(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.values_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:raftKVRpcProctoc.MultiGetReply.Values)
+}
+inline void MultiGetReply::set_values(int index, const void* value, size_t size) {
+  _impl_.values_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:raftKVRpcProctoc.MultiGetReply.Values)
+}
+inline std::string* MultiGetReply::_internal_add_values() {
+  return _impl_.values_.Add();
+}
+inline void MultiGetReply::add_values(const std::string& value) {
+  _impl_.values_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:raftKVRpcProctoc.MultiGetReply.Values)
+}
+inline void MultiGetReply::add_values(std::string&& value) {
+  _impl_.values_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:raftKVRpcProctoc.MultiGetReply.Values)
+}
+inline void MultiGetReply::add_values(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.values_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:raftKVRpcProctoc.MultiGetReply.Values)
+}
+inline void MultiGetReply::add_values(const void* value, size_t size) {
+  _impl_.values_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:raftKVRpcProctoc.MultiGetReply.Values)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+MultiGetReply::values() const {
+  // @@protoc_insertion_point(field_list:raftKVRpcProctoc.MultiGetReply.Values)
+  return _impl_.values_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+MultiGetReply::mutable_values() {
+  // @@protoc_insertion_point(field_mutable_list:raftKVRpcProctoc.MultiGetReply.Values)
+  return &_impl_.values_;
+}
+
+// repeated bool Exists = 3;
+inline int MultiGetReply::_internal_exists_size() const {
+  return _impl_.exists_.size();
+}
+inline int MultiGetReply::exists_size() const {
+  return _internal_exists_size();
+}
+inline void MultiGetReply::clear_exists() {
+  _impl_.exists_.Clear();
+}
+inline bool MultiGetReply::_internal_exists(int index) const {
+  return _impl_.exists_.Get(index);
+}
+inline bool MultiGetReply::exists(int index) const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.MultiGetReply.Exists)
+  return _internal_exists(index);
+}
+inline void MultiGetReply::set_exists(int index, bool value) {
+  _impl_.exists_.Set(index, value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.MultiGetReply.Exists)
+}
+inline void MultiGetReply::_internal_add_exists(bool value) {
+  _impl_.exists_.Add(value);
+}
+inline void MultiGetReply::add_exists(bool value) {
+  _internal_add_exists(value);
+  // @@protoc_insertion_point(field_add:raftKVRpcProctoc.MultiGetReply.Exists)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >&
+MultiGetReply::_internal_exists() const {
+  return _impl_.exists_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >&
+MultiGetReply::exists() const {
+  // @@protoc_insertion_point(field_list:raftKVRpcProctoc.MultiGetReply.Exists)
+  return _internal_exists();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >*
+MultiGetReply::_internal_mutable_exists() {
+  return &_impl_.exists_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >*
+MultiGetReply::mutable_exists() {
+  // @@protoc_insertion_point(field_mutable_list:raftKVRpcProctoc.MultiGetReply.Exists)
+  return _internal_mutable_exists();
+}
+
+// -------------------------------------------------------------------
+
+// MultiPutArgs
+
+// repeated bytes Keys = 1;
+inline int MultiPutArgs::_internal_keys_size() const {
+  return _impl_.keys_.size();
+}
+inline int MultiPutArgs::keys_size() const {
+  return _internal_keys_size();
+}
+inline void MultiPutArgs::clear_keys() {
+  _impl_.keys_.Clear();
+}
+inline std::string* MultiPutArgs::add_keys() {
+  std::string* _s = _internal_add_keys();
+  // @@protoc_insertion_point(field_add_mutable:raftKVRpcProctoc.MultiPutArgs.Keys)
+  return _s;
+}
+inline const std::string& MultiPutArgs::_internal_keys(int index) const {
+  return _impl_.keys_.Get(index);
+}
+inline const std::string& MultiPutArgs::keys(int index) const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.MultiPutArgs.Keys)
+  return _internal_keys(index);
+}
+inline std::string* MultiPutArgs::mutable_keys(int index) {
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.MultiPutArgs.Keys)
+  return _impl_.keys_.Mutable(index);
+}
+inline void MultiPutArgs::set_keys(int index, const std::string& value) {
+  _impl_.keys_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.MultiPutArgs.Keys)
+}
+inline void MultiPutArgs::set_keys(int index, std::string&& value) {
+  _impl_.keys_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.MultiPutArgs.Keys)
+}
+inline void MultiPutArgs::set_keys(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.keys_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:raftKVRpcProctoc.MultiPutArgs.Keys)
+}
+inline void MultiPutArgs::set_keys(int index, const void* value, size_t size) {
+  _impl_.keys_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:raftKVRpcProctoc.MultiPutArgs.Keys)
+}
+inline std::string* MultiPutArgs::_internal_add_keys() {
+  return _impl_.keys_.Add();
+}
+inline void MultiPutArgs::add_keys(const std::string& value) {
+  _impl_.keys_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:raftKVRpcProctoc.MultiPutArgs.Keys)
+}
+inline void MultiPutArgs::add_keys(std::string&& value) {
+  _impl_.keys_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:raftKVRpcProctoc.MultiPutArgs.Keys)
+}
+inline void MultiPutArgs::add_keys(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.keys_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:raftKVRpcProctoc.MultiPutArgs.Keys)
+}
+inline void MultiPutArgs::add_keys(const void* value, size_t size) {
+  _impl_.keys_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:raftKVRpcProctoc.MultiPutArgs.Keys)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+MultiPutArgs::keys() const {
+  // @@protoc_insertion_point(field_list:raftKVRpcProctoc.MultiPutArgs.Keys)
+  return _impl_.keys_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+MultiPutArgs::mutable_keys() {
+  // @@protoc_insertion_point(field_mutable_list:raftKVRpcProctoc.MultiPutArgs.Keys)
+  return &_impl_.keys_;
+}
+
+// repeated bytes Values = 2;
+inline int MultiPutArgs::_internal_values_size() const {
+  return _impl_.values_.size();
+}
+inline int MultiPutArgs::values_size() const {
+  return _internal_values_size();
+}
+inline void MultiPutArgs::clear_values() {
+  _impl_.values_.Clear();
+}
+inline std::string* MultiPutArgs::add_values() {
+  std::string* _s = _internal_add_values();
+  // @@protoc_insertion_point(field_add_mutable:raftKVRpcProctoc.MultiPutArgs.Values)
+  return _s;
+}
+inline const std::string& MultiPutArgs::_internal_values(int index) const {
+  return _impl_.values_.Get(index);
+}
+inline const std::string& MultiPutArgs::values(int index) const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.MultiPutArgs.Values)
+  return _internal_values(index);
+}
+inline std::string* MultiPutArgs::mutable_values(int index) {
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.MultiPutArgs.Values)
+  return _impl_.values_.Mutable(index);
+}
+inline void MultiPutArgs::set_values(int index, const std::string& value) {
+  _impl_.values_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.MultiPutArgs.Values)
+}
+inline void MultiPutArgs::set_values(int index, std::string&& value) {
+  _impl_.values_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.MultiPutArgs.Values)
+}
+inline void MultiPutArgs::set_values(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.values_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:raftKVRpcProctoc.MultiPutArgs.Values)
+}
+inline void MultiPutArgs::set_values(int index, const void* value, size_t size) {
+  _impl_.values_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:raftKVRpcProctoc.MultiPutArgs.Values)
+}
+inline std::string* MultiPutArgs::_internal_add_values() {
+  return _impl_.values_.Add();
+}
+inline void MultiPutArgs::add_values(const std::string& value) {
+  _impl_.values_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:raftKVRpcProctoc.MultiPutArgs.Values)
+}
+inline void MultiPutArgs::add_values(std::string&& value) {
+  _impl_.values_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:raftKVRpcProctoc.MultiPutArgs.Values)
+}
+inline void MultiPutArgs::add_values(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.values_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:raftKVRpcProctoc.MultiPutArgs.Values)
+}
+inline void MultiPutArgs::add_values(const void* value, size_t size) {
+  _impl_.values_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:raftKVRpcProctoc.MultiPutArgs.Values)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+MultiPutArgs::values() const {
+  // @@protoc_insertion_point(field_list:raftKVRpcProctoc.MultiPutArgs.Values)
+  return _impl_.values_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+MultiPutArgs::mutable_values() {
+  // @@protoc_insertion_point(field_mutable_list:raftKVRpcProctoc.MultiPutArgs.Values)
+  return &_impl_.values_;
+}
+
+// uint64 ClientId = 3;
+inline void MultiPutArgs::clear_clientid() {
+  _impl_.clientid_ = uint64_t{0u};
+}
+inline uint64_t MultiPutArgs::_internal_clientid() const {
+  return _impl_.clientid_;
+}
+inline uint64_t MultiPutArgs::clientid() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.MultiPutArgs.ClientId)
+  return _internal_clientid();
+}
+inline void MultiPutArgs::_internal_set_clientid(uint64_t value) {
+  
+  _impl_.clientid_ = value;
+}
+inline void MultiPutArgs::set_clientid(uint64_t value) {
+  _internal_set_clientid(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.MultiPutArgs.ClientId)
+}
+
+// int32 RequestId = 4;
+inline void MultiPutArgs::clear_requestid() {
+  _impl_.requestid_ = 0;
+}
+inline int32_t MultiPutArgs::_internal_requestid() const {
+  return _impl_.requestid_;
+}
+inline int32_t MultiPutArgs::requestid() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.MultiPutArgs.RequestId)
+  return _internal_requestid();
+}
+inline void MultiPutArgs::_internal_set_requestid(int32_t value) {
+  
+  _impl_.requestid_ = value;
+}
+inline void MultiPutArgs::set_requestid(int32_t value) {
+  _internal_set_requestid(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.MultiPutArgs.RequestId)
+}
+
+// -------------------------------------------------------------------
+
+// MultiPutReply
+
+// bytes Err = 1;
+inline void MultiPutReply::clear_err() {
+  _impl_.err_.ClearToEmpty();
+}
+inline const std::string& MultiPutReply::err() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.MultiPutReply.Err)
+  return _internal_err();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void MultiPutReply::set_err(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.err_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.MultiPutReply.Err)
+}
+inline std::string* MultiPutReply::mutable_err() {
+  std::string* _s = _internal_mutable_err();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.MultiPutReply.Err)
+  return _s;
+}
+inline const std::string& MultiPutReply::_internal_err() const {
+  return _impl_.err_.Get();
+}
+inline void MultiPutReply::_internal_set_err(const std::string& value) {
+  
+  _impl_.err_.Set(value, GetArenaForAllocation());
+}
+inline std::string* MultiPutReply::_internal_mutable_err() {
+  
+  return _impl_.err_.Mutable(GetArenaForAllocation());
+}
+inline std::string* MultiPutReply::release_err() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.MultiPutReply.Err)
+  return _impl_.err_.Release();
+}
+inline void MultiPutReply::set_allocated_err(std::string* err) {
+  if (err != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.err_.SetAllocated(err, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.err_.IsDefault()) {
+    _impl_.err_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.MultiPutReply.Err)
+}
+
+// -------------------------------------------------------------------
+
+// ScanArgs
+
+// bytes StartKey = 1;
+inline void ScanArgs::clear_startkey() {
+  _impl_.startkey_.ClearToEmpty();
+}
+inline const std::string& ScanArgs::startkey() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.ScanArgs.StartKey)
+  return _internal_startkey();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ScanArgs::set_startkey(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.startkey_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.ScanArgs.StartKey)
+}
+inline std::string* ScanArgs::mutable_startkey() {
+  std::string* _s = _internal_mutable_startkey();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.ScanArgs.StartKey)
+  return _s;
+}
+inline const std::string& ScanArgs::_internal_startkey() const {
+  return _impl_.startkey_.Get();
+}
+inline void ScanArgs::_internal_set_startkey(const std::string& value) {
+  
+  _impl_.startkey_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ScanArgs::_internal_mutable_startkey() {
+  
+  return _impl_.startkey_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ScanArgs::release_startkey() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.ScanArgs.StartKey)
+  return _impl_.startkey_.Release();
+}
+inline void ScanArgs::set_allocated_startkey(std::string* startkey) {
+  if (startkey != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.startkey_.SetAllocated(startkey, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.startkey_.IsDefault()) {
+    _impl_.startkey_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.ScanArgs.StartKey)
+}
+
+// bytes EndKey = 2;
+inline void ScanArgs::clear_endkey() {
+  _impl_.endkey_.ClearToEmpty();
+}
+inline const std::string& ScanArgs::endkey() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.ScanArgs.EndKey)
+  return _internal_endkey();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ScanArgs::set_endkey(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.endkey_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.ScanArgs.EndKey)
+}
+inline std::string* ScanArgs::mutable_endkey() {
+  std::string* _s = _internal_mutable_endkey();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.ScanArgs.EndKey)
+  return _s;
+}
+inline const std::string& ScanArgs::_internal_endkey() const {
+  return _impl_.endkey_.Get();
+}
+inline void ScanArgs::_internal_set_endkey(const std::string& value) {
+  
+  _impl_.endkey_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ScanArgs::_internal_mutable_endkey() {
+  
+  return _impl_.endkey_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ScanArgs::release_endkey() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.ScanArgs.EndKey)
+  return _impl_.endkey_.Release();
+}
+inline void ScanArgs::set_allocated_endkey(std::string* endkey) {
+  if (endkey != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.endkey_.SetAllocated(endkey, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.endkey_.IsDefault()) {
+    _impl_.endkey_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.ScanArgs.EndKey)
+}
+
+// int32 Limit = 3;
+inline void ScanArgs::clear_limit() {
+  _impl_.limit_ = 0;
+}
+inline int32_t ScanArgs::_internal_limit() const {
+  return _impl_.limit_;
+}
+inline int32_t ScanArgs::limit() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.ScanArgs.Limit)
+  return _internal_limit();
+}
+inline void ScanArgs::_internal_set_limit(int32_t value) {
+  
+  _impl_.limit_ = value;
+}
+inline void ScanArgs::set_limit(int32_t value) {
+  _internal_set_limit(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.ScanArgs.Limit)
+}
+
+// uint64 ClientId = 4;
+inline void ScanArgs::clear_clientid() {
+  _impl_.clientid_ = uint64_t{0u};
+}
+inline uint64_t ScanArgs::_internal_clientid() const {
+  return _impl_.clientid_;
+}
+inline uint64_t ScanArgs::clientid() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.ScanArgs.ClientId)
+  return _internal_clientid();
+}
+inline void ScanArgs::_internal_set_clientid(uint64_t value) {
+  
+  _impl_.clientid_ = value;
+}
+inline void ScanArgs::set_clientid(uint64_t value) {
+  _internal_set_clientid(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.ScanArgs.ClientId)
+}
+
+// int32 RequestId = 5;
+inline void ScanArgs::clear_requestid() {
+  _impl_.requestid_ = 0;
+}
+inline int32_t ScanArgs::_internal_requestid() const {
+  return _impl_.requestid_;
+}
+inline int32_t ScanArgs::requestid() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.ScanArgs.RequestId)
+  return _internal_requestid();
+}
+inline void ScanArgs::_internal_set_requestid(int32_t value) {
+  
+  _impl_.requestid_ = value;
+}
+inline void ScanArgs::set_requestid(int32_t value) {
+  _internal_set_requestid(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.ScanArgs.RequestId)
+}
+
+// -------------------------------------------------------------------
+
+// ScanReply
+
+// bytes Err = 1;
+inline void ScanReply::clear_err() {
+  _impl_.err_.ClearToEmpty();
+}
+inline const std::string& ScanReply::err() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.ScanReply.Err)
+  return _internal_err();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ScanReply::set_err(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.err_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.ScanReply.Err)
+}
+inline std::string* ScanReply::mutable_err() {
+  std::string* _s = _internal_mutable_err();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.ScanReply.Err)
+  return _s;
+}
+inline const std::string& ScanReply::_internal_err() const {
+  return _impl_.err_.Get();
+}
+inline void ScanReply::_internal_set_err(const std::string& value) {
+  
+  _impl_.err_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ScanReply::_internal_mutable_err() {
+  
+  return _impl_.err_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ScanReply::release_err() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.ScanReply.Err)
+  return _impl_.err_.Release();
+}
+inline void ScanReply::set_allocated_err(std::string* err) {
+  if (err != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.err_.SetAllocated(err, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.err_.IsDefault()) {
+    _impl_.err_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.ScanReply.Err)
+}
+
+// repeated bytes Keys = 2;
+inline int ScanReply::_internal_keys_size() const {
+  return _impl_.keys_.size();
+}
+inline int ScanReply::keys_size() const {
+  return _internal_keys_size();
+}
+inline void ScanReply::clear_keys() {
+  _impl_.keys_.Clear();
+}
+inline std::string* ScanReply::add_keys() {
+  std::string* _s = _internal_add_keys();
+  // @@protoc_insertion_point(field_add_mutable:raftKVRpcProctoc.ScanReply.Keys)
+  return _s;
+}
+inline const std::string& ScanReply::_internal_keys(int index) const {
+  return _impl_.keys_.Get(index);
+}
+inline const std::string& ScanReply::keys(int index) const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.ScanReply.Keys)
+  return _internal_keys(index);
+}
+inline std::string* ScanReply::mutable_keys(int index) {
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.ScanReply.Keys)
+  return _impl_.keys_.Mutable(index);
+}
+inline void ScanReply::set_keys(int index, const std::string& value) {
+  _impl_.keys_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.ScanReply.Keys)
+}
+inline void ScanReply::set_keys(int index, std::string&& value) {
+  _impl_.keys_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.ScanReply.Keys)
+}
+inline void ScanReply::set_keys(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.keys_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:raftKVRpcProctoc.ScanReply.Keys)
+}
+inline void ScanReply::set_keys(int index, const void* value, size_t size) {
+  _impl_.keys_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:raftKVRpcProctoc.ScanReply.Keys)
+}
+inline std::string* ScanReply::_internal_add_keys() {
+  return _impl_.keys_.Add();
+}
+inline void ScanReply::add_keys(const std::string& value) {
+  _impl_.keys_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:raftKVRpcProctoc.ScanReply.Keys)
+}
+inline void ScanReply::add_keys(std::string&& value) {
+  _impl_.keys_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:raftKVRpcProctoc.ScanReply.Keys)
+}
+inline void ScanReply::add_keys(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.keys_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:raftKVRpcProctoc.ScanReply.Keys)
+}
+inline void ScanReply::add_keys(const void* value, size_t size) {
+  _impl_.keys_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:raftKVRpcProctoc.ScanReply.Keys)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+ScanReply::keys() const {
+  // @@protoc_insertion_point(field_list:raftKVRpcProctoc.ScanReply.Keys)
+  return _impl_.keys_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+ScanReply::mutable_keys() {
+  // @@protoc_insertion_point(field_mutable_list:raftKVRpcProctoc.ScanReply.Keys)
+  return &_impl_.keys_;
+}
+
+// repeated bytes Values = 3;
+inline int ScanReply::_internal_values_size() const {
+  return _impl_.values_.size();
+}
+inline int ScanReply::values_size() const {
+  return _internal_values_size();
+}
+inline void ScanReply::clear_values() {
+  _impl_.values_.Clear();
+}
+inline std::string* ScanReply::add_values() {
+  std::string* _s = _internal_add_values();
+  // @@protoc_insertion_point(field_add_mutable:raftKVRpcProctoc.ScanReply.Values)
+  return _s;
+}
+inline const std::string& ScanReply::_internal_values(int index) const {
+  return _impl_.values_.Get(index);
+}
+inline const std::string& ScanReply::values(int index) const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.ScanReply.Values)
+  return _internal_values(index);
+}
+inline std::string* ScanReply::mutable_values(int index) {
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.ScanReply.Values)
+  return _impl_.values_.Mutable(index);
+}
+inline void ScanReply::set_values(int index, const std::string& value) {
+  _impl_.values_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.ScanReply.Values)
+}
+inline void ScanReply::set_values(int index, std::string&& value) {
+  _impl_.values_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.ScanReply.Values)
+}
+inline void ScanReply::set_values(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.values_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:raftKVRpcProctoc.ScanReply.Values)
+}
+inline void ScanReply::set_values(int index, const void* value, size_t size) {
+  _impl_.values_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:raftKVRpcProctoc.ScanReply.Values)
+}
+inline std::string* ScanReply::_internal_add_values() {
+  return _impl_.values_.Add();
+}
+inline void ScanReply::add_values(const std::string& value) {
+  _impl_.values_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:raftKVRpcProctoc.ScanReply.Values)
+}
+inline void ScanReply::add_values(std::string&& value) {
+  _impl_.values_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:raftKVRpcProctoc.ScanReply.Values)
+}
+inline void ScanReply::add_values(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.values_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:raftKVRpcProctoc.ScanReply.Values)
+}
+inline void ScanReply::add_values(const void* value, size_t size) {
+  _impl_.values_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:raftKVRpcProctoc.ScanReply.Values)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+ScanReply::values() const {
+  // @@protoc_insertion_point(field_list:raftKVRpcProctoc.ScanReply.Values)
+  return _impl_.values_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+ScanReply::mutable_values() {
+  // @@protoc_insertion_point(field_mutable_list:raftKVRpcProctoc.ScanReply.Values)
+  return &_impl_.values_;
+}
+
+// bool More = 4;
+inline void ScanReply::clear_more() {
+  _impl_.more_ = false;
+}
+inline bool ScanReply::_internal_more() const {
+  return _impl_.more_;
+}
+inline bool ScanReply::more() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.ScanReply.More)
+  return _internal_more();
+}
+inline void ScanReply::_internal_set_more(bool value) {
+  
+  _impl_.more_ = value;
+}
+inline void ScanReply::set_more(bool value) {
+  _internal_set_more(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.ScanReply.More)
+}
+
+// bytes Continuation = 5;
+inline void ScanReply::clear_continuation() {
+  _impl_.continuation_.ClearToEmpty();
+}
+inline const std::string& ScanReply::continuation() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.ScanReply.Continuation)
+  return _internal_continuation();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ScanReply::set_continuation(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.continuation_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.ScanReply.Continuation)
+}
+inline std::string* ScanReply::mutable_continuation() {
+  std::string* _s = _internal_mutable_continuation();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.ScanReply.Continuation)
+  return _s;
+}
+inline const std::string& ScanReply::_internal_continuation() const {
+  return _impl_.continuation_.Get();
+}
+inline void ScanReply::_internal_set_continuation(const std::string& value) {
+  
+  _impl_.continuation_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ScanReply::_internal_mutable_continuation() {
+  
+  return _impl_.continuation_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ScanReply::release_continuation() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.ScanReply.Continuation)
+  return _impl_.continuation_.Release();
+}
+inline void ScanReply::set_allocated_continuation(std::string* continuation) {
+  if (continuation != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.continuation_.SetAllocated(continuation, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.continuation_.IsDefault()) {
+    _impl_.continuation_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.ScanReply.Continuation)
+}
+
+// -------------------------------------------------------------------
+
+// CompareAndSwapArgs
+
+// bytes Key = 1;
+inline void CompareAndSwapArgs::clear_key() {
+  _impl_.key_.ClearToEmpty();
+}
+inline const std::string& CompareAndSwapArgs::key() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.CompareAndSwapArgs.Key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CompareAndSwapArgs::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.CompareAndSwapArgs.Key)
+}
+inline std::string* CompareAndSwapArgs::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.CompareAndSwapArgs.Key)
+  return _s;
+}
+inline const std::string& CompareAndSwapArgs::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void CompareAndSwapArgs::_internal_set_key(const std::string& value) {
+  
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CompareAndSwapArgs::_internal_mutable_key() {
+  
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CompareAndSwapArgs::release_key() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.CompareAndSwapArgs.Key)
+  return _impl_.key_.Release();
+}
+inline void CompareAndSwapArgs::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.CompareAndSwapArgs.Key)
+}
+
+// bytes Expected = 2;
+inline void CompareAndSwapArgs::clear_expected() {
+  _impl_.expected_.ClearToEmpty();
+}
+inline const std::string& CompareAndSwapArgs::expected() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.CompareAndSwapArgs.Expected)
+  return _internal_expected();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CompareAndSwapArgs::set_expected(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.expected_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.CompareAndSwapArgs.Expected)
+}
+inline std::string* CompareAndSwapArgs::mutable_expected() {
+  std::string* _s = _internal_mutable_expected();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.CompareAndSwapArgs.Expected)
+  return _s;
+}
+inline const std::string& CompareAndSwapArgs::_internal_expected() const {
+  return _impl_.expected_.Get();
+}
+inline void CompareAndSwapArgs::_internal_set_expected(const std::string& value) {
+  
+  _impl_.expected_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CompareAndSwapArgs::_internal_mutable_expected() {
+  
+  return _impl_.expected_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CompareAndSwapArgs::release_expected() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.CompareAndSwapArgs.Expected)
+  return _impl_.expected_.Release();
+}
+inline void CompareAndSwapArgs::set_allocated_expected(std::string* expected) {
+  if (expected != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.expected_.SetAllocated(expected, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.expected_.IsDefault()) {
+    _impl_.expected_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.CompareAndSwapArgs.Expected)
+}
+
+// bytes Value = 3;
+inline void CompareAndSwapArgs::clear_value() {
+  _impl_.value_.ClearToEmpty();
+}
+inline const std::string& CompareAndSwapArgs::value() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.CompareAndSwapArgs.Value)
+  return _internal_value();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CompareAndSwapArgs::set_value(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.value_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.CompareAndSwapArgs.Value)
+}
+inline std::string* CompareAndSwapArgs::mutable_value() {
+  std::string* _s = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.CompareAndSwapArgs.Value)
+  return _s;
+}
+inline const std::string& CompareAndSwapArgs::_internal_value() const {
+  return _impl_.value_.Get();
+}
+inline void CompareAndSwapArgs::_internal_set_value(const std::string& value) {
+  
+  _impl_.value_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CompareAndSwapArgs::_internal_mutable_value() {
+  
+  return _impl_.value_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CompareAndSwapArgs::release_value() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.CompareAndSwapArgs.Value)
+  return _impl_.value_.Release();
+}
+inline void CompareAndSwapArgs::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.CompareAndSwapArgs.Value)
+}
+
+// uint64 ClientId = 4;
+inline void CompareAndSwapArgs::clear_clientid() {
+  _impl_.clientid_ = uint64_t{0u};
+}
+inline uint64_t CompareAndSwapArgs::_internal_clientid() const {
+  return _impl_.clientid_;
+}
+inline uint64_t CompareAndSwapArgs::clientid() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.CompareAndSwapArgs.ClientId)
+  return _internal_clientid();
+}
+inline void CompareAndSwapArgs::_internal_set_clientid(uint64_t value) {
+  
+  _impl_.clientid_ = value;
+}
+inline void CompareAndSwapArgs::set_clientid(uint64_t value) {
+  _internal_set_clientid(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.CompareAndSwapArgs.ClientId)
+}
+
+// int32 RequestId = 5;
+inline void CompareAndSwapArgs::clear_requestid() {
+  _impl_.requestid_ = 0;
+}
+inline int32_t CompareAndSwapArgs::_internal_requestid() const {
+  return _impl_.requestid_;
+}
+inline int32_t CompareAndSwapArgs::requestid() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.CompareAndSwapArgs.RequestId)
+  return _internal_requestid();
+}
+inline void CompareAndSwapArgs::_internal_set_requestid(int32_t value) {
+  
+  _impl_.requestid_ = value;
+}
+inline void CompareAndSwapArgs::set_requestid(int32_t value) {
+  _internal_set_requestid(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.CompareAndSwapArgs.RequestId)
+}
+
+// -------------------------------------------------------------------
+
+// CompareAndSwapReply
+
+// bytes Err = 1;
+inline void CompareAndSwapReply::clear_err() {
+  _impl_.err_.ClearToEmpty();
+}
+inline const std::string& CompareAndSwapReply::err() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.CompareAndSwapReply.Err)
+  return _internal_err();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CompareAndSwapReply::set_err(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.err_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.CompareAndSwapReply.Err)
+}
+inline std::string* CompareAndSwapReply::mutable_err() {
+  std::string* _s = _internal_mutable_err();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.CompareAndSwapReply.Err)
+  return _s;
+}
+inline const std::string& CompareAndSwapReply::_internal_err() const {
+  return _impl_.err_.Get();
+}
+inline void CompareAndSwapReply::_internal_set_err(const std::string& value) {
+  
+  _impl_.err_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CompareAndSwapReply::_internal_mutable_err() {
+  
+  return _impl_.err_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CompareAndSwapReply::release_err() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.CompareAndSwapReply.Err)
+  return _impl_.err_.Release();
+}
+inline void CompareAndSwapReply::set_allocated_err(std::string* err) {
+  if (err != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.err_.SetAllocated(err, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.err_.IsDefault()) {
+    _impl_.err_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.CompareAndSwapReply.Err)
+}
+
+// bool Succeeded = 2;
+inline void CompareAndSwapReply::clear_succeeded() {
+  _impl_.succeeded_ = false;
+}
+inline bool CompareAndSwapReply::_internal_succeeded() const {
+  return _impl_.succeeded_;
+}
+inline bool CompareAndSwapReply::succeeded() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.CompareAndSwapReply.Succeeded)
+  return _internal_succeeded();
+}
+inline void CompareAndSwapReply::_internal_set_succeeded(bool value) {
+  
+  _impl_.succeeded_ = value;
+}
+inline void CompareAndSwapReply::set_succeeded(bool value) {
+  _internal_set_succeeded(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.CompareAndSwapReply.Succeeded)
+}
+
+// bool Exists = 3;
+inline void CompareAndSwapReply::clear_exists() {
+  _impl_.exists_ = false;
+}
+inline bool CompareAndSwapReply::_internal_exists() const {
+  return _impl_.exists_;
+}
+inline bool CompareAndSwapReply::exists() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.CompareAndSwapReply.Exists)
+  return _internal_exists();
+}
+inline void CompareAndSwapReply::_internal_set_exists(bool value) {
+  
+  _impl_.exists_ = value;
+}
+inline void CompareAndSwapReply::set_exists(bool value) {
+  _internal_set_exists(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.CompareAndSwapReply.Exists)
+}
+
+// bytes Current = 4;
+inline void CompareAndSwapReply::clear_current() {
+  _impl_.current_.ClearToEmpty();
+}
+inline const std::string& CompareAndSwapReply::current() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.CompareAndSwapReply.Current)
+  return _internal_current();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CompareAndSwapReply::set_current(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.current_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.CompareAndSwapReply.Current)
+}
+inline std::string* CompareAndSwapReply::mutable_current() {
+  std::string* _s = _internal_mutable_current();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.CompareAndSwapReply.Current)
+  return _s;
+}
+inline const std::string& CompareAndSwapReply::_internal_current() const {
+  return _impl_.current_.Get();
+}
+inline void CompareAndSwapReply::_internal_set_current(const std::string& value) {
+  
+  _impl_.current_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CompareAndSwapReply::_internal_mutable_current() {
+  
+  return _impl_.current_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CompareAndSwapReply::release_current() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.CompareAndSwapReply.Current)
+  return _impl_.current_.Release();
+}
+inline void CompareAndSwapReply::set_allocated_current(std::string* current) {
+  if (current != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.current_.SetAllocated(current, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.current_.IsDefault()) {
+    _impl_.current_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.CompareAndSwapReply.Current)
+}
+
+// -------------------------------------------------------------------
+
+// IncrementArgs
+
+// bytes Key = 1;
+inline void IncrementArgs::clear_key() {
+  _impl_.key_.ClearToEmpty();
+}
+inline const std::string& IncrementArgs::key() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.IncrementArgs.Key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void IncrementArgs::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.IncrementArgs.Key)
+}
+inline std::string* IncrementArgs::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.IncrementArgs.Key)
+  return _s;
+}
+inline const std::string& IncrementArgs::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void IncrementArgs::_internal_set_key(const std::string& value) {
+  
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* IncrementArgs::_internal_mutable_key() {
+  
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* IncrementArgs::release_key() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.IncrementArgs.Key)
+  return _impl_.key_.Release();
+}
+inline void IncrementArgs::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.IncrementArgs.Key)
+}
+
+// int64 Delta = 2;
+inline void IncrementArgs::clear_delta() {
+  _impl_.delta_ = int64_t{0};
+}
+inline int64_t IncrementArgs::_internal_delta() const {
+  return _impl_.delta_;
+}
+inline int64_t IncrementArgs::delta() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.IncrementArgs.Delta)
+  return _internal_delta();
+}
+inline void IncrementArgs::_internal_set_delta(int64_t value) {
+  
+  _impl_.delta_ = value;
+}
+inline void IncrementArgs::set_delta(int64_t value) {
+  _internal_set_delta(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.IncrementArgs.Delta)
+}
+
+// uint64 ClientId = 3;
+inline void IncrementArgs::clear_clientid() {
+  _impl_.clientid_ = uint64_t{0u};
+}
+inline uint64_t IncrementArgs::_internal_clientid() const {
+  return _impl_.clientid_;
+}
+inline uint64_t IncrementArgs::clientid() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.IncrementArgs.ClientId)
+  return _internal_clientid();
+}
+inline void IncrementArgs::_internal_set_clientid(uint64_t value) {
+  
+  _impl_.clientid_ = value;
+}
+inline void IncrementArgs::set_clientid(uint64_t value) {
+  _internal_set_clientid(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.IncrementArgs.ClientId)
+}
+
+// int32 RequestId = 4;
+inline void IncrementArgs::clear_requestid() {
+  _impl_.requestid_ = 0;
+}
+inline int32_t IncrementArgs::_internal_requestid() const {
+  return _impl_.requestid_;
+}
+inline int32_t IncrementArgs::requestid() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.IncrementArgs.RequestId)
+  return _internal_requestid();
+}
+inline void IncrementArgs::_internal_set_requestid(int32_t value) {
+  
+  _impl_.requestid_ = value;
+}
+inline void IncrementArgs::set_requestid(int32_t value) {
+  _internal_set_requestid(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.IncrementArgs.RequestId)
+}
+
+// -------------------------------------------------------------------
+
+// IncrementReply
+
+// bytes Err = 1;
+inline void IncrementReply::clear_err() {
+  _impl_.err_.ClearToEmpty();
+}
+inline const std::string& IncrementReply::err() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.IncrementReply.Err)
+  return _internal_err();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void IncrementReply::set_err(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.err_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.IncrementReply.Err)
+}
+inline std::string* IncrementReply::mutable_err() {
+  std::string* _s = _internal_mutable_err();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.IncrementReply.Err)
+  return _s;
+}
+inline const std::string& IncrementReply::_internal_err() const {
+  return _impl_.err_.Get();
+}
+inline void IncrementReply::_internal_set_err(const std::string& value) {
+  
+  _impl_.err_.Set(value, GetArenaForAllocation());
+}
+inline std::string* IncrementReply::_internal_mutable_err() {
+  
+  return _impl_.err_.Mutable(GetArenaForAllocation());
+}
+inline std::string* IncrementReply::release_err() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.IncrementReply.Err)
+  return _impl_.err_.Release();
+}
+inline void IncrementReply::set_allocated_err(std::string* err) {
+  if (err != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.err_.SetAllocated(err, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.err_.IsDefault()) {
+    _impl_.err_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.IncrementReply.Err)
+}
+
+// int64 Value = 2;
+inline void IncrementReply::clear_value() {
+  _impl_.value_ = int64_t{0};
+}
+inline int64_t IncrementReply::_internal_value() const {
+  return _impl_.value_;
+}
+inline int64_t IncrementReply::value() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.IncrementReply.Value)
+  return _internal_value();
+}
+inline void IncrementReply::_internal_set_value(int64_t value) {
+  
+  _impl_.value_ = value;
+}
+inline void IncrementReply::set_value(int64_t value) {
+  _internal_set_value(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.IncrementReply.Value)
+}
+
+// -------------------------------------------------------------------
+
+// PutIfAbsentArgs
+
+// bytes Key = 1;
+inline void PutIfAbsentArgs::clear_key() {
+  _impl_.key_.ClearToEmpty();
+}
+inline const std::string& PutIfAbsentArgs::key() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.PutIfAbsentArgs.Key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PutIfAbsentArgs::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.PutIfAbsentArgs.Key)
+}
+inline std::string* PutIfAbsentArgs::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.PutIfAbsentArgs.Key)
+  return _s;
+}
+inline const std::string& PutIfAbsentArgs::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void PutIfAbsentArgs::_internal_set_key(const std::string& value) {
+  
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PutIfAbsentArgs::_internal_mutable_key() {
+  
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PutIfAbsentArgs::release_key() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.PutIfAbsentArgs.Key)
+  return _impl_.key_.Release();
+}
+inline void PutIfAbsentArgs::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.PutIfAbsentArgs.Key)
+}
+
+// bytes Value = 2;
+inline void PutIfAbsentArgs::clear_value() {
+  _impl_.value_.ClearToEmpty();
+}
+inline const std::string& PutIfAbsentArgs::value() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.PutIfAbsentArgs.Value)
+  return _internal_value();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PutIfAbsentArgs::set_value(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.value_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.PutIfAbsentArgs.Value)
+}
+inline std::string* PutIfAbsentArgs::mutable_value() {
+  std::string* _s = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.PutIfAbsentArgs.Value)
+  return _s;
+}
+inline const std::string& PutIfAbsentArgs::_internal_value() const {
+  return _impl_.value_.Get();
+}
+inline void PutIfAbsentArgs::_internal_set_value(const std::string& value) {
+  
+  _impl_.value_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PutIfAbsentArgs::_internal_mutable_value() {
+  
+  return _impl_.value_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PutIfAbsentArgs::release_value() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.PutIfAbsentArgs.Value)
+  return _impl_.value_.Release();
+}
+inline void PutIfAbsentArgs::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.PutIfAbsentArgs.Value)
+}
+
+// uint64 ClientId = 3;
+inline void PutIfAbsentArgs::clear_clientid() {
+  _impl_.clientid_ = uint64_t{0u};
+}
+inline uint64_t PutIfAbsentArgs::_internal_clientid() const {
+  return _impl_.clientid_;
+}
+inline uint64_t PutIfAbsentArgs::clientid() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.PutIfAbsentArgs.ClientId)
   return _internal_clientid();
 }
-inline void GetArgs::set_clientid(const std::string& value) {
+inline void PutIfAbsentArgs::_internal_set_clientid(uint64_t value) {
+  
+  _impl_.clientid_ = value;
+}
+inline void PutIfAbsentArgs::set_clientid(uint64_t value) {
   _internal_set_clientid(value);
-  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.GetArgs.ClientId)
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.PutIfAbsentArgs.ClientId)
 }
-inline std::string* GetArgs::mutable_clientid() {
-  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.GetArgs.ClientId)
-  return _internal_mutable_clientid();
+
+// int32 RequestId = 4;
+inline void PutIfAbsentArgs::clear_requestid() {
+  _impl_.requestid_ = 0;
 }
-inline const std::string& GetArgs::_internal_clientid() const {
-  return clientid_.Get();
+inline int32_t PutIfAbsentArgs::_internal_requestid() const {
+  return _impl_.requestid_;
 }
-inline void GetArgs::_internal_set_clientid(const std::string& value) {
-
-  clientid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+inline int32_t PutIfAbsentArgs::requestid() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.PutIfAbsentArgs.RequestId)
+  return _internal_requestid();
 }
-inline void GetArgs::set_clientid(std::string&& value) {
-
-  clientid_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:raftKVRpcProctoc.GetArgs.ClientId)
+inline void PutIfAbsentArgs::_internal_set_requestid(int32_t value) {
+  
+  _impl_.requestid_ = value;
 }
-inline void GetArgs::set_clientid(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-
-  clientid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:raftKVRpcProctoc.GetArgs.ClientId)
+inline void PutIfAbsentArgs::set_requestid(int32_t value) {
+  _internal_set_requestid(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.PutIfAbsentArgs.RequestId)
 }
-inline void GetArgs::set_clientid(const void* value,
-    size_t size) {
 
-  clientid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:raftKVRpcProctoc.GetArgs.ClientId)
-}
-inline std::string* GetArgs::_internal_mutable_clientid() {
+// -------------------------------------------------------------------
 
-  return clientid_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+// PutIfAbsentReply
+
+// bytes Err = 1;
+inline void PutIfAbsentReply::clear_err() {
+  _impl_.err_.ClearToEmpty();
 }
-inline std::string* GetArgs::release_clientid() {
-  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.GetArgs.ClientId)
-  return clientid_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline const std::string& PutIfAbsentReply::err() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.PutIfAbsentReply.Err)
+  return _internal_err();
 }
-inline void GetArgs::set_allocated_clientid(std::string* clientid) {
-  if (clientid != nullptr) {
-
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PutIfAbsentReply::set_err(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.err_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.PutIfAbsentReply.Err)
+}
+inline std::string* PutIfAbsentReply::mutable_err() {
+  std::string* _s = _internal_mutable_err();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.PutIfAbsentReply.Err)
+  return _s;
+}
+inline const std::string& PutIfAbsentReply::_internal_err() const {
+  return _impl_.err_.Get();
+}
+inline void PutIfAbsentReply::_internal_set_err(const std::string& value) {
+  
+  _impl_.err_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PutIfAbsentReply::_internal_mutable_err() {
+  
+  return _impl_.err_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PutIfAbsentReply::release_err() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.PutIfAbsentReply.Err)
+  return _impl_.err_.Release();
+}
+inline void PutIfAbsentReply::set_allocated_err(std::string* err) {
+  if (err != nullptr) {
+    
   } else {
-
+    
   }
-  clientid_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), clientid,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.GetArgs.ClientId)
+  _impl_.err_.SetAllocated(err, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.err_.IsDefault()) {
+    _impl_.err_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.PutIfAbsentReply.Err)
 }
-inline std::string* GetArgs::unsafe_arena_release_clientid() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:raftKVRpcProctoc.GetArgs.ClientId)
-  GOOGLE_DCHECK(GetArena() != nullptr);
 
-  return clientid_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
+// bool Succeeded = 2;
+inline void PutIfAbsentReply::clear_succeeded() {
+  _impl_.succeeded_ = false;
+}
+inline bool PutIfAbsentReply::_internal_succeeded() const {
+  return _impl_.succeeded_;
+}
+inline bool PutIfAbsentReply::succeeded() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.PutIfAbsentReply.Succeeded)
+  return _internal_succeeded();
+}
+inline void PutIfAbsentReply::_internal_set_succeeded(bool value) {
+  
+  _impl_.succeeded_ = value;
+}
+inline void PutIfAbsentReply::set_succeeded(bool value) {
+  _internal_set_succeeded(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.PutIfAbsentReply.Succeeded)
 }
-inline void GetArgs::unsafe_arena_set_allocated_clientid(
-    std::string* clientid) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (clientid != nullptr) {
 
+// bytes Current = 3;
+inline void PutIfAbsentReply::clear_current() {
+  _impl_.current_.ClearToEmpty();
+}
+inline const std::string& PutIfAbsentReply::current() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.PutIfAbsentReply.Current)
+  return _internal_current();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PutIfAbsentReply::set_current(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.current_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.PutIfAbsentReply.Current)
+}
+inline std::string* PutIfAbsentReply::mutable_current() {
+  std::string* _s = _internal_mutable_current();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.PutIfAbsentReply.Current)
+  return _s;
+}
+inline const std::string& PutIfAbsentReply::_internal_current() const {
+  return _impl_.current_.Get();
+}
+inline void PutIfAbsentReply::_internal_set_current(const std::string& value) {
+  
+  _impl_.current_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PutIfAbsentReply::_internal_mutable_current() {
+  
+  return _impl_.current_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PutIfAbsentReply::release_current() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.PutIfAbsentReply.Current)
+  return _impl_.current_.Release();
+}
+inline void PutIfAbsentReply::set_allocated_current(std::string* current) {
+  if (current != nullptr) {
+    
   } else {
+    
+  }
+  _impl_.current_.SetAllocated(current, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.current_.IsDefault()) {
+    _impl_.current_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.PutIfAbsentReply.Current)
+}
 
+// -------------------------------------------------------------------
+
+// DeleteArgs
+
+// bytes Key = 1;
+inline void DeleteArgs::clear_key() {
+  _impl_.key_.ClearToEmpty();
+}
+inline const std::string& DeleteArgs::key() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.DeleteArgs.Key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void DeleteArgs::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.DeleteArgs.Key)
+}
+inline std::string* DeleteArgs::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.DeleteArgs.Key)
+  return _s;
+}
+inline const std::string& DeleteArgs::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void DeleteArgs::_internal_set_key(const std::string& value) {
+  
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* DeleteArgs::_internal_mutable_key() {
+  
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* DeleteArgs::release_key() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.DeleteArgs.Key)
+  return _impl_.key_.Release();
+}
+inline void DeleteArgs::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
   }
-  clientid_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      clientid, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:raftKVRpcProctoc.GetArgs.ClientId)
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.DeleteArgs.Key)
+}
+
+// uint64 ClientId = 2;
+inline void DeleteArgs::clear_clientid() {
+  _impl_.clientid_ = uint64_t{0u};
+}
+inline uint64_t DeleteArgs::_internal_clientid() const {
+  return _impl_.clientid_;
+}
+inline uint64_t DeleteArgs::clientid() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.DeleteArgs.ClientId)
+  return _internal_clientid();
+}
+inline void DeleteArgs::_internal_set_clientid(uint64_t value) {
+  
+  _impl_.clientid_ = value;
+}
+inline void DeleteArgs::set_clientid(uint64_t value) {
+  _internal_set_clientid(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.DeleteArgs.ClientId)
 }
 
 // int32 RequestId = 3;
-inline void GetArgs::clear_requestid() {
-  requestid_ = 0;
+inline void DeleteArgs::clear_requestid() {
+  _impl_.requestid_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 GetArgs::_internal_requestid() const {
-  return requestid_;
+inline int32_t DeleteArgs::_internal_requestid() const {
+  return _impl_.requestid_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 GetArgs::requestid() const {
-  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.GetArgs.RequestId)
+inline int32_t DeleteArgs::requestid() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.DeleteArgs.RequestId)
   return _internal_requestid();
 }
-inline void GetArgs::_internal_set_requestid(::PROTOBUF_NAMESPACE_ID::int32 value) {
-
-  requestid_ = value;
+inline void DeleteArgs::_internal_set_requestid(int32_t value) {
+  
+  _impl_.requestid_ = value;
 }
-inline void GetArgs::set_requestid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void DeleteArgs::set_requestid(int32_t value) {
   _internal_set_requestid(value);
-  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.GetArgs.RequestId)
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.DeleteArgs.RequestId)
 }
 
 // -------------------------------------------------------------------
 
-// GetReply
+// DeleteReply
 
 // bytes Err = 1;
-inline void GetReply::clear_err() {
-  err_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline void DeleteReply::clear_err() {
+  _impl_.err_.ClearToEmpty();
 }
-inline const std::string& GetReply::err() const {
-  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.GetReply.Err)
+inline const std::string& DeleteReply::err() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.DeleteReply.Err)
   return _internal_err();
 }
-inline void GetReply::set_err(const std::string& value) {
-  _internal_set_err(value);
-  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.GetReply.Err)
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void DeleteReply::set_err(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.err_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.DeleteReply.Err)
 }
-inline std::string* GetReply::mutable_err() {
-  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.GetReply.Err)
-  return _internal_mutable_err();
+inline std::string* DeleteReply::mutable_err() {
+  std::string* _s = _internal_mutable_err();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.DeleteReply.Err)
+  return _s;
 }
-inline const std::string& GetReply::_internal_err() const {
-  return err_.Get();
+inline const std::string& DeleteReply::_internal_err() const {
+  return _impl_.err_.Get();
+}
+inline void DeleteReply::_internal_set_err(const std::string& value) {
+  
+  _impl_.err_.Set(value, GetArenaForAllocation());
+}
+inline std::string* DeleteReply::_internal_mutable_err() {
+  
+  return _impl_.err_.Mutable(GetArenaForAllocation());
+}
+inline std::string* DeleteReply::release_err() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.DeleteReply.Err)
+  return _impl_.err_.Release();
+}
+inline void DeleteReply::set_allocated_err(std::string* err) {
+  if (err != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.err_.SetAllocated(err, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.err_.IsDefault()) {
+    _impl_.err_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.DeleteReply.Err)
 }
-inline void GetReply::_internal_set_err(const std::string& value) {
 
-  err_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+// bool Deleted = 2;
+inline void DeleteReply::clear_deleted() {
+  _impl_.deleted_ = false;
+}
+inline bool DeleteReply::_internal_deleted() const {
+  return _impl_.deleted_;
+}
+inline bool DeleteReply::deleted() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.DeleteReply.Deleted)
+  return _internal_deleted();
+}
+inline void DeleteReply::_internal_set_deleted(bool value) {
+  
+  _impl_.deleted_ = value;
 }
-inline void GetReply::set_err(std::string&& value) {
+inline void DeleteReply::set_deleted(bool value) {
+  _internal_set_deleted(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.DeleteReply.Deleted)
+}
+
+// -------------------------------------------------------------------
+
+// WatchArgs
 
-  err_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:raftKVRpcProctoc.GetReply.Err)
+// bytes Key = 1;
+inline void WatchArgs::clear_key() {
+  _impl_.key_.ClearToEmpty();
+}
+inline const std::string& WatchArgs::key() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.WatchArgs.Key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void WatchArgs::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.WatchArgs.Key)
+}
+inline std::string* WatchArgs::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.WatchArgs.Key)
+  return _s;
+}
+inline const std::string& WatchArgs::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void WatchArgs::_internal_set_key(const std::string& value) {
+  
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* WatchArgs::_internal_mutable_key() {
+  
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* WatchArgs::release_key() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.WatchArgs.Key)
+  return _impl_.key_.Release();
+}
+inline void WatchArgs::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.WatchArgs.Key)
 }
-inline void GetReply::set_err(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
 
-  err_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:raftKVRpcProctoc.GetReply.Err)
+// bool Prefix = 2;
+inline void WatchArgs::clear_prefix() {
+  _impl_.prefix_ = false;
+}
+inline bool WatchArgs::_internal_prefix() const {
+  return _impl_.prefix_;
+}
+inline bool WatchArgs::prefix() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.WatchArgs.Prefix)
+  return _internal_prefix();
+}
+inline void WatchArgs::_internal_set_prefix(bool value) {
+  
+  _impl_.prefix_ = value;
+}
+inline void WatchArgs::set_prefix(bool value) {
+  _internal_set_prefix(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.WatchArgs.Prefix)
 }
-inline void GetReply::set_err(const void* value,
-    size_t size) {
 
-  err_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:raftKVRpcProctoc.GetReply.Err)
+// int64 FromRevision = 3;
+inline void WatchArgs::clear_fromrevision() {
+  _impl_.fromrevision_ = int64_t{0};
+}
+inline int64_t WatchArgs::_internal_fromrevision() const {
+  return _impl_.fromrevision_;
+}
+inline int64_t WatchArgs::fromrevision() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.WatchArgs.FromRevision)
+  return _internal_fromrevision();
+}
+inline void WatchArgs::_internal_set_fromrevision(int64_t value) {
+  
+  _impl_.fromrevision_ = value;
+}
+inline void WatchArgs::set_fromrevision(int64_t value) {
+  _internal_set_fromrevision(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.WatchArgs.FromRevision)
 }
-inline std::string* GetReply::_internal_mutable_err() {
 
-  return err_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+// -------------------------------------------------------------------
+
+// WatchEvent
+
+// .raftKVRpcProctoc.WatchEvent.Type EventType = 1;
+inline void WatchEvent::clear_eventtype() {
+  _impl_.eventtype_ = 0;
 }
-inline std::string* GetReply::release_err() {
-  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.GetReply.Err)
-  return err_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline ::raftKVRpcProctoc::WatchEvent_Type WatchEvent::_internal_eventtype() const {
+  return static_cast< ::raftKVRpcProctoc::WatchEvent_Type >(_impl_.eventtype_);
+}
+inline ::raftKVRpcProctoc::WatchEvent_Type WatchEvent::eventtype() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.WatchEvent.EventType)
+  return _internal_eventtype();
+}
+inline void WatchEvent::_internal_set_eventtype(::raftKVRpcProctoc::WatchEvent_Type value) {
+  
+  _impl_.eventtype_ = value;
+}
+inline void WatchEvent::set_eventtype(::raftKVRpcProctoc::WatchEvent_Type value) {
+  _internal_set_eventtype(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.WatchEvent.EventType)
 }
-inline void GetReply::set_allocated_err(std::string* err) {
-  if (err != nullptr) {
 
+// bytes Key = 2;
+inline void WatchEvent::clear_key() {
+  _impl_.key_.ClearToEmpty();
+}
+inline const std::string& WatchEvent::key() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.WatchEvent.Key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void WatchEvent::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.WatchEvent.Key)
+}
+inline std::string* WatchEvent::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.WatchEvent.Key)
+  return _s;
+}
+inline const std::string& WatchEvent::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void WatchEvent::_internal_set_key(const std::string& value) {
+  
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* WatchEvent::_internal_mutable_key() {
+  
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* WatchEvent::release_key() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.WatchEvent.Key)
+  return _impl_.key_.Release();
+}
+inline void WatchEvent::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    
   } else {
+    
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.WatchEvent.Key)
+}
 
+// bytes Value = 3;
+inline void WatchEvent::clear_value() {
+  _impl_.value_.ClearToEmpty();
+}
+inline const std::string& WatchEvent::value() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.WatchEvent.Value)
+  return _internal_value();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void WatchEvent::set_value(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.value_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.WatchEvent.Value)
+}
+inline std::string* WatchEvent::mutable_value() {
+  std::string* _s = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.WatchEvent.Value)
+  return _s;
+}
+inline const std::string& WatchEvent::_internal_value() const {
+  return _impl_.value_.Get();
+}
+inline void WatchEvent::_internal_set_value(const std::string& value) {
+  
+  _impl_.value_.Set(value, GetArenaForAllocation());
+}
+inline std::string* WatchEvent::_internal_mutable_value() {
+  
+  return _impl_.value_.Mutable(GetArenaForAllocation());
+}
+inline std::string* WatchEvent::release_value() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.WatchEvent.Value)
+  return _impl_.value_.Release();
+}
+inline void WatchEvent::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
+    
+  } else {
+    
   }
-  err_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), err,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.GetReply.Err)
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.WatchEvent.Value)
 }
-inline std::string* GetReply::unsafe_arena_release_err() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:raftKVRpcProctoc.GetReply.Err)
-  GOOGLE_DCHECK(GetArena() != nullptr);
 
-  return err_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
+// int64 Revision = 4;
+inline void WatchEvent::clear_revision() {
+  _impl_.revision_ = int64_t{0};
+}
+inline int64_t WatchEvent::_internal_revision() const {
+  return _impl_.revision_;
+}
+inline int64_t WatchEvent::revision() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.WatchEvent.Revision)
+  return _internal_revision();
+}
+inline void WatchEvent::_internal_set_revision(int64_t value) {
+  
+  _impl_.revision_ = value;
+}
+inline void WatchEvent::set_revision(int64_t value) {
+  _internal_set_revision(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.WatchEvent.Revision)
 }
-inline void GetReply::unsafe_arena_set_allocated_err(
-    std::string* err) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (err != nullptr) {
 
-  } else {
+// -------------------------------------------------------------------
+
+// WatchReply
 
+// bytes Err = 1;
+inline void WatchReply::clear_err() {
+  _impl_.err_.ClearToEmpty();
+}
+inline const std::string& WatchReply::err() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.WatchReply.Err)
+  return _internal_err();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void WatchReply::set_err(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.err_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.WatchReply.Err)
+}
+inline std::string* WatchReply::mutable_err() {
+  std::string* _s = _internal_mutable_err();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.WatchReply.Err)
+  return _s;
+}
+inline const std::string& WatchReply::_internal_err() const {
+  return _impl_.err_.Get();
+}
+inline void WatchReply::_internal_set_err(const std::string& value) {
+  
+  _impl_.err_.Set(value, GetArenaForAllocation());
+}
+inline std::string* WatchReply::_internal_mutable_err() {
+  
+  return _impl_.err_.Mutable(GetArenaForAllocation());
+}
+inline std::string* WatchReply::release_err() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.WatchReply.Err)
+  return _impl_.err_.Release();
+}
+inline void WatchReply::set_allocated_err(std::string* err) {
+  if (err != nullptr) {
+    
+  } else {
+    
   }
-  err_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      err, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:raftKVRpcProctoc.GetReply.Err)
+  _impl_.err_.SetAllocated(err, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.err_.IsDefault()) {
+    _impl_.err_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.WatchReply.Err)
 }
 
-// bytes Value = 2;
-inline void GetReply::clear_value() {
-  value_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+// repeated .raftKVRpcProctoc.WatchEvent Events = 2;
+inline int WatchReply::_internal_events_size() const {
+  return _impl_.events_.size();
 }
-inline const std::string& GetReply::value() const {
-  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.GetReply.Value)
-  return _internal_value();
+inline int WatchReply::events_size() const {
+  return _internal_events_size();
 }
-inline void GetReply::set_value(const std::string& value) {
-  _internal_set_value(value);
-  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.GetReply.Value)
+inline void WatchReply::clear_events() {
+  _impl_.events_.Clear();
 }
-inline std::string* GetReply::mutable_value() {
-  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.GetReply.Value)
-  return _internal_mutable_value();
+inline ::raftKVRpcProctoc::WatchEvent* WatchReply::mutable_events(int index) {
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.WatchReply.Events)
+  return _impl_.events_.Mutable(index);
 }
-inline const std::string& GetReply::_internal_value() const {
-  return value_.Get();
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::WatchEvent >*
+WatchReply::mutable_events() {
+  // @@protoc_insertion_point(field_mutable_list:raftKVRpcProctoc.WatchReply.Events)
+  return &_impl_.events_;
 }
-inline void GetReply::_internal_set_value(const std::string& value) {
-
-  value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+inline const ::raftKVRpcProctoc::WatchEvent& WatchReply::_internal_events(int index) const {
+  return _impl_.events_.Get(index);
+}
+inline const ::raftKVRpcProctoc::WatchEvent& WatchReply::events(int index) const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.WatchReply.Events)
+  return _internal_events(index);
+}
+inline ::raftKVRpcProctoc::WatchEvent* WatchReply::_internal_add_events() {
+  return _impl_.events_.Add();
+}
+inline ::raftKVRpcProctoc::WatchEvent* WatchReply::add_events() {
+  ::raftKVRpcProctoc::WatchEvent* _add = _internal_add_events();
+  // @@protoc_insertion_point(field_add:raftKVRpcProctoc.WatchReply.Events)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::WatchEvent >&
+WatchReply::events() const {
+  // @@protoc_insertion_point(field_list:raftKVRpcProctoc.WatchReply.Events)
+  return _impl_.events_;
 }
-inline void GetReply::set_value(std::string&& value) {
 
-  value_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:raftKVRpcProctoc.GetReply.Value)
+// int64 NextRevision = 3;
+inline void WatchReply::clear_nextrevision() {
+  _impl_.nextrevision_ = int64_t{0};
 }
-inline void GetReply::set_value(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
+inline int64_t WatchReply::_internal_nextrevision() const {
+  return _impl_.nextrevision_;
+}
+inline int64_t WatchReply::nextrevision() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.WatchReply.NextRevision)
+  return _internal_nextrevision();
+}
+inline void WatchReply::_internal_set_nextrevision(int64_t value) {
+  
+  _impl_.nextrevision_ = value;
+}
+inline void WatchReply::set_nextrevision(int64_t value) {
+  _internal_set_nextrevision(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.WatchReply.NextRevision)
+}
+
+// -------------------------------------------------------------------
 
-  value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:raftKVRpcProctoc.GetReply.Value)
+// TxnCompare
+
+// bytes Key = 1;
+inline void TxnCompare::clear_key() {
+  _impl_.key_.ClearToEmpty();
+}
+inline const std::string& TxnCompare::key() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.TxnCompare.Key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TxnCompare::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.TxnCompare.Key)
+}
+inline std::string* TxnCompare::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.TxnCompare.Key)
+  return _s;
+}
+inline const std::string& TxnCompare::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void TxnCompare::_internal_set_key(const std::string& value) {
+  
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* TxnCompare::_internal_mutable_key() {
+  
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* TxnCompare::release_key() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.TxnCompare.Key)
+  return _impl_.key_.Release();
+}
+inline void TxnCompare::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.TxnCompare.Key)
 }
-inline void GetReply::set_value(const void* value,
-    size_t size) {
 
-  value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:raftKVRpcProctoc.GetReply.Value)
+// .raftKVRpcProctoc.TxnCompare.Result Cmp = 2;
+inline void TxnCompare::clear_cmp() {
+  _impl_.cmp_ = 0;
+}
+inline ::raftKVRpcProctoc::TxnCompare_Result TxnCompare::_internal_cmp() const {
+  return static_cast< ::raftKVRpcProctoc::TxnCompare_Result >(_impl_.cmp_);
+}
+inline ::raftKVRpcProctoc::TxnCompare_Result TxnCompare::cmp() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.TxnCompare.Cmp)
+  return _internal_cmp();
+}
+inline void TxnCompare::_internal_set_cmp(::raftKVRpcProctoc::TxnCompare_Result value) {
+  
+  _impl_.cmp_ = value;
+}
+inline void TxnCompare::set_cmp(::raftKVRpcProctoc::TxnCompare_Result value) {
+  _internal_set_cmp(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.TxnCompare.Cmp)
 }
-inline std::string* GetReply::_internal_mutable_value() {
 
-  return value_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+// bytes Value = 3;
+inline void TxnCompare::clear_value() {
+  _impl_.value_.ClearToEmpty();
 }
-inline std::string* GetReply::release_value() {
-  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.GetReply.Value)
-  return value_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline const std::string& TxnCompare::value() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.TxnCompare.Value)
+  return _internal_value();
 }
-inline void GetReply::set_allocated_value(std::string* value) {
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TxnCompare::set_value(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.value_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.TxnCompare.Value)
+}
+inline std::string* TxnCompare::mutable_value() {
+  std::string* _s = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.TxnCompare.Value)
+  return _s;
+}
+inline const std::string& TxnCompare::_internal_value() const {
+  return _impl_.value_.Get();
+}
+inline void TxnCompare::_internal_set_value(const std::string& value) {
+  
+  _impl_.value_.Set(value, GetArenaForAllocation());
+}
+inline std::string* TxnCompare::_internal_mutable_value() {
+  
+  return _impl_.value_.Mutable(GetArenaForAllocation());
+}
+inline std::string* TxnCompare::release_value() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.TxnCompare.Value)
+  return _impl_.value_.Release();
+}
+inline void TxnCompare::set_allocated_value(std::string* value) {
   if (value != nullptr) {
-
+    
   } else {
+    
+  }
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.TxnCompare.Value)
+}
+
+// -------------------------------------------------------------------
 
+// TxnOp
+
+// .raftKVRpcProctoc.TxnOp.Type OpType = 1;
+inline void TxnOp::clear_optype() {
+  _impl_.optype_ = 0;
+}
+inline ::raftKVRpcProctoc::TxnOp_Type TxnOp::_internal_optype() const {
+  return static_cast< ::raftKVRpcProctoc::TxnOp_Type >(_impl_.optype_);
+}
+inline ::raftKVRpcProctoc::TxnOp_Type TxnOp::optype() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.TxnOp.OpType)
+  return _internal_optype();
+}
+inline void TxnOp::_internal_set_optype(::raftKVRpcProctoc::TxnOp_Type value) {
+  
+  _impl_.optype_ = value;
+}
+inline void TxnOp::set_optype(::raftKVRpcProctoc::TxnOp_Type value) {
+  _internal_set_optype(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.TxnOp.OpType)
+}
+
+// bytes Key = 2;
+inline void TxnOp::clear_key() {
+  _impl_.key_.ClearToEmpty();
+}
+inline const std::string& TxnOp::key() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.TxnOp.Key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TxnOp::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.TxnOp.Key)
+}
+inline std::string* TxnOp::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.TxnOp.Key)
+  return _s;
+}
+inline const std::string& TxnOp::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void TxnOp::_internal_set_key(const std::string& value) {
+  
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* TxnOp::_internal_mutable_key() {
+  
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* TxnOp::release_key() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.TxnOp.Key)
+  return _impl_.key_.Release();
+}
+inline void TxnOp::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    
+  } else {
+    
   }
-  value_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.GetReply.Value)
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.TxnOp.Key)
+}
+
+// bytes Value = 3;
+inline void TxnOp::clear_value() {
+  _impl_.value_.ClearToEmpty();
+}
+inline const std::string& TxnOp::value() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.TxnOp.Value)
+  return _internal_value();
 }
-inline std::string* GetReply::unsafe_arena_release_value() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:raftKVRpcProctoc.GetReply.Value)
-  GOOGLE_DCHECK(GetArena() != nullptr);
-
-  return value_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TxnOp::set_value(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.value_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.TxnOp.Value)
+}
+inline std::string* TxnOp::mutable_value() {
+  std::string* _s = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.TxnOp.Value)
+  return _s;
+}
+inline const std::string& TxnOp::_internal_value() const {
+  return _impl_.value_.Get();
+}
+inline void TxnOp::_internal_set_value(const std::string& value) {
+  
+  _impl_.value_.Set(value, GetArenaForAllocation());
 }
-inline void GetReply::unsafe_arena_set_allocated_value(
-    std::string* value) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
+inline std::string* TxnOp::_internal_mutable_value() {
+  
+  return _impl_.value_.Mutable(GetArenaForAllocation());
+}
+inline std::string* TxnOp::release_value() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.TxnOp.Value)
+  return _impl_.value_.Release();
+}
+inline void TxnOp::set_allocated_value(std::string* value) {
   if (value != nullptr) {
-
+    
   } else {
-
+    
   }
-  value_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      value, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:raftKVRpcProctoc.GetReply.Value)
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.TxnOp.Value)
 }
 
 // -------------------------------------------------------------------
 
-// PutAppendArgs
+// TxnArgs
 
-// bytes Key = 1;
-inline void PutAppendArgs::clear_key() {
-  key_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+// repeated .raftKVRpcProctoc.TxnCompare Compares = 1;
+inline int TxnArgs::_internal_compares_size() const {
+  return _impl_.compares_.size();
 }
-inline const std::string& PutAppendArgs::key() const {
-  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.PutAppendArgs.Key)
-  return _internal_key();
+inline int TxnArgs::compares_size() const {
+  return _internal_compares_size();
 }
-inline void PutAppendArgs::set_key(const std::string& value) {
-  _internal_set_key(value);
-  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.PutAppendArgs.Key)
+inline void TxnArgs::clear_compares() {
+  _impl_.compares_.Clear();
 }
-inline std::string* PutAppendArgs::mutable_key() {
-  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.PutAppendArgs.Key)
-  return _internal_mutable_key();
+inline ::raftKVRpcProctoc::TxnCompare* TxnArgs::mutable_compares(int index) {
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.TxnArgs.Compares)
+  return _impl_.compares_.Mutable(index);
 }
-inline const std::string& PutAppendArgs::_internal_key() const {
-  return key_.Get();
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::TxnCompare >*
+TxnArgs::mutable_compares() {
+  // @@protoc_insertion_point(field_mutable_list:raftKVRpcProctoc.TxnArgs.Compares)
+  return &_impl_.compares_;
 }
-inline void PutAppendArgs::_internal_set_key(const std::string& value) {
-
-  key_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+inline const ::raftKVRpcProctoc::TxnCompare& TxnArgs::_internal_compares(int index) const {
+  return _impl_.compares_.Get(index);
 }
-inline void PutAppendArgs::set_key(std::string&& value) {
-
-  key_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:raftKVRpcProctoc.PutAppendArgs.Key)
+inline const ::raftKVRpcProctoc::TxnCompare& TxnArgs::compares(int index) const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.TxnArgs.Compares)
+  return _internal_compares(index);
 }
-inline void PutAppendArgs::set_key(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-
-  key_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:raftKVRpcProctoc.PutAppendArgs.Key)
+inline ::raftKVRpcProctoc::TxnCompare* TxnArgs::_internal_add_compares() {
+  return _impl_.compares_.Add();
 }
-inline void PutAppendArgs::set_key(const void* value,
-    size_t size) {
-
-  key_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:raftKVRpcProctoc.PutAppendArgs.Key)
+inline ::raftKVRpcProctoc::TxnCompare* TxnArgs::add_compares() {
+  ::raftKVRpcProctoc::TxnCompare* _add = _internal_add_compares();
+  // @@protoc_insertion_point(field_add:raftKVRpcProctoc.TxnArgs.Compares)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::TxnCompare >&
+TxnArgs::compares() const {
+  // @@protoc_insertion_point(field_list:raftKVRpcProctoc.TxnArgs.Compares)
+  return _impl_.compares_;
 }
-inline std::string* PutAppendArgs::_internal_mutable_key() {
 
-  return key_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+// repeated .raftKVRpcProctoc.TxnOp Success = 2;
+inline int TxnArgs::_internal_success_size() const {
+  return _impl_.success_.size();
 }
-inline std::string* PutAppendArgs::release_key() {
-  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.PutAppendArgs.Key)
-  return key_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline int TxnArgs::success_size() const {
+  return _internal_success_size();
 }
-inline void PutAppendArgs::set_allocated_key(std::string* key) {
-  if (key != nullptr) {
-
-  } else {
-
-  }
-  key_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), key,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.PutAppendArgs.Key)
+inline void TxnArgs::clear_success() {
+  _impl_.success_.Clear();
 }
-inline std::string* PutAppendArgs::unsafe_arena_release_key() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:raftKVRpcProctoc.PutAppendArgs.Key)
-  GOOGLE_DCHECK(GetArena() != nullptr);
-
-  return key_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
+inline ::raftKVRpcProctoc::TxnOp* TxnArgs::mutable_success(int index) {
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.TxnArgs.Success)
+  return _impl_.success_.Mutable(index);
 }
-inline void PutAppendArgs::unsafe_arena_set_allocated_key(
-    std::string* key) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (key != nullptr) {
-
-  } else {
-
-  }
-  key_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      key, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:raftKVRpcProctoc.PutAppendArgs.Key)
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::TxnOp >*
+TxnArgs::mutable_success() {
+  // @@protoc_insertion_point(field_mutable_list:raftKVRpcProctoc.TxnArgs.Success)
+  return &_impl_.success_;
 }
-
-// bytes Value = 2;
-inline void PutAppendArgs::clear_value() {
-  value_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline const ::raftKVRpcProctoc::TxnOp& TxnArgs::_internal_success(int index) const {
+  return _impl_.success_.Get(index);
 }
-inline const std::string& PutAppendArgs::value() const {
-  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.PutAppendArgs.Value)
-  return _internal_value();
+inline const ::raftKVRpcProctoc::TxnOp& TxnArgs::success(int index) const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.TxnArgs.Success)
+  return _internal_success(index);
 }
-inline void PutAppendArgs::set_value(const std::string& value) {
-  _internal_set_value(value);
-  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.PutAppendArgs.Value)
+inline ::raftKVRpcProctoc::TxnOp* TxnArgs::_internal_add_success() {
+  return _impl_.success_.Add();
 }
-inline std::string* PutAppendArgs::mutable_value() {
-  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.PutAppendArgs.Value)
-  return _internal_mutable_value();
+inline ::raftKVRpcProctoc::TxnOp* TxnArgs::add_success() {
+  ::raftKVRpcProctoc::TxnOp* _add = _internal_add_success();
+  // @@protoc_insertion_point(field_add:raftKVRpcProctoc.TxnArgs.Success)
+  return _add;
 }
-inline const std::string& PutAppendArgs::_internal_value() const {
-  return value_.Get();
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::TxnOp >&
+TxnArgs::success() const {
+  // @@protoc_insertion_point(field_list:raftKVRpcProctoc.TxnArgs.Success)
+  return _impl_.success_;
 }
-inline void PutAppendArgs::_internal_set_value(const std::string& value) {
 
-  value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+// repeated .raftKVRpcProctoc.TxnOp Failure = 3;
+inline int TxnArgs::_internal_failure_size() const {
+  return _impl_.failure_.size();
 }
-inline void PutAppendArgs::set_value(std::string&& value) {
-
-  value_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:raftKVRpcProctoc.PutAppendArgs.Value)
+inline int TxnArgs::failure_size() const {
+  return _internal_failure_size();
 }
-inline void PutAppendArgs::set_value(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-
-  value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:raftKVRpcProctoc.PutAppendArgs.Value)
+inline void TxnArgs::clear_failure() {
+  _impl_.failure_.Clear();
 }
-inline void PutAppendArgs::set_value(const void* value,
-    size_t size) {
-
-  value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:raftKVRpcProctoc.PutAppendArgs.Value)
+inline ::raftKVRpcProctoc::TxnOp* TxnArgs::mutable_failure(int index) {
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.TxnArgs.Failure)
+  return _impl_.failure_.Mutable(index);
 }
-inline std::string* PutAppendArgs::_internal_mutable_value() {
-
-  return value_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::TxnOp >*
+TxnArgs::mutable_failure() {
+  // @@protoc_insertion_point(field_mutable_list:raftKVRpcProctoc.TxnArgs.Failure)
+  return &_impl_.failure_;
 }
-inline std::string* PutAppendArgs::release_value() {
-  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.PutAppendArgs.Value)
-  return value_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline const ::raftKVRpcProctoc::TxnOp& TxnArgs::_internal_failure(int index) const {
+  return _impl_.failure_.Get(index);
+}
+inline const ::raftKVRpcProctoc::TxnOp& TxnArgs::failure(int index) const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.TxnArgs.Failure)
+  return _internal_failure(index);
+}
+inline ::raftKVRpcProctoc::TxnOp* TxnArgs::_internal_add_failure() {
+  return _impl_.failure_.Add();
+}
+inline ::raftKVRpcProctoc::TxnOp* TxnArgs::add_failure() {
+  ::raftKVRpcProctoc::TxnOp* _add = _internal_add_failure();
+  // @@protoc_insertion_point(field_add:raftKVRpcProctoc.TxnArgs.Failure)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::TxnOp >&
+TxnArgs::failure() const {
+  // @@protoc_insertion_point(field_list:raftKVRpcProctoc.TxnArgs.Failure)
+  return _impl_.failure_;
 }
-inline void PutAppendArgs::set_allocated_value(std::string* value) {
-  if (value != nullptr) {
-
-  } else {
 
-  }
-  value_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.PutAppendArgs.Value)
+// uint64 ClientId = 4;
+inline void TxnArgs::clear_clientid() {
+  _impl_.clientid_ = uint64_t{0u};
+}
+inline uint64_t TxnArgs::_internal_clientid() const {
+  return _impl_.clientid_;
+}
+inline uint64_t TxnArgs::clientid() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.TxnArgs.ClientId)
+  return _internal_clientid();
+}
+inline void TxnArgs::_internal_set_clientid(uint64_t value) {
+  
+  _impl_.clientid_ = value;
+}
+inline void TxnArgs::set_clientid(uint64_t value) {
+  _internal_set_clientid(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.TxnArgs.ClientId)
 }
-inline std::string* PutAppendArgs::unsafe_arena_release_value() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:raftKVRpcProctoc.PutAppendArgs.Value)
-  GOOGLE_DCHECK(GetArena() != nullptr);
 
-  return value_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
+// int32 RequestId = 5;
+inline void TxnArgs::clear_requestid() {
+  _impl_.requestid_ = 0;
+}
+inline int32_t TxnArgs::_internal_requestid() const {
+  return _impl_.requestid_;
+}
+inline int32_t TxnArgs::requestid() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.TxnArgs.RequestId)
+  return _internal_requestid();
+}
+inline void TxnArgs::_internal_set_requestid(int32_t value) {
+  
+  _impl_.requestid_ = value;
+}
+inline void TxnArgs::set_requestid(int32_t value) {
+  _internal_set_requestid(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.TxnArgs.RequestId)
 }
-inline void PutAppendArgs::unsafe_arena_set_allocated_value(
-    std::string* value) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (value != nullptr) {
 
-  } else {
+// -------------------------------------------------------------------
 
-  }
-  value_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      value, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:raftKVRpcProctoc.PutAppendArgs.Value)
-}
+// TxnResult
 
-// bytes Op = 3;
-inline void PutAppendArgs::clear_op() {
-  op_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+// bool Exists = 1;
+inline void TxnResult::clear_exists() {
+  _impl_.exists_ = false;
 }
-inline const std::string& PutAppendArgs::op() const {
-  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.PutAppendArgs.Op)
-  return _internal_op();
+inline bool TxnResult::_internal_exists() const {
+  return _impl_.exists_;
 }
-inline void PutAppendArgs::set_op(const std::string& value) {
-  _internal_set_op(value);
-  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.PutAppendArgs.Op)
+inline bool TxnResult::exists() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.TxnResult.Exists)
+  return _internal_exists();
 }
-inline std::string* PutAppendArgs::mutable_op() {
-  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.PutAppendArgs.Op)
-  return _internal_mutable_op();
+inline void TxnResult::_internal_set_exists(bool value) {
+  
+  _impl_.exists_ = value;
 }
-inline const std::string& PutAppendArgs::_internal_op() const {
-  return op_.Get();
+inline void TxnResult::set_exists(bool value) {
+  _internal_set_exists(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.TxnResult.Exists)
 }
-inline void PutAppendArgs::_internal_set_op(const std::string& value) {
 
-  op_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+// bytes Value = 2;
+inline void TxnResult::clear_value() {
+  _impl_.value_.ClearToEmpty();
 }
-inline void PutAppendArgs::set_op(std::string&& value) {
-
-  op_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:raftKVRpcProctoc.PutAppendArgs.Op)
+inline const std::string& TxnResult::value() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.TxnResult.Value)
+  return _internal_value();
 }
-inline void PutAppendArgs::set_op(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-
-  op_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:raftKVRpcProctoc.PutAppendArgs.Op)
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TxnResult::set_value(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.value_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.TxnResult.Value)
 }
-inline void PutAppendArgs::set_op(const void* value,
-    size_t size) {
-
-  op_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:raftKVRpcProctoc.PutAppendArgs.Op)
+inline std::string* TxnResult::mutable_value() {
+  std::string* _s = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.TxnResult.Value)
+  return _s;
 }
-inline std::string* PutAppendArgs::_internal_mutable_op() {
-
-  return op_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline const std::string& TxnResult::_internal_value() const {
+  return _impl_.value_.Get();
 }
-inline std::string* PutAppendArgs::release_op() {
-  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.PutAppendArgs.Op)
-  return op_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline void TxnResult::_internal_set_value(const std::string& value) {
+  
+  _impl_.value_.Set(value, GetArenaForAllocation());
 }
-inline void PutAppendArgs::set_allocated_op(std::string* op) {
-  if (op != nullptr) {
-
+inline std::string* TxnResult::_internal_mutable_value() {
+  
+  return _impl_.value_.Mutable(GetArenaForAllocation());
+}
+inline std::string* TxnResult::release_value() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.TxnResult.Value)
+  return _impl_.value_.Release();
+}
+inline void TxnResult::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
+    
   } else {
-
+    
   }
-  op_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), op,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.PutAppendArgs.Op)
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.TxnResult.Value)
 }
-inline std::string* PutAppendArgs::unsafe_arena_release_op() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:raftKVRpcProctoc.PutAppendArgs.Op)
-  GOOGLE_DCHECK(GetArena() != nullptr);
 
-  return op_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
-}
-inline void PutAppendArgs::unsafe_arena_set_allocated_op(
-    std::string* op) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (op != nullptr) {
+// -------------------------------------------------------------------
 
-  } else {
+// TxnReply
 
-  }
-  op_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      op, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:raftKVRpcProctoc.PutAppendArgs.Op)
+// bytes Err = 1;
+inline void TxnReply::clear_err() {
+  _impl_.err_.ClearToEmpty();
 }
-
-// bytes ClientId = 4;
-inline void PutAppendArgs::clear_clientid() {
-  clientid_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline const std::string& TxnReply::err() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.TxnReply.Err)
+  return _internal_err();
 }
-inline const std::string& PutAppendArgs::clientid() const {
-  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.PutAppendArgs.ClientId)
-  return _internal_clientid();
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TxnReply::set_err(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.err_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.TxnReply.Err)
 }
-inline void PutAppendArgs::set_clientid(const std::string& value) {
-  _internal_set_clientid(value);
-  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.PutAppendArgs.ClientId)
+inline std::string* TxnReply::mutable_err() {
+  std::string* _s = _internal_mutable_err();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.TxnReply.Err)
+  return _s;
 }
-inline std::string* PutAppendArgs::mutable_clientid() {
-  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.PutAppendArgs.ClientId)
-  return _internal_mutable_clientid();
+inline const std::string& TxnReply::_internal_err() const {
+  return _impl_.err_.Get();
 }
-inline const std::string& PutAppendArgs::_internal_clientid() const {
-  return clientid_.Get();
+inline void TxnReply::_internal_set_err(const std::string& value) {
+  
+  _impl_.err_.Set(value, GetArenaForAllocation());
 }
-inline void PutAppendArgs::_internal_set_clientid(const std::string& value) {
-
-  clientid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+inline std::string* TxnReply::_internal_mutable_err() {
+  
+  return _impl_.err_.Mutable(GetArenaForAllocation());
 }
-inline void PutAppendArgs::set_clientid(std::string&& value) {
-
-  clientid_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:raftKVRpcProctoc.PutAppendArgs.ClientId)
+inline std::string* TxnReply::release_err() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.TxnReply.Err)
+  return _impl_.err_.Release();
 }
-inline void PutAppendArgs::set_clientid(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-
-  clientid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:raftKVRpcProctoc.PutAppendArgs.ClientId)
+inline void TxnReply::set_allocated_err(std::string* err) {
+  if (err != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.err_.SetAllocated(err, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.err_.IsDefault()) {
+    _impl_.err_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.TxnReply.Err)
 }
-inline void PutAppendArgs::set_clientid(const void* value,
-    size_t size) {
 
-  clientid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:raftKVRpcProctoc.PutAppendArgs.ClientId)
+// bool Succeeded = 2;
+inline void TxnReply::clear_succeeded() {
+  _impl_.succeeded_ = false;
 }
-inline std::string* PutAppendArgs::_internal_mutable_clientid() {
-
-  return clientid_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline bool TxnReply::_internal_succeeded() const {
+  return _impl_.succeeded_;
 }
-inline std::string* PutAppendArgs::release_clientid() {
-  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.PutAppendArgs.ClientId)
-  return clientid_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline bool TxnReply::succeeded() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.TxnReply.Succeeded)
+  return _internal_succeeded();
 }
-inline void PutAppendArgs::set_allocated_clientid(std::string* clientid) {
-  if (clientid != nullptr) {
-
-  } else {
-
-  }
-  clientid_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), clientid,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.PutAppendArgs.ClientId)
+inline void TxnReply::_internal_set_succeeded(bool value) {
+  
+  _impl_.succeeded_ = value;
 }
-inline std::string* PutAppendArgs::unsafe_arena_release_clientid() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:raftKVRpcProctoc.PutAppendArgs.ClientId)
-  GOOGLE_DCHECK(GetArena() != nullptr);
-
-  return clientid_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
+inline void TxnReply::set_succeeded(bool value) {
+  _internal_set_succeeded(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.TxnReply.Succeeded)
 }
-inline void PutAppendArgs::unsafe_arena_set_allocated_clientid(
-    std::string* clientid) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (clientid != nullptr) {
-
-  } else {
 
-  }
-  clientid_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      clientid, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:raftKVRpcProctoc.PutAppendArgs.ClientId)
+// repeated .raftKVRpcProctoc.TxnResult Results = 3;
+inline int TxnReply::_internal_results_size() const {
+  return _impl_.results_.size();
 }
-
-// int32 RequestId = 5;
-inline void PutAppendArgs::clear_requestid() {
-  requestid_ = 0;
+inline int TxnReply::results_size() const {
+  return _internal_results_size();
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 PutAppendArgs::_internal_requestid() const {
-  return requestid_;
+inline void TxnReply::clear_results() {
+  _impl_.results_.Clear();
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 PutAppendArgs::requestid() const {
-  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.PutAppendArgs.RequestId)
-  return _internal_requestid();
+inline ::raftKVRpcProctoc::TxnResult* TxnReply::mutable_results(int index) {
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.TxnReply.Results)
+  return _impl_.results_.Mutable(index);
 }
-inline void PutAppendArgs::_internal_set_requestid(::PROTOBUF_NAMESPACE_ID::int32 value) {
-
-  requestid_ = value;
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::TxnResult >*
+TxnReply::mutable_results() {
+  // @@protoc_insertion_point(field_mutable_list:raftKVRpcProctoc.TxnReply.Results)
+  return &_impl_.results_;
 }
-inline void PutAppendArgs::set_requestid(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  _internal_set_requestid(value);
-  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.PutAppendArgs.RequestId)
+inline const ::raftKVRpcProctoc::TxnResult& TxnReply::_internal_results(int index) const {
+  return _impl_.results_.Get(index);
+}
+inline const ::raftKVRpcProctoc::TxnResult& TxnReply::results(int index) const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.TxnReply.Results)
+  return _internal_results(index);
+}
+inline ::raftKVRpcProctoc::TxnResult* TxnReply::_internal_add_results() {
+  return _impl_.results_.Add();
+}
+inline ::raftKVRpcProctoc::TxnResult* TxnReply::add_results() {
+  ::raftKVRpcProctoc::TxnResult* _add = _internal_add_results();
+  // @@protoc_insertion_point(field_add:raftKVRpcProctoc.TxnReply.Results)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::TxnResult >&
+TxnReply::results() const {
+  // @@protoc_insertion_point(field_list:raftKVRpcProctoc.TxnReply.Results)
+  return _impl_.results_;
 }
 
 // -------------------------------------------------------------------
 
-// PutAppendReply
+// RegisterSessionArgs
+
+// -------------------------------------------------------------------
+
+// RegisterSessionReply
 
 // bytes Err = 1;
-inline void PutAppendReply::clear_err() {
-  err_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline void RegisterSessionReply::clear_err() {
+  _impl_.err_.ClearToEmpty();
 }
-inline const std::string& PutAppendReply::err() const {
-  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.PutAppendReply.Err)
+inline const std::string& RegisterSessionReply::err() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.RegisterSessionReply.Err)
   return _internal_err();
 }
-inline void PutAppendReply::set_err(const std::string& value) {
-  _internal_set_err(value);
-  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.PutAppendReply.Err)
-}
-inline std::string* PutAppendReply::mutable_err() {
-  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.PutAppendReply.Err)
-  return _internal_mutable_err();
-}
-inline const std::string& PutAppendReply::_internal_err() const {
-  return err_.Get();
-}
-inline void PutAppendReply::_internal_set_err(const std::string& value) {
-
-  err_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RegisterSessionReply::set_err(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.err_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.RegisterSessionReply.Err)
 }
-inline void PutAppendReply::set_err(std::string&& value) {
-
-  err_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:raftKVRpcProctoc.PutAppendReply.Err)
+inline std::string* RegisterSessionReply::mutable_err() {
+  std::string* _s = _internal_mutable_err();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.RegisterSessionReply.Err)
+  return _s;
 }
-inline void PutAppendReply::set_err(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-
-  err_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:raftKVRpcProctoc.PutAppendReply.Err)
+inline const std::string& RegisterSessionReply::_internal_err() const {
+  return _impl_.err_.Get();
 }
-inline void PutAppendReply::set_err(const void* value,
-    size_t size) {
-
-  err_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:raftKVRpcProctoc.PutAppendReply.Err)
+inline void RegisterSessionReply::_internal_set_err(const std::string& value) {
+  
+  _impl_.err_.Set(value, GetArenaForAllocation());
 }
-inline std::string* PutAppendReply::_internal_mutable_err() {
-
-  return err_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline std::string* RegisterSessionReply::_internal_mutable_err() {
+  
+  return _impl_.err_.Mutable(GetArenaForAllocation());
 }
-inline std::string* PutAppendReply::release_err() {
-  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.PutAppendReply.Err)
-  return err_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline std::string* RegisterSessionReply::release_err() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.RegisterSessionReply.Err)
+  return _impl_.err_.Release();
 }
-inline void PutAppendReply::set_allocated_err(std::string* err) {
+inline void RegisterSessionReply::set_allocated_err(std::string* err) {
   if (err != nullptr) {
-
+    
   } else {
-
+    
   }
-  err_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), err,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.PutAppendReply.Err)
+  _impl_.err_.SetAllocated(err, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.err_.IsDefault()) {
+    _impl_.err_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.RegisterSessionReply.Err)
 }
-inline std::string* PutAppendReply::unsafe_arena_release_err() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:raftKVRpcProctoc.PutAppendReply.Err)
-  GOOGLE_DCHECK(GetArena() != nullptr);
 
-  return err_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
+// uint64 ClientId = 2;
+inline void RegisterSessionReply::clear_clientid() {
+  _impl_.clientid_ = uint64_t{0u};
 }
-inline void PutAppendReply::unsafe_arena_set_allocated_err(
-    std::string* err) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (err != nullptr) {
-
-  } else {
-
-  }
-  err_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      err, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:raftKVRpcProctoc.PutAppendReply.Err)
+inline uint64_t RegisterSessionReply::_internal_clientid() const {
+  return _impl_.clientid_;
+}
+inline uint64_t RegisterSessionReply::clientid() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.RegisterSessionReply.ClientId)
+  return _internal_clientid();
+}
+inline void RegisterSessionReply::_internal_set_clientid(uint64_t value) {
+  
+  _impl_.clientid_ = value;
+}
+inline void RegisterSessionReply::set_clientid(uint64_t value) {
+  _internal_set_clientid(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.RegisterSessionReply.ClientId)
 }
 
 #ifdef __GNUC__
@@ -1714,12 +9068,80 @@ inline void PutAppendReply::unsafe_arena_set_allocated_err(
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
 }  // namespace raftKVRpcProctoc
 
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::raftKVRpcProctoc::WatchEvent_Type> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::raftKVRpcProctoc::WatchEvent_Type>() {
+  return ::raftKVRpcProctoc::WatchEvent_Type_descriptor();
+}
+template <> struct is_proto_enum< ::raftKVRpcProctoc::TxnCompare_Result> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::raftKVRpcProctoc::TxnCompare_Result>() {
+  return ::raftKVRpcProctoc::TxnCompare_Result_descriptor();
+}
+template <> struct is_proto_enum< ::raftKVRpcProctoc::TxnOp_Type> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::raftKVRpcProctoc::TxnOp_Type>() {
+  return ::raftKVRpcProctoc::TxnOp_Type_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
 // @@protoc_insertion_point(global_scope)
 
 #include <google/protobuf/port_undef.inc>
-#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_kvServerRPC_2eproto
\ No newline at end of file
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_kvServerRPC_2eproto
@@ -0,0 +1,787 @@
+//
+// B+树的定义和实现，作为跳表之外的另一种有序索引，接口与 SkipList 相同
+//
+
+#ifndef SKIP_LIST_ON_RAFT_BPLUSTREE_H
+#define SKIP_LIST_ON_RAFT_BPLUSTREE_H
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <mutex>
+#include <numeric>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "skipList.h"
+
+/*
+BPlusTree 类模板
+主要功能：内存中的 B+ 树，接口与 SkipList 保持一致（search_element、upsert、try_emplace、scan_elements、dump_to 等），两者可以互相替换
+设计：
+    1. 每个节点的键放在连续的数组里，并且和跳表节点一样保存每个键的8字节前缀指纹（SkipListKeyLayout），
+       节点内二分查找时大部分比较只比较整数；一次查找只访问树高个节点，比跳表逐个节点跳转的缓存缺失少
+    2. 叶子节点之间用 next 指针串起来，范围查找和导出沿叶子顺序遍历
+    3. 插入时节点满了就一分为二；删除后节点少于 1/4 时先尝试和相邻的兄弟合并，放不下就从兄弟借一个，树始终平衡
+    4. 空树上的批量写入（例如安装快照）直接自底向上建树，每个节点留出 1/4 的空位给之后的插入
+注意：写操作加锁（与 SkipList 一样），读操作不加锁，并发读写需要调用者保证；
+     try_emplace 返回的值指针在下一次写操作之前有效（节点分裂或合并会移动值）
+*/
+template <typename K, typename V>
+class BPlusTree {
+  using KeyLayout = SkipListKeyLayout<K>;
+
+public:
+  static constexpr int kLeafSlots = 32;   // 叶子节点最多的键数
+  static constexpr int kInnerSlots = 32;  // 内部节点最多的键数，孩子数最多为 kInnerSlots + 1
+  static constexpr int kMaxHeight = 32;
+
+  BPlusTree();
+  ~BPlusTree();
+  BPlusTree(const BPlusTree &) = delete;
+  BPlusTree &operator=(const BPlusTree &) = delete;
+
+  // 查找一个指定键值的元素，返回是否找到，并将值赋给 value；不加锁
+  template <typename Key, typename Out>
+  bool search_element(const Key &key, Out &value);
+
+  template <typename Key>
+  bool delete_element(const Key &key);    // 删除一个指定键的元素，返回键是否存在
+
+  // 插入或覆盖，返回是否插入了新键
+  template <typename Key, typename Value>
+  bool upsert(Key &&key, Value &&value);
+
+  // 键不存在时用 args 构造值插入；键已存在时不修改。返回值的指针和是否插入
+  template <typename Key, typename... Args>
+  std::pair<V *, bool> try_emplace(Key &&key, Args &&...args);
+
+  // 键存在时调用 fn(V &) 原地修改值，返回键是否存在
+  template <typename Key, typename F>
+  bool update_in_place(const Key &key, F &&fn);
+
+  // 在键已有的值后面追加 suffix，键不存在时以 suffix 为值插入
+  template <typename S>
+  void append_element(const K &key, const S &suffix);
+
+  template <typename U>
+  void insert_set_elements(const std::vector<K> &keys, const std::vector<U> &values);   // 批量插入或设置元素
+
+  template <typename U>
+  void insert_set_elements(std::vector<K> &&keys, std::vector<U> &&values);   // 同上，键和值移动进树，用于安装快照
+
+  // 范围查找，语义与 SkipList::scan_elements 相同
+  template <typename U>
+  bool scan_elements(const K &start, const K &end, bool hasEnd, size_t limit, std::vector<K> *keys,
+                     std::vector<U> *values, K *next);
+
+  void dump_to(SkipListDump<K, V> *dumper);   // 按键的顺序把所有元素追加到 dumper 中，格式与跳表相同
+
+  void display_list();    // 显示所有元素，主要用于调试
+
+  int size();     // 返回元素的数量
+
+private:
+  struct NodeBase {
+    bool leaf;
+    int count = 0;    // 键的个数；内部节点的孩子数为 count + 1
+  };
+
+  struct LeafNode : NodeBase {
+    LeafNode() { this->leaf = true; }
+    uint64_t prefixes[kLeafSlots];    // 键的前缀指纹，与 keys 一一对应
+    K keys[kLeafSlots];
+    V values[kLeafSlots];
+    LeafNode *next = nullptr;   // 右边相邻的叶子
+  };
+
+  // children[i] 中的键都小于 keys[i]，children[i + 1] 中的键都不小于 keys[i]
+  struct InnerNode : NodeBase {
+    InnerNode() { this->leaf = false; }
+    uint64_t prefixes[kInnerSlots];
+    K keys[kInnerSlots];
+    NodeBase *children[kInnerSlots + 1];
+  };
+
+  struct PathEntry {
+    InnerNode *node;
+    int index;    // 下降时走的孩子下标
+  };
+
+  static constexpr int kMinLeafKeys = kLeafSlots / 4;
+  static constexpr int kMinInnerKeys = kInnerSlots / 4;
+
+  // 节点中第 i 个键是否小于 key，prefix 为 key 的前缀指纹
+  template <typename Node, typename Key>
+  static bool slot_less(const Node *node, int i, const Key &key, uint64_t prefix) {
+    if constexpr (KeyLayout::has_prefix) {
+      if (node->prefixes[i] != prefix) {
+        return node->prefixes[i] < prefix;
+      }
+    }
+    return KeyLayout::less(node->keys[i], key);
+  }
+
+  // key 是否小于节点中第 i 个键
+  template <typename Node, typename Key>
+  static bool key_less_slot(const Key &key, uint64_t prefix, const Node *node, int i) {
+    if constexpr (KeyLayout::has_prefix) {
+      if (node->prefixes[i] != prefix) {
+        return prefix < node->prefixes[i];
+      }
+    }
+    return KeyLayout::less(key, node->keys[i]);
+  }
+
+  template <typename Node, typename Key>
+  static bool slot_equal(const Node *node, int i, const Key &key, uint64_t prefix) {
+    if constexpr (KeyLayout::has_prefix) {
+      if (node->prefixes[i] != prefix) {
+        return false;
+      }
+    }
+    return KeyLayout::equal(node->keys[i], key);
+  }
+
+  // 节点中第一个不小于 key 的下标
+  template <typename Node, typename Key>
+  static int lower_bound(const Node *node, const Key &key, uint64_t prefix) {
+    int lo = 0, hi = node->count;
+    while (lo < hi) {
+      int mid = (lo + hi) / 2;
+      if (slot_less(node, mid, key, prefix)) {
+        lo = mid + 1;
+      } else {
+        hi = mid;
+      }
+    }
+    return lo;
+  }
+
+  // 节点中第一个大于 key 的下标，也就是内部节点中 key 所在的孩子
+  template <typename Node, typename Key>
+  static int upper_bound(const Node *node, const Key &key, uint64_t prefix) {
+    int lo = 0, hi = node->count;
+    while (lo < hi) {
+      int mid = (lo + hi) / 2;
+      if (key_less_slot(key, prefix, node, mid)) {
+        hi = mid;
+      } else {
+        lo = mid + 1;
+      }
+    }
+    return lo;
+  }
+
+  template <typename Key, typename... Args>
+  std::pair<V *, bool> emplace_locked(Key &&key, Args &&...args);
+
+  template <typename Key>
+  LeafNode *find_leaf(const Key &key, uint64_t prefix, PathEntry *path, int *depth);
+
+  void insert_into_parent(PathEntry *path, int depth, K separator, uint64_t prefix, NodeBase *right);
+
+  template <typename Key>
+  bool erase_from(NodeBase *node, const Key &key, uint64_t prefix);
+
+  void rebalance_child(InnerNode *parent, int index);
+
+  static void remove_inner_entry(InnerNode *node, int index);   // 删除 keys[index] 和 children[index + 1]
+
+  template <typename Keys, typename Values>
+  void insert_set_elements_impl(Keys &&keys, Values &&values);
+
+  void build_from_sorted(std::vector<K> &keys, std::vector<V> &values);
+
+  LeafNode *leftmost_leaf();
+
+  void destroy(NodeBase *node);
+
+private:
+  NodeBase *_root;
+  size_t _element_count;
+  std::mutex _mtx;
+};
+
+template <typename K, typename V>
+BPlusTree<K, V>::BPlusTree() : _root(new LeafNode()), _element_count(0) {}
+
+template <typename K, typename V>
+BPlusTree<K, V>::~BPlusTree() {
+  destroy(_root);
+}
+
+template <typename K, typename V>
+void BPlusTree<K, V>::destroy(NodeBase *node) {
+  if (node->leaf) {
+    delete static_cast<LeafNode *>(node);
+    return;
+  }
+  auto *inner = static_cast<InnerNode *>(node);
+  for (int i = 0; i <= inner->count; i++) {
+    destroy(inner->children[i]);
+  }
+  delete inner;
+}
+
+/*
+find_leaf 函数
+主要功能：从根下降到 key 所在的叶子，path 记录经过的内部节点和走的孩子下标（path 可以为空）
+*/
+template <typename K, typename V>
+template <typename Key>
+typename BPlusTree<K, V>::LeafNode *BPlusTree<K, V>::find_leaf(const Key &key, uint64_t prefix, PathEntry *path,
+                                                               int *depth) {
+  NodeBase *node = _root;
+  int d = 0;
+  while (!node->leaf) {
+    auto *inner = static_cast<InnerNode *>(node);
+    int index = upper_bound(inner, key, prefix);
+    if (path != nullptr) {
+      path[d] = {inner, index};
+    }
+    d++;
+    node = inner->children[index];
+  }
+  if (depth != nullptr) {
+    *depth = d;
+  }
+  return static_cast<LeafNode *>(node);
+}
+
+template <typename K, typename V>
+typename BPlusTree<K, V>::LeafNode *BPlusTree<K, V>::leftmost_leaf() {
+  NodeBase *node = _root;
+  while (!node->leaf) {
+    node = static_cast<InnerNode *>(node)->children[0];
+  }
+  return static_cast<LeafNode *>(node);
+}
+
+/*
+search_element 函数
+主要功能：下降到叶子后在叶子内二分查找
+*/
+template <typename K, typename V>
+template <typename Key, typename Out>
+bool BPlusTree<K, V>::search_element(const Key &key, Out &value) {
+  uint64_t prefix = KeyLayout::prefix(key);
+  LeafNode *leaf = find_leaf(key, prefix, nullptr, nullptr);
+  int pos = lower_bound(leaf, key, prefix);
+  if (pos < leaf->count && slot_equal(leaf, pos, key, prefix)) {
+    value = leaf->values[pos];
+    return true;
+  }
+  return false;
+}
+
+/*
+emplace_locked 函数
+主要功能：单次下降找到叶子。键不存在时插入：叶子满了先分裂，新叶子的第一个键作为分隔键插入父节点（父节点满了继续向上分裂），
+        再把新键放进左右两半中对应的一个；键已存在时 args 不会被使用
+注意：调用者需持有 _mtx
+*/
+template <typename K, typename V>
+template <typename Key, typename... Args>
+std::pair<V *, bool> BPlusTree<K, V>::emplace_locked(Key &&key, Args &&...args) {
+  uint64_t prefix = KeyLayout::prefix(key);
+  PathEntry path[kMaxHeight];
+  int depth = 0;
+  LeafNode *leaf = find_leaf(key, prefix, path, &depth);
+  int pos = lower_bound(leaf, key, prefix);
+  if (pos < leaf->count && slot_equal(leaf, pos, key, prefix)) {
+    return {&leaf->values[pos], false};
+  }
+
+  if (leaf->count == kLeafSlots) {
+    // 右半部分移到新叶子；新键在左半部分时插入左叶子，否则插入右叶子，新叶子的第一个键不会变，可以先插入父节点
+    const int half = kLeafSlots / 2;
+    auto *right = new LeafNode();
+    for (int i = half; i < kLeafSlots; i++) {
+      right->prefixes[i - half] = leaf->prefixes[i];
+      right->keys[i - half] = std::move(leaf->keys[i]);
+      right->values[i - half] = std::move(leaf->values[i]);
+    }
+    right->count = kLeafSlots - half;
+    leaf->count = half;
+    right->next = leaf->next;
+    leaf->next = right;
+    insert_into_parent(path, depth, right->keys[0], right->prefixes[0], right);
+    if (pos > half) {
+      leaf = right;
+      pos -= half;
+    }
+  }
+
+  for (int i = leaf->count; i > pos; i--) {
+    leaf->prefixes[i] = leaf->prefixes[i - 1];
+    leaf->keys[i] = std::move(leaf->keys[i - 1]);
+    leaf->values[i] = std::move(leaf->values[i - 1]);
+  }
+  leaf->prefixes[pos] = prefix;
+  leaf->keys[pos] = K(std::forward<Key>(key));
+  leaf->values[pos] = V(std::forward<Args>(args)...);
+  leaf->count++;
+  _element_count++;
+  return {&leaf->values[pos], true};
+}
+
+template <typename K, typename V>
+template <typename Key, typename... Args>
+std::pair<V *, bool> BPlusTree<K, V>::try_emplace(Key &&key, Args &&...args) {
+  std::lock_guard<std::mutex> lg(_mtx);
+  return emplace_locked(std::forward<Key>(key), std::forward<Args>(args)...);
+}
+
+/*
+insert_into_parent 函数
+主要功能：子节点分裂后，把分隔键和新的右节点插入 path 中的父节点；父节点满了就分裂，中间的键继续向上插入，根分裂时树长高一层
+*/
+template <typename K, typename V>
+void BPlusTree<K, V>::insert_into_parent(PathEntry *path, int depth, K separator, uint64_t prefix, NodeBase *right) {
+  for (int level = depth - 1; level >= 0; level--) {
+    InnerNode *parent = path[level].node;
+    int index = path[level].index;    // 分隔键放在 keys[index]，右节点放在 children[index + 1]
+
+    InnerNode *target = parent;
+    InnerNode *sibling = nullptr;
+    K upKey;
+    uint64_t upPrefix = 0;
+    if (parent->count == kInnerSlots) {
+      // keys[mid] 上移，keys[mid + 1..] 和 children[mid + 1..] 移到新节点
+      const int mid = kInnerSlots / 2;
+      sibling = new InnerNode();
+      for (int i = mid + 1; i < kInnerSlots; i++) {
+        sibling->prefixes[i - mid - 1] = parent->prefixes[i];
+        sibling->keys[i - mid - 1] = std::move(parent->keys[i]);
+      }
+      for (int i = mid + 1; i <= kInnerSlots; i++) {
+        sibling->children[i - mid - 1] = parent->children[i];
+      }
+      sibling->count = kInnerSlots - mid - 1;
+      upKey = std::move(parent->keys[mid]);
+      upPrefix = parent->prefixes[mid];
+      parent->count = mid;
+      if (index > mid) {
+        target = sibling;
+        index -= mid + 1;
+      }
+    }
+
+    for (int i = target->count; i > index; i--) {
+      target->prefixes[i] = target->prefixes[i - 1];
+      target->keys[i] = std::move(target->keys[i - 1]);
+      target->children[i + 1] = target->children[i];
+    }
+    target->prefixes[index] = prefix;
+    target->keys[index] = std::move(separator);
+    target->children[index + 1] = right;
+    target->count++;
+
+    if (sibling == nullptr) {
+      return;
+    }
+    separator = std::move(upKey);
+    prefix = upPrefix;
+    right = sibling;
+  }
+
+  auto *root = new InnerNode();
+  root->prefixes[0] = prefix;
+  root->keys[0] = std::move(separator);
+  root->children[0] = _root;
+  root->children[1] = right;
+  root->count = 1;
+  _root = root;
+}
+
+template <typename K, typename V>
+template <typename Key, typename Value>
+bool BPlusTree<K, V>::upsert(Key &&key, Value &&value) {
+  std::lock_guard<std::mutex> lg(_mtx);
+  auto [slot, inserted] = emplace_locked(std::forward<Key>(key), std::forward<Value>(value));
+  if (!inserted) {    // 键已存在时 value 没有被使用，这里再赋值
+    *slot = std::forward<Value>(value);
+  }
+  return inserted;
+}
+
+template <typename K, typename V>
+template <typename Key, typename F>
+bool BPlusTree<K, V>::update_in_place(const Key &key, F &&fn) {
+  std::lock_guard<std::mutex> lg(_mtx);
+  uint64_t prefix = KeyLayout::prefix(key);
+  LeafNode *leaf = find_leaf(key, prefix, nullptr, nullptr);
+  int pos = lower_bound(leaf, key, prefix);
+  if (pos == leaf->count || !slot_equal(leaf, pos, key, prefix)) {
+    return false;
+  }
+  fn(leaf->values[pos]);
+  return true;
+}
+
+template <typename K, typename V>
+template <typename S>
+void BPlusTree<K, V>::append_element(const K &key, const S &suffix) {
+  std::lock_guard<std::mutex> lg(_mtx);
+  emplace_locked(key).first->append(suffix);   // 不存在时先插入空值再追加
+}
+
+/*
+delete_element 函数
+主要功能：从根向下递归删除，回溯时调整过空的孩子；根只剩一个孩子时树变矮一层
+*/
+template <typename K, typename V>
+template <typename Key>
+bool BPlusTree<K, V>::delete_element(const Key &key) {
+  std::lock_guard<std::mutex> lg(_mtx);
+  if (!erase_from(_root, key, KeyLayout::prefix(key))) {
+    return false;
+  }
+  _element_count--;
+  if (!_root->leaf && _root->count == 0) {
+    auto *oldRoot = static_cast<InnerNode *>(_root);
+    _root = oldRoot->children[0];
+    delete oldRoot;
+  }
+  return true;
+}
+
+template <typename K, typename V>
+template <typename Key>
+bool BPlusTree<K, V>::erase_from(NodeBase *node, const Key &key, uint64_t prefix) {
+  if (node->leaf) {
+    auto *leaf = static_cast<LeafNode *>(node);
+    int pos = lower_bound(leaf, key, prefix);
+    if (pos == leaf->count || !slot_equal(leaf, pos, key, prefix)) {
+      return false;
+    }
+    for (int i = pos; i + 1 < leaf->count; i++) {
+      leaf->prefixes[i] = leaf->prefixes[i + 1];
+      leaf->keys[i] = std::move(leaf->keys[i + 1]);
+      leaf->values[i] = std::move(leaf->values[i + 1]);
+    }
+    leaf->count--;
+    leaf->keys[leaf->count] = K();    // 释放移走后留下的内容
+    leaf->values[leaf->count] = V();
+    return true;
+  }
+  auto *inner = static_cast<InnerNode *>(node);
+  int index = upper_bound(inner, key, prefix);
+  if (!erase_from(inner->children[index], key, prefix)) {
+    return false;
+  }
+  rebalance_child(inner, index);
+  return true;
+}
+
+template <typename K, typename V>
+void BPlusTree<K, V>::remove_inner_entry(InnerNode *node, int index) {
+  for (int i = index; i + 1 < node->count; i++) {
+    node->prefixes[i] = node->prefixes[i + 1];
+    node->keys[i] = std::move(node->keys[i + 1]);
+  }
+  for (int i = index + 1; i < node->count; i++) {
+    node->children[i] = node->children[i + 1];
+  }
+  node->count--;
+  node->keys[node->count] = K();
+}
+
+/*
+rebalance_child 函数
+主要功能：parent 的第 index 个孩子删除后少于最少键数时，和相邻的兄弟（优先右兄弟）一起调整：
+    1. 两个节点放得进一个节点时合并，父节点删除它们之间的分隔键
+    2. 否则从兄弟借一个键过来，并更新父节点中的分隔键
+*/
+template <typename K, typename V>
+void BPlusTree<K, V>::rebalance_child(InnerNode *parent, int index) {
+  NodeBase *child = parent->children[index];
+  if (child->count >= (child->leaf ? kMinLeafKeys : kMinInnerKeys) || parent->count == 0) {
+    return;
+  }
+  int left = index < parent->count ? index : index - 1;    // 调整 children[left] 和 children[left + 1]，分隔键为 keys[left]
+  bool childIsLeft = left == index;
+
+  if (child->leaf) {
+    auto *a = static_cast<LeafNode *>(parent->children[left]);
+    auto *b = static_cast<LeafNode *>(parent->children[left + 1]);
+    if (a->count + b->count <= kLeafSlots) {
+      for (int i = 0; i < b->count; i++) {
+        a->prefixes[a->count + i] = b->prefixes[i];
+        a->keys[a->count + i] = std::move(b->keys[i]);
+        a->values[a->count + i] = std::move(b->values[i]);
+      }
+      a->count += b->count;
+      a->next = b->next;
+      delete b;
+      remove_inner_entry(parent, left);
+      return;
+    }
+    if (childIsLeft) {    // 把 b 的第一个移到 a 的末尾
+      a->prefixes[a->count] = b->prefixes[0];
+      a->keys[a->count] = std::move(b->keys[0]);
+      a->values[a->count] = std::move(b->values[0]);
+      a->count++;
+      for (int i = 0; i + 1 < b->count; i++) {
+        b->prefixes[i] = b->prefixes[i + 1];
+        b->keys[i] = std::move(b->keys[i + 1]);
+        b->values[i] = std::move(b->values[i + 1]);
+      }
+      b->count--;
+      b->keys[b->count] = K();
+      b->values[b->count] = V();
+    } else {    // 把 a 的最后一个移到 b 的开头
+      for (int i = b->count; i > 0; i--) {
+        b->prefixes[i] = b->prefixes[i - 1];
+        b->keys[i] = std::move(b->keys[i - 1]);
+        b->values[i] = std::move(b->values[i - 1]);
+      }
+      a->count--;
+      b->prefixes[0] = a->prefixes[a->count];
+      b->keys[0] = std::move(a->keys[a->count]);
+      b->values[0] = std::move(a->values[a->count]);
+      a->keys[a->count] = K();
+      a->values[a->count] = V();
+      b->count++;
+    }
+    parent->prefixes[left] = b->prefixes[0];
+    parent->keys[left] = b->keys[0];
+    return;
+  }
+
+  auto *a = static_cast<InnerNode *>(parent->children[left]);
+  auto *b = static_cast<InnerNode *>(parent->children[left + 1]);
+  if (a->count + b->count + 1 <= kInnerSlots) {   // 分隔键下移，b 的键和孩子接到 a 后面
+    a->prefixes[a->count] = parent->prefixes[left];
+    a->keys[a->count] = std::move(parent->keys[left]);
+    for (int i = 0; i < b->count; i++) {
+      a->prefixes[a->count + 1 + i] = b->prefixes[i];
+      a->keys[a->count + 1 + i] = std::move(b->keys[i]);
+    }
+    for (int i = 0; i <= b->count; i++) {
+      a->children[a->count + 1 + i] = b->children[i];
+    }
+    a->count += b->count + 1;
+    delete b;
+    remove_inner_entry(parent, left);
+    return;
+  }
+  if (childIsLeft) {    // 分隔键下移到 a 的末尾，b 的第一个键上移，b 的第一个孩子归 a
+    a->prefixes[a->count] = parent->prefixes[left];
+    a->keys[a->count] = std::move(parent->keys[left]);
+    a->children[a->count + 1] = b->children[0];
+    a->count++;
+    parent->prefixes[left] = b->prefixes[0];
+    parent->keys[left] = std::move(b->keys[0]);
+    for (int i = 0; i + 1 < b->count; i++) {
+      b->prefixes[i] = b->prefixes[i + 1];
+      b->keys[i] = std::move(b->keys[i + 1]);
+    }
+    for (int i = 0; i < b->count; i++) {
+      b->children[i] = b->children[i + 1];
+    }
+    b->count--;
+    b->keys[b->count] = K();
+  } else {    // 分隔键下移到 b 的开头，a 的最后一个键上移，a 的最后一个孩子归 b
+    for (int i = b->count; i > 0; i--) {
+      b->prefixes[i] = b->prefixes[i - 1];
+      b->keys[i] = std::move(b->keys[i - 1]);
+    }
+    for (int i = b->count + 1; i > 0; i--) {
+      b->children[i] = b->children[i - 1];
+    }
+    b->prefixes[0] = parent->prefixes[left];
+    b->keys[0] = std::move(parent->keys[left]);
+    b->children[0] = a->children[a->count];
+    b->count++;
+    a->count--;
+    parent->prefixes[left] = a->prefixes[a->count];
+    parent->keys[left] = std::move(a->keys[a->count]);
+    a->keys[a->count] = K();
+  }
+}
+
+/*
+insert_set_elements 函数
+主要功能：批量插入或设置元素（重复的键以后出现的为准）。树为空时排序后直接自底向上建树，否则按键的顺序逐个插入
+*/
+template <typename K, typename V>
+template <typename U>
+void BPlusTree<K, V>::insert_set_elements(const std::vector<K> &keys, const std::vector<U> &values) {
+  insert_set_elements_impl(keys, values);
+}
+
+template <typename K, typename V>
+template <typename U>
+void BPlusTree<K, V>::insert_set_elements(std::vector<K> &&keys, std::vector<U> &&values) {
+  insert_set_elements_impl(std::move(keys), std::move(values));
+}
+
+template <typename K, typename V>
+template <typename Keys, typename Values>
+void BPlusTree<K, V>::insert_set_elements_impl(Keys &&keys, Values &&values) {
+  std::vector<size_t> order(keys.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [&keys](size_t a, size_t b) { return keys[a] < keys[b]; });
+
+  std::vector<K> sortedKeys;
+  std::vector<V> sortedValues;
+  sortedKeys.reserve(order.size());
+  sortedValues.reserve(order.size());
+  for (size_t n = 0; n < order.size(); n++) {
+    if (n + 1 < order.size() && keys[order[n + 1]] == keys[order[n]]) {
+      continue;
+    }
+    if constexpr (std::is_lvalue_reference_v<Values>) {
+      sortedKeys.push_back(keys[order[n]]);
+      sortedValues.emplace_back(values[order[n]]);
+    } else {
+      sortedKeys.push_back(std::move(keys[order[n]]));
+      sortedValues.emplace_back(std::move(values[order[n]]));
+    }
+  }
+
+  std::lock_guard<std::mutex> lg(_mtx);
+  if (_element_count == 0) {
+    build_from_sorted(sortedKeys, sortedValues);
+    return;
+  }
+  for (size_t n = 0; n < sortedKeys.size(); n++) {
+    auto [slot, inserted] = emplace_locked(std::move(sortedKeys[n]), std::move(sortedValues[n]));
+    if (!inserted) {
+      *slot = std::move(sortedValues[n]);
+    }
+  }
+}
+
+/*
+build_from_sorted 函数
+主要功能：用有序且不重复的键值对建树。每层的节点数按 3/4 的填充率算出，再把元素平均分给各个节点，每个节点都不少于最少键数
+注意：调用者需持有 _mtx，且树为空
+*/
+template <typename K, typename V>
+void BPlusTree<K, V>::build_from_sorted(std::vector<K> &keys, std::vector<V> &values) {
+  size_t n = keys.size();
+  if (n == 0) {
+    return;
+  }
+  destroy(_root);
+
+  // 1. 叶子层
+  const size_t leafFill = kLeafSlots * 3 / 4;
+  size_t leafCount = (n + leafFill - 1) / leafFill;
+  std::vector<NodeBase *> level;
+  std::vector<size_t> firstKey;   // 每个节点子树中最小的键在 keys 中的下标
+  LeafNode *prev = nullptr;
+  for (size_t l = 0, begin = 0; l < leafCount; l++) {
+    size_t end = begin + n / leafCount + (l < n % leafCount ? 1 : 0);
+    auto *leaf = new LeafNode();
+    for (size_t i = begin; i < end; i++) {
+      leaf->prefixes[i - begin] = KeyLayout::prefix(keys[i]);
+      leaf->keys[i - begin] = std::move(keys[i]);
+      leaf->values[i - begin] = std::move(values[i]);
+    }
+    leaf->count = static_cast<int>(end - begin);
+    if (prev != nullptr) {
+      prev->next = leaf;
+    }
+    prev = leaf;
+    level.push_back(leaf);
+    firstKey.push_back(begin);
+    begin = end;
+  }
+
+  // 2. 逐层向上，分隔键取右边孩子子树中最小的键（叶子中的键已经移走，从叶子里取）
+  auto minKeyOf = [](NodeBase *node) -> const K & {
+    while (!node->leaf) {
+      node = static_cast<InnerNode *>(node)->children[0];
+    }
+    return static_cast<LeafNode *>(node)->keys[0];
+  };
+  const size_t innerFill = (kInnerSlots + 1) * 3 / 4;   // 每个内部节点的孩子数
+  while (level.size() > 1) {
+    size_t count = (level.size() + innerFill - 1) / innerFill;
+    std::vector<NodeBase *> upper;
+    for (size_t c = 0, begin = 0; c < count; c++) {
+      size_t end = begin + level.size() / count + (c < level.size() % count ? 1 : 0);
+      auto *inner = new InnerNode();
+      inner->children[0] = level[begin];
+      for (size_t i = begin + 1; i < end; i++) {
+        const K &separator = minKeyOf(level[i]);
+        inner->prefixes[i - begin - 1] = KeyLayout::prefix(separator);
+        inner->keys[i - begin - 1] = separator;
+        inner->children[i - begin] = level[i];
+      }
+      inner->count = static_cast<int>(end - begin - 1);
+      upper.push_back(inner);
+      begin = end;
+    }
+    level.swap(upper);
+  }
+  _root = level[0];
+  _element_count = n;
+}
+
+/*
+scan_elements 函数
+主要功能：下降到 start 所在的叶子，之后沿叶子链表顺序取出
+*/
+template <typename K, typename V>
+template <typename U>
+bool BPlusTree<K, V>::scan_elements(const K &start, const K &end, bool hasEnd, size_t limit, std::vector<K> *keys,
+                                    std::vector<U> *values, K *next) {
+  keys->clear();
+  values->clear();
+  uint64_t startPrefix = KeyLayout::prefix(start);
+  uint64_t endPrefix = KeyLayout::prefix(end);
+  LeafNode *leaf = find_leaf(start, startPrefix, nullptr, nullptr);
+  int pos = lower_bound(leaf, start, startPrefix);
+  while (leaf != nullptr) {
+    for (; pos < leaf->count; pos++) {
+      if (hasEnd && !slot_less(leaf, pos, end, endPrefix)) {
+        return false;
+      }
+      if (keys->size() >= limit) {    // 本页已满，范围内还有元素
+        *next = leaf->keys[pos];
+        return true;
+      }
+      keys->push_back(leaf->keys[pos]);
+      values->push_back(leaf->values[pos]);
+    }
+    leaf = leaf->next;
+    pos = 0;
+  }
+  return false;
+}
+
+template <typename K, typename V>
+void BPlusTree<K, V>::dump_to(SkipListDump<K, V> *dumper) {
+  for (LeafNode *leaf = leftmost_leaf(); leaf != nullptr; leaf = leaf->next) {
+    for (int i = 0; i < leaf->count; i++) {
+      dumper->keyDumpVt_.emplace_back(leaf->keys[i]);
+      dumper->valDumpVt_.emplace_back(leaf->values[i]);
+    }
+  }
+}
+
+template <typename K, typename V>
+void BPlusTree<K, V>::display_list() {
+  std::cout << "\n*****B+ Tree*****" << "\n";
+  int n = 0;
+  for (LeafNode *leaf = leftmost_leaf(); leaf != nullptr; leaf = leaf->next) {
+    std::cout << "Leaf " << n++ << ": ";
+    for (int i = 0; i < leaf->count; i++) {
+      std::cout << leaf->keys[i] << ":" << leaf->values[i] << ";";
+    }
+    std::cout << std::endl;
+  }
+}
+
+template <typename K, typename V>
+int BPlusTree<K, V>::size() {
+  return static_cast<int>(_element_count);
+}
+
+#endif
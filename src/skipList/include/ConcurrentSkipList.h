@@ -0,0 +1,578 @@
+//
+// 无锁并发跳表：各层指针用CAS链接，查找不加锁，被删除的节点由 EpochReclaimer 延迟释放
+//
+
+#ifndef SKIP_LIST_ON_RAFT_CONCURRENTSKIPLIST_H
+#define SKIP_LIST_ON_RAFT_CONCURRENTSKIPLIST_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <new>
+#include "EpochReclaimer.h"
+#include "skipList.h"
+
+/*
+ConcurrentNode 类模板
+主要功能：无锁跳表的节点，一次分配，forward 指针数组紧跟在节点后面
+设计：
+    1. forward[i] 的最低位是删除标记：标记之后这一层的后继不能再修改，节点在这一层等待被摘除（Harris 链表）
+    2. 值通过原子指针保存，修改值时换上新的对象，旧对象交给 EpochReclaimer，正在读旧值的线程不受影响
+    3. state 协调插入和删除：插入线程链接高层期间持有 kLinking，删除线程摘除节点后设置 kRetireRequested，
+       两者中后完成的一方负责最后一次摘除并回收节点，节点不会在还能被找到时进入回收队列
+*/
+template <typename K, typename V>
+class ConcurrentNode {
+public:
+  static constexpr uint32_t kLinking = 1;           // 插入线程还在链接高层
+  static constexpr uint32_t kRetireRequested = 2;   // 已被删除，等待回收
+
+  static ConcurrentNode *create(const K &k, V *v, int level) {
+    size_t size = sizeof(ConcurrentNode) + level * sizeof(std::atomic<uintptr_t>);
+    void *mem = ::operator new(size);
+    auto *node = new (mem) ConcurrentNode(k, v, level);
+    for (int i = 1; i <= level; i++) {
+      new (&node->forward[i]) std::atomic<uintptr_t>(0);
+    }
+    return node;
+  }
+
+  static void destroy(void *p) {
+    auto *node = static_cast<ConcurrentNode *>(p);
+    delete node->value.load(std::memory_order_relaxed);
+    node->~ConcurrentNode();
+    ::operator delete(p);
+  }
+
+  const K &get_key() const { return key; }
+
+private:
+  ConcurrentNode(const K &k, V *v, int level) : key(k), value(v), state(kLinking), node_level(level), forward{0} {}
+
+public:
+  K key;
+  std::atomic<V *> value;
+  std::atomic<uint32_t> state;
+  int node_level;   // 节点的级别，forward 有 node_level + 1 个元素
+  std::atomic<uintptr_t> forward[1];    // 指向不同级别的下一个节点的指针数组，实际长度为 node_level + 1
+};
+
+/*
+ConcurrentSkipList 跳表类模板
+主要功能：接口与 SkipList 相同的并发跳表，多个线程可以同时读写，不需要外部加锁
+设计：
+    1. 查找只读取原子指针、跳过带删除标记的节点，不写任何共享数据，读线程之间没有缓存行竞争，也不会被写线程阻塞
+    2. 插入先在第0层CAS链接（线性化点），再自下而上链接高层；删除先自上而下给各层打标记，第0层标记成功的线程赢得删除，
+       之后通过一次查找把节点从各层摘除；查找途中遇到带标记的节点会顺手摘除（helping）
+    3. 所有访问都在 EpochReclaimer::Guard 中进行，摘除的节点和被替换的值交给 EpochReclaimer，读者离开后才释放
+注意：
+    值的修改是写时复制的：insert_set_element 换上新值，append_element 拷贝旧值追加后再换上，
+    适合读多写少的场景；析构时不能有其他线程访问
+*/
+template <typename K, typename V>
+class ConcurrentSkipList {
+  using Node = ConcurrentNode<K, V>;
+
+public:
+  static constexpr int kMaxLevelLimit = 32;   // 层级的上限，查找时前驱和后继数组按这个长度在栈上分配
+
+  ConcurrentSkipList(int);    // 最大层数超过 kMaxLevelLimit 时按 kMaxLevelLimit 处理
+  ~ConcurrentSkipList();
+
+  int get_random_level();   // 获取一个随机层级，用于确定新节点的层数
+
+  int insert_element(K, V);   // 插入一个新的元素，键已存在时返回 1
+
+  void display_list();    // 显示跳表中的所有元素，主要用于调试
+
+  template <typename Out>
+  bool search_element(const K &key, Out &value);    // 无锁查找
+
+  bool delete_element(const K &key);    //  删除一个指定键的元素，返回键是否存在
+
+  void insert_set_element(K &, V &);    //  插入或设置元素
+
+  void insert_set_element(const K &, V &&);   // 插入或设置元素，值被移动进跳表
+
+  template <typename U>
+  void insert_set_elements(const std::vector<K> &keys, const std::vector<U> &values);   // 批量插入或设置元素
+
+  template <typename U>
+  void search_elements(const std::vector<K> &keys, std::vector<U> *values, std::vector<bool> *exists);   // 批量查找
+
+  template <typename S>
+  void append_element(const K &key, const S &suffix);   // 在键已有的值后面追加 suffix，键不存在时以 suffix 为值插入
+
+  // 范围查找，语义与 SkipList::scan_elements 相同；并发修改时结果是弱一致的：每个返回的元素在遍历到它时存在
+  template <typename U>
+  bool scan_elements(const K &start, const K &end, bool hasEnd, size_t limit, std::vector<K> *keys,
+                     std::vector<U> *values, K *next);
+
+  std::string dump_file();      // 将跳表数据导出为字符串，格式与 SkipList::dump_file 相同
+
+  void dump_to(SkipListDump<K, V> *dumper);   // 把所有元素按键的顺序追加到 dumper 中
+
+  void load_file(const std::string &dumpStr);   // 从字符串加载跳表数据
+
+  int size();     // 返回跳表中元素的数量
+
+private:
+  static bool is_marked(uintptr_t p) { return (p & 1) != 0; }
+  static Node *node_of(uintptr_t p) { return reinterpret_cast<Node *>(p & ~static_cast<uintptr_t>(1)); }
+  static uintptr_t raw_of(Node *node) { return reinterpret_cast<uintptr_t>(node); }
+  static void destroy_value(void *p) { delete static_cast<V *>(p); }
+
+  // 从第 top 层（不低于当前层数）开始查找，填写各层的前驱和后继，顺手摘除带删除标记的节点；返回键是否存在
+  bool find(const K &key, Node **preds, Node **succs, int top);
+  Node *locate(const K &key);   // 只读的查找，返回键所在的节点（没有删除标记），不存在时返回 nullptr
+  Node *insert_node(const K &key, V *value);    // 插入节点；键已存在时不插入，返回已有的节点，value 仍归调用者所有
+  void finish_linking(Node *node);   // 插入线程链接完成（或放弃）之后调用，必要时回收节点
+  void replace_value(Node *node, V *value);   // 换上新值，旧值延迟释放
+
+private:
+  int _max_level;   // 跳表的最大层数
+  std::atomic<int> _skip_list_level;    // 当前跳表的层数，只增不减
+  Node *_header;    // 头节点，拥有全部 _max_level + 1 层
+  std::atomic<int> _element_count;    // 跳表当前的元素数量
+};
+
+/*
+构造函数
+主要功能：初始化跳表
+*/
+template <typename K, typename V>
+ConcurrentSkipList<K, V>::ConcurrentSkipList(int max_level)
+    : _max_level(std::clamp(max_level, 1, kMaxLevelLimit)), _skip_list_level(0), _element_count(0) {
+  _header = Node::create(K(), nullptr, _max_level);
+  _header->state.store(0, std::memory_order_relaxed);
+}
+
+/*
+析构函数
+主要功能：释放所有节点；已经摘除、等待回收的节点由 EpochReclaimer 负责
+*/
+template <typename K, typename V>
+ConcurrentSkipList<K, V>::~ConcurrentSkipList() {
+  Node *node = node_of(_header->forward[0].load(std::memory_order_acquire));
+  while (node != nullptr) {
+    Node *next = node_of(node->forward[0].load(std::memory_order_relaxed));
+    Node::destroy(node);
+    node = next;
+  }
+  Node::destroy(_header);
+}
+
+/*
+get_random_level 函数
+主要功能：插入节点时随机获取节点的层级，每个线程有自己的随机数状态，不共享 rand() 的全局状态
+*/
+template <typename K, typename V>
+int ConcurrentSkipList<K, V>::get_random_level() {
+  thread_local uint64_t state = 0x9e3779b97f4a7c15ULL ^ reinterpret_cast<uintptr_t>(&state);
+  int k = 1;
+  while (k < _max_level) {
+    state ^= state << 13;   // xorshift64
+    state ^= state >> 7;
+    state ^= state << 17;
+    if ((state & 1) == 0) {
+      break;
+    }
+    k++;
+  }
+  return k;
+}
+
+/*
+find 函数
+主要功能：从高层向低层查找 key 的插入位置，preds[i] 是第 i 层最后一个小于 key 的节点，succs[i] 是它的后继
+注意：
+    途中遇到带删除标记的节点（它的 forward[i] 被标记）就把它从这一层摘除；摘除的CAS失败说明前驱变了
+    （前驱本身被删除，或者插入了新节点），从头重新查找
+*/
+template <typename K, typename V>
+bool ConcurrentSkipList<K, V>::find(const K &key, Node **preds, Node **succs, int top) {
+retry:
+  Node *pred = _header;
+  for (int i = std::max(top, _skip_list_level.load(std::memory_order_acquire)); i >= 0; i--) {
+    Node *curr = node_of(pred->forward[i].load(std::memory_order_acquire));
+    while (curr != nullptr) {
+      uintptr_t succ = curr->forward[i].load(std::memory_order_acquire);
+      if (is_marked(succ)) {    // curr 已被删除，从这一层摘除
+        uintptr_t expected = raw_of(curr);
+        if (!pred->forward[i].compare_exchange_strong(expected, succ & ~static_cast<uintptr_t>(1),
+                                                      std::memory_order_acq_rel, std::memory_order_acquire)) {
+          goto retry;
+        }
+        curr = node_of(succ);
+        continue;
+      }
+      if (!(curr->get_key() < key)) {
+        break;
+      }
+      pred = curr;
+      curr = node_of(succ);
+    }
+    preds[i] = pred;
+    succs[i] = curr;
+  }
+  return succs[0] != nullptr && succs[0]->get_key() == key;
+}
+
+/*
+locate 函数
+主要功能：只读的查找，跳过带删除标记的节点但不摘除，不写任何共享数据
+*/
+template <typename K, typename V>
+typename ConcurrentSkipList<K, V>::Node *ConcurrentSkipList<K, V>::locate(const K &key) {
+  Node *pred = _header;
+  Node *curr = nullptr;
+  for (int i = _skip_list_level.load(std::memory_order_acquire); i >= 0; i--) {
+    curr = node_of(pred->forward[i].load(std::memory_order_acquire));
+    while (curr != nullptr) {
+      uintptr_t succ = curr->forward[i].load(std::memory_order_acquire);
+      if (is_marked(succ)) {    // 已被删除，跳过
+        curr = node_of(succ);
+        continue;
+      }
+      if (!(curr->get_key() < key)) {
+        break;
+      }
+      pred = curr;
+      curr = node_of(succ);
+    }
+  }
+  if (curr != nullptr && curr->get_key() == key && !is_marked(curr->forward[0].load(std::memory_order_acquire))) {
+    return curr;
+  }
+  return nullptr;
+}
+
+/*
+insert_node 函数
+主要功能：插入一个新节点
+    1. 在第0层CAS链接，成功即插入完成（其他线程从此能找到它），失败说明位置变了，重新查找
+    2. 自下而上链接高层：先把节点在这一层的后继改成最新的 succs[i]（节点已被打删除标记时放弃），再CAS前驱
+*/
+template <typename K, typename V>
+typename ConcurrentSkipList<K, V>::Node *ConcurrentSkipList<K, V>::insert_node(const K &key, V *value) {
+  int top = get_random_level();
+  int level = _skip_list_level.load(std::memory_order_acquire);
+  while (top > level && !_skip_list_level.compare_exchange_weak(level, top, std::memory_order_acq_rel)) {
+  }
+
+  Node *preds[kMaxLevelLimit + 1];
+  Node *succs[kMaxLevelLimit + 1];
+  Node *node = nullptr;
+  while (true) {
+    if (find(key, preds, succs, top)) {
+      if (node != nullptr) {    // 节点还没有发布，直接释放，值还给调用者
+        node->value.store(nullptr, std::memory_order_relaxed);
+        Node::destroy(node);
+      }
+      return succs[0];
+    }
+    if (node == nullptr) {
+      node = Node::create(key, value, top);
+    }
+    for (int i = 0; i <= top; i++) {
+      node->forward[i].store(raw_of(succs[i]), std::memory_order_relaxed);
+    }
+    uintptr_t expected = raw_of(succs[0]);
+    if (preds[0]->forward[0].compare_exchange_strong(expected, raw_of(node), std::memory_order_acq_rel,
+                                                     std::memory_order_acquire)) {
+      break;
+    }
+  }
+  _element_count.fetch_add(1, std::memory_order_relaxed);
+
+  for (int i = 1; i <= top; i++) {
+    while (true) {
+      uintptr_t next = node->forward[i].load(std::memory_order_acquire);
+      if (is_marked(next)) {    // 节点已经在被删除，不再链接更高的层
+        finish_linking(node);
+        return nullptr;
+      }
+      if (node_of(next) != succs[i] &&
+          !node->forward[i].compare_exchange_strong(next, raw_of(succs[i]), std::memory_order_acq_rel)) {
+        continue;   // 后继被打了删除标记，下一轮会看到
+      }
+      uintptr_t expected = raw_of(succs[i]);
+      if (preds[i]->forward[i].compare_exchange_strong(expected, raw_of(node), std::memory_order_acq_rel,
+                                                       std::memory_order_acquire)) {
+        break;
+      }
+      if (!find(key, preds, succs, top) || succs[0] != node) {    // 节点已经被删除
+        finish_linking(node);
+        return nullptr;
+      }
+    }
+  }
+  finish_linking(node);
+  return nullptr;
+}
+
+/*
+finish_linking 函数
+主要功能：插入线程不再链接节点之后清除 kLinking。如果期间节点已被删除，删除线程把回收交给了这里：
+        再查找一次，把可能在删除之后才链接上的高层摘除，然后回收
+*/
+template <typename K, typename V>
+void ConcurrentSkipList<K, V>::finish_linking(Node *node) {
+  uint32_t prev = node->state.fetch_and(~Node::kLinking, std::memory_order_acq_rel);
+  if (prev & Node::kRetireRequested) {
+    Node *preds[kMaxLevelLimit + 1];
+    Node *succs[kMaxLevelLimit + 1];
+    find(node->get_key(), preds, succs, node->node_level);
+    EpochReclaimer::Instance().Retire(node, &Node::destroy);
+  }
+}
+
+template <typename K, typename V>
+void ConcurrentSkipList<K, V>::replace_value(Node *node, V *value) {
+  V *old = node->value.exchange(value, std::memory_order_acq_rel);
+  EpochReclaimer::Instance().Retire(old, &ConcurrentSkipList::destroy_value);
+}
+
+/*
+insert_element 函数
+主要功能：插入一个新的元素，键已存在时不修改，返回 1
+*/
+template <typename K, typename V>
+int ConcurrentSkipList<K, V>::insert_element(K key, V value) {
+  EpochReclaimer::Guard guard;
+  V *v = new V(std::move(value));
+  if (insert_node(key, v) != nullptr) {
+    delete v;
+    return 1;
+  }
+  return 0;
+}
+
+template <typename K, typename V>
+void ConcurrentSkipList<K, V>::insert_set_element(K &key, V &value) {
+  insert_set_element(key, V(value));
+}
+
+/*
+insert_set_element 函数（右值版本）
+主要功能：插入或设置元素。键已存在时换上新值（写时复制），不删除节点，读者总能看到完整的旧值或新值
+*/
+template <typename K, typename V>
+void ConcurrentSkipList<K, V>::insert_set_element(const K &key, V &&value) {
+  EpochReclaimer::Guard guard;
+  V *v = new V(std::move(value));
+  if (Node *existing = insert_node(key, v)) {
+    replace_value(existing, v);
+  }
+}
+
+template <typename K, typename V>
+template <typename U>
+void ConcurrentSkipList<K, V>::insert_set_elements(const std::vector<K> &keys, const std::vector<U> &values) {
+  for (size_t i = 0; i < keys.size() && i < values.size(); i++) {
+    insert_set_element(keys[i], V(values[i]));
+  }
+}
+
+/*
+append_element 函数
+主要功能：追加写。拷贝当前值追加 suffix 后CAS换上，期间值被其他线程修改则重试；键不存在时以 suffix 为值插入
+*/
+template <typename K, typename V>
+template <typename S>
+void ConcurrentSkipList<K, V>::append_element(const K &key, const S &suffix) {
+  EpochReclaimer::Guard guard;
+  while (true) {
+    Node *node = locate(key);
+    if (node == nullptr) {
+      V *v = new V(suffix);
+      node = insert_node(key, v);
+      if (node == nullptr) {
+        return;
+      }
+      delete v;   // 并发插入了同一个键，追加到它上面
+    }
+    V *old = node->value.load(std::memory_order_acquire);
+    V *v = new V(*old);
+    v->append(suffix);
+    if (node->value.compare_exchange_strong(old, v, std::memory_order_acq_rel)) {
+      EpochReclaimer::Instance().Retire(old, &ConcurrentSkipList::destroy_value);
+      return;
+    }
+    delete v;
+  }
+}
+
+/*
+delete_element 函数
+主要功能：删除一个指定键的元素
+    1. 自上而下给节点各层的 forward 打删除标记，第0层标记成功的线程赢得删除（线性化点）
+    2. 再查找一次，把节点从各层摘除
+    3. 插入线程还在链接高层时，把回收交给它（见 finish_linking），否则直接回收
+*/
+template <typename K, typename V>
+bool ConcurrentSkipList<K, V>::delete_element(const K &key) {
+  EpochReclaimer::Guard guard;
+  Node *preds[kMaxLevelLimit + 1];
+  Node *succs[kMaxLevelLimit + 1];
+  if (!find(key, preds, succs, 0)) {
+    return false;
+  }
+  Node *node = succs[0];
+  for (int i = node->node_level; i >= 1; i--) {
+    uintptr_t next = node->forward[i].load(std::memory_order_acquire);
+    while (!is_marked(next) && !node->forward[i].compare_exchange_weak(next, next | 1, std::memory_order_acq_rel)) {
+    }
+  }
+  uintptr_t next = node->forward[0].load(std::memory_order_acquire);
+  while (true) {
+    if (is_marked(next)) {    // 其他线程已经删除了它
+      return false;
+    }
+    if (node->forward[0].compare_exchange_weak(next, next | 1, std::memory_order_acq_rel)) {
+      break;
+    }
+  }
+  _element_count.fetch_sub(1, std::memory_order_relaxed);
+
+  find(key, preds, succs, node->node_level);
+  if (!(node->state.fetch_or(Node::kRetireRequested, std::memory_order_acq_rel) & Node::kLinking)) {
+    EpochReclaimer::Instance().Retire(node, &Node::destroy);
+  }
+  return true;
+}
+
+/*
+search_element 函数
+主要功能：无锁查找，找到时把值赋给 value
+*/
+template <typename K, typename V>
+template <typename Out>
+bool ConcurrentSkipList<K, V>::search_element(const K &key, Out &value) {
+  EpochReclaimer::Guard guard;
+  Node *node = locate(key);
+  if (node == nullptr) {
+    return false;
+  }
+  value = *node->value.load(std::memory_order_acquire);
+  return true;
+}
+
+template <typename K, typename V>
+template <typename U>
+void ConcurrentSkipList<K, V>::search_elements(const std::vector<K> &keys, std::vector<U> *values,
+                                               std::vector<bool> *exists) {
+  values->assign(keys.size(), U());
+  exists->assign(keys.size(), false);
+  for (size_t n = 0; n < keys.size(); n++) {
+    (*exists)[n] = search_element(keys[n], (*values)[n]);
+  }
+}
+
+/*
+scan_elements 函数
+主要功能：范围查找，定位到第一个不小于 start 的节点后沿第0层遍历，跳过带删除标记的节点
+*/
+template <typename K, typename V>
+template <typename U>
+bool ConcurrentSkipList<K, V>::scan_elements(const K &start, const K &end, bool hasEnd, size_t limit,
+                                             std::vector<K> *keys, std::vector<U> *values, K *next) {
+  keys->clear();
+  values->clear();
+  EpochReclaimer::Guard guard;
+
+  Node *pred = _header;
+  for (int i = _skip_list_level.load(std::memory_order_acquire); i >= 0; i--) {
+    Node *curr = node_of(pred->forward[i].load(std::memory_order_acquire));
+    while (curr != nullptr && curr->get_key() < start) {
+      pred = curr;
+      curr = node_of(curr->forward[i].load(std::memory_order_acquire));
+    }
+  }
+
+  Node *current = node_of(pred->forward[0].load(std::memory_order_acquire));
+  while (current != nullptr && (!hasEnd || current->get_key() < end)) {
+    uintptr_t succ = current->forward[0].load(std::memory_order_acquire);
+    if (!is_marked(succ) && !(current->get_key() < start)) {
+      if (keys->size() >= limit) {    // 本页已满，范围内还有元素
+        *next = current->get_key();
+        return true;
+      }
+      keys->push_back(current->get_key());
+      values->push_back(*current->value.load(std::memory_order_acquire));
+    }
+    current = node_of(succ);
+  }
+  return false;
+}
+
+/*
+display_list 函数
+主要功能：显示跳表中的所有元素
+*/
+template <typename K, typename V>
+void ConcurrentSkipList<K, V>::display_list() {
+  EpochReclaimer::Guard guard;
+  std::cout << "\n*****Concurrent Skip List*****" << "\n";
+  for (int i = 0; i <= _skip_list_level.load(std::memory_order_acquire); i++) {
+    Node *node = node_of(_header->forward[i].load(std::memory_order_acquire));
+    std::cout << "Level " << i << ": ";
+    while (node != nullptr) {
+      uintptr_t succ = node->forward[i].load(std::memory_order_acquire);
+      if (!is_marked(succ)) {
+        std::cout << node->get_key() << ":" << *node->value.load(std::memory_order_acquire) << ";";
+      }
+      node = node_of(succ);
+    }
+    std::cout << std::endl;
+  }
+}
+
+template <typename K, typename V>
+std::string ConcurrentSkipList<K, V>::dump_file() {
+  SkipListDump<K, V> dumper;
+  dump_to(&dumper);
+  std::stringstream ss;
+  boost::archive::text_oarchive oa(ss);
+  oa << dumper;
+  return ss.str();
+}
+
+/*
+dump_to 函数
+主要功能：沿第0层遍历所有没有删除标记的节点，把键值对加入 dumper
+*/
+template <typename K, typename V>
+void ConcurrentSkipList<K, V>::dump_to(SkipListDump<K, V> *dumper) {
+  EpochReclaimer::Guard guard;
+  Node *node = node_of(_header->forward[0].load(std::memory_order_acquire));
+  while (node != nullptr) {
+    uintptr_t succ = node->forward[0].load(std::memory_order_acquire);
+    if (!is_marked(succ)) {
+      dumper->keyDumpVt_.emplace_back(node->get_key());
+      dumper->valDumpVt_.emplace_back(*node->value.load(std::memory_order_acquire));
+    }
+    node = node_of(succ);
+  }
+}
+
+template <typename K, typename V>
+void ConcurrentSkipList<K, V>::load_file(const std::string &dumpStr) {
+  if (dumpStr.empty()) {
+    return;
+  }
+  SkipListDump<K, V> dumper;
+  std::stringstream iss(dumpStr);
+  boost::archive::text_iarchive ia(iss);
+  ia >> dumper;
+  for (size_t i = 0; i < dumper.keyDumpVt_.size(); ++i) {
+    insert_set_element(dumper.keyDumpVt_[i], V(std::move(dumper.valDumpVt_[i])));
+  }
+}
+
+template <typename K, typename V>
+int ConcurrentSkipList<K, V>::size() {
+  return _element_count.load(std::memory_order_relaxed);
+}
+
+#endif
@@ -0,0 +1,163 @@
+//
+// 基于纪元的内存回收（Epoch-Based Reclamation），供无锁数据结构延迟释放被摘除的节点
+//
+
+#ifndef SKIP_LIST_ON_RAFT_EPOCHRECLAIMER_H
+#define SKIP_LIST_ON_RAFT_EPOCHRECLAIMER_H
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+
+/*
+EpochReclaimer 类
+主要功能：无锁的读者不加锁地访问节点，写者摘除节点后不能立即释放，交给这里延迟到所有可能看到它的读者都离开之后再释放
+设计：
+    1. 全局纪元 m_globalEpoch 单调递增。线程访问数据结构前用 Guard 进入临界区，把自己的纪元记为当前的全局纪元，离开时清除
+    2. 摘除的节点连同摘除时的全局纪元放进本线程的待释放队列。只有所有处在临界区的线程都已经看到当前纪元时，全局纪元才能加一，
+       因此纪元为 e 时摘除的节点，在全局纪元到达 e + 2 之后不会再被任何线程持有，可以释放
+    3. 每个线程有一个缓存行对齐的记录，挂在一个只增不减的链表上；线程退出时记录标记为空闲，新线程优先复用，
+       留在记录里还没释放的节点由复用它的线程继续释放
+注意：进程内只有一个实例，所有无锁跳表共用；释放函数不能依赖数据结构对象本身，数据结构析构后待释放的节点仍然会被正确释放
+*/
+class EpochReclaimer {
+private:
+  static constexpr uint64_t kIdle = UINT64_MAX;   // 不在临界区
+  static constexpr int kCollectInterval = 64;     // 每摘除这么多个节点尝试推进一次纪元
+
+  struct Retired {
+    void *ptr;
+    void (*deleter)(void *);
+    uint64_t epoch;
+  };
+
+  struct alignas(64) ThreadRecord {
+    std::atomic<uint64_t> epoch{kIdle};   // 所在临界区的纪元，kIdle 表示不在临界区
+    std::atomic<bool> inUse{false};       // 是否有线程持有这个记录
+    int nesting = 0;                      // Guard 嵌套层数，只有持有者访问
+    uint64_t retireCount = 0;
+    std::deque<Retired> retired;          // 待释放的节点，按纪元递增排列
+    ThreadRecord *next = nullptr;
+  };
+
+public:
+  static EpochReclaimer &Instance() {
+    static EpochReclaimer instance;
+    return instance;
+  }
+
+  /*
+  Guard 类
+  主要功能：RAII，构造时进入临界区，析构时离开；可以嵌套，只有最外层真正进入和离开
+  */
+  class Guard {
+  public:
+    Guard() : m_record(Instance().enter()) {}
+    ~Guard() { Instance().leave(m_record); }
+    Guard(const Guard &) = delete;
+    Guard &operator=(const Guard &) = delete;
+
+  private:
+    ThreadRecord *m_record;
+  };
+
+  // 延迟释放 p，调用者必须已经让 p 对新进入临界区的线程不可达
+  void Retire(void *p, void (*deleter)(void *)) {
+    ThreadRecord *record = localRecord();
+    record->retired.push_back({p, deleter, m_globalEpoch.load(std::memory_order_acquire)});
+    if (++record->retireCount % kCollectInterval == 0) {
+      tryAdvance();
+      collect(record);
+    }
+  }
+
+private:
+  EpochReclaimer() = default;
+
+  // 线程退出时归还记录
+  struct LocalHolder {
+    ThreadRecord *record = nullptr;
+    ~LocalHolder() {
+      if (record != nullptr) {
+        record->inUse.store(false, std::memory_order_release);
+      }
+    }
+  };
+
+  ThreadRecord *localRecord() {
+    thread_local LocalHolder holder;
+    if (holder.record == nullptr) {
+      holder.record = acquireRecord();
+    }
+    return holder.record;
+  }
+
+  ThreadRecord *acquireRecord() {
+    for (ThreadRecord *record = m_records.load(std::memory_order_acquire); record != nullptr; record = record->next) {
+      bool expected = false;
+      if (!record->inUse.load(std::memory_order_relaxed) &&
+          record->inUse.compare_exchange_strong(expected, true, std::memory_order_acq_rel)) {
+        return record;
+      }
+    }
+    auto *record = new ThreadRecord();
+    record->inUse.store(true, std::memory_order_relaxed);
+    ThreadRecord *head = m_records.load(std::memory_order_acquire);
+    do {
+      record->next = head;
+    } while (!m_records.compare_exchange_weak(head, record, std::memory_order_acq_rel, std::memory_order_acquire));
+    return record;
+  }
+
+  ThreadRecord *enter() {
+    ThreadRecord *record = localRecord();
+    if (record->nesting++ == 0) {
+      // seq_cst：记录纪元和之后读取数据结构的顺序不能颠倒，否则推进纪元的线程可能看不到这个读者
+      // 记录之后全局纪元如果已经变了，说明推进纪元的线程可能没看到这次记录，重新记录
+      uint64_t epoch = m_globalEpoch.load(std::memory_order_seq_cst);
+      while (true) {
+        record->epoch.store(epoch, std::memory_order_seq_cst);
+        uint64_t now = m_globalEpoch.load(std::memory_order_seq_cst);
+        if (now == epoch) {
+          break;
+        }
+        epoch = now;
+      }
+    }
+    return record;
+  }
+
+  void leave(ThreadRecord *record) {
+    if (--record->nesting == 0) {
+      record->epoch.store(kIdle, std::memory_order_release);
+    }
+  }
+
+  // 所有在临界区中的线程都已经看到当前纪元时，全局纪元加一
+  void tryAdvance() {
+    uint64_t epoch = m_globalEpoch.load(std::memory_order_seq_cst);
+    for (ThreadRecord *record = m_records.load(std::memory_order_acquire); record != nullptr; record = record->next) {
+      uint64_t local = record->epoch.load(std::memory_order_seq_cst);
+      if (local != kIdle && local != epoch) {
+        return;
+      }
+    }
+    m_globalEpoch.compare_exchange_strong(epoch, epoch + 1, std::memory_order_seq_cst);
+  }
+
+  // 释放本线程队列中已经安全的节点
+  void collect(ThreadRecord *record) {
+    uint64_t epoch = m_globalEpoch.load(std::memory_order_acquire);
+    while (!record->retired.empty() && record->retired.front().epoch + 2 <= epoch) {
+      Retired item = record->retired.front();
+      record->retired.pop_front();
+      item.deleter(item.ptr);
+    }
+  }
+
+private:
+  std::atomic<uint64_t> m_globalEpoch{0};
+  std::atomic<ThreadRecord *> m_records{nullptr};
+};
+
+#endif
@@ -0,0 +1,92 @@
+//
+// 跳表节点的内存池：从大块内存中切分节点，释放的节点按尺寸分级挂到空闲链表上复用
+//
+
+#ifndef SKIP_LIST_ON_RAFT_NODEARENA_H
+#define SKIP_LIST_ON_RAFT_NODEARENA_H
+
+#include <cstddef>
+#include <new>
+#include <vector>
+
+/*
+NodeArena 类
+主要功能：每个跳表一个，节点的内存都从这里分配
+设计：
+    1. 以 kBlockSize 为单位向系统申请大块内存，节点从块中按顺序切分，相邻插入的节点在内存中也相邻，且没有 malloc 的头部开销
+    2. 尺寸按 kAlignment 向上取整分级，释放的节点挂到对应级别的空闲链表上（链表指针就存放在被释放的内存中），
+       下次分配同一级别时优先复用
+    3. 超过 kMaxSmallSize 的节点（很长的键）直接向系统申请和释放，不进入内存池
+注意：不加锁，由跳表的锁保护；内存池析构时一次性归还所有块，调用者需要先析构块中的对象
+*/
+class NodeArena {
+public:
+  static constexpr size_t kAlignment = 16;
+  static constexpr size_t kMaxSmallSize = 1024;
+  static constexpr size_t kBlockSize = 64 * 1024;
+
+  NodeArena() : m_freeLists(kMaxSmallSize / kAlignment + 1, nullptr) {}
+
+  ~NodeArena() {
+    for (char *block : m_blocks) {
+      ::operator delete(block);
+    }
+  }
+
+  NodeArena(const NodeArena &) = delete;
+  NodeArena &operator=(const NodeArena &) = delete;
+
+  void *Allocate(size_t bytes) {
+    size_t rounded = roundUp(bytes);
+    if (rounded > kMaxSmallSize) {
+      m_largeBytes += rounded;
+      return ::operator new(rounded);
+    }
+    FreeChunk *&freeList = m_freeLists[rounded / kAlignment];
+    if (freeList != nullptr) {    // 优先复用同一级别释放的节点
+      FreeChunk *chunk = freeList;
+      freeList = chunk->next;
+      return chunk;
+    }
+    if (m_blockRemaining < rounded) {   // 当前块剩下的放不下，剩余部分放弃，申请新块
+      m_blockPtr = static_cast<char *>(::operator new(kBlockSize));
+      m_blockRemaining = kBlockSize;
+      m_blocks.push_back(m_blockPtr);
+    }
+    void *p = m_blockPtr;
+    m_blockPtr += rounded;
+    m_blockRemaining -= rounded;
+    return p;
+  }
+
+  // bytes 必须和分配时相同
+  void Deallocate(void *p, size_t bytes) {
+    size_t rounded = roundUp(bytes);
+    if (rounded > kMaxSmallSize) {
+      m_largeBytes -= rounded;
+      ::operator delete(p);
+      return;
+    }
+    FreeChunk *&freeList = m_freeLists[rounded / kAlignment];
+    freeList = new (p) FreeChunk{freeList};
+  }
+
+  // 向系统申请的总字节数（包括空闲链表上的和块末尾没用上的）
+  size_t MemoryUsage() const { return m_blocks.size() * kBlockSize + m_largeBytes; }
+
+private:
+  struct FreeChunk {
+    FreeChunk *next;
+  };
+
+  static size_t roundUp(size_t bytes) { return (bytes + kAlignment - 1) & ~(kAlignment - 1); }
+
+private:
+  std::vector<char *> m_blocks;   // 所有向系统申请的块，析构时归还
+  char *m_blockPtr = nullptr;     // 当前块中下一个可分配的位置
+  size_t m_blockRemaining = 0;
+  size_t m_largeBytes = 0;        // 直接向系统申请的大节点的字节数
+  std::vector<FreeChunk *> m_freeLists;   // 按尺寸分级的空闲链表，下标为 尺寸 / kAlignment
+};
+
+#endif
@@ -0,0 +1,92 @@
+//
+// 分段存储的值类型，让 Append 只拷贝追加的部分
+//
+
+#ifndef SKIP_LIST_ON_RAFT_SEGMENTEDVALUE_H
+#define SKIP_LIST_ON_RAFT_SEGMENTEDVALUE_H
+
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+/*
+SegmentedValue 类
+主要功能：跳表中保存的值。从来没有被追加过的值只有一个段 m_head，和 std::string 没有区别；
+        追加时把数据接到最后一段的末尾，最后一段放不下（超过 kChunkSize）时另起一段，
+        因此追加一条记录的代价只和记录的长度有关，不会因为整个值变长而拷贝整个值
+设计：
+    1. 段的合并是惰性的：小的追加先攒在最后一段里，攒满一个块之后才开新段，段数约为 总长度 / kChunkSize，
+       每段的重新分配最多拷贝 kChunkSize 字节
+    2. 读取时（Get、快照等）才把所有段拼成一个连续的字符串，不修改值本身，持有共享锁的多个读请求可以同时进行
+    3. 可以从 std::string 隐式构造，也可以隐式转换为 std::string，跳表和KV层的代码不需要关心值是否分段
+*/
+class SegmentedValue {
+public:
+  static constexpr size_t kChunkSize = 64 * 1024;   // 一段的目标大小
+
+  SegmentedValue() = default;
+  SegmentedValue(std::string value) : m_head(std::move(value)), m_size(m_head.size()) {}    // NOLINT: 允许隐式转换
+  SegmentedValue(const char *value) : SegmentedValue(std::string(value)) {}   // NOLINT
+
+  // 追加数据，只拷贝 suffix 本身
+  void append(std::string_view suffix) {
+    std::string &last = m_tail.empty() ? m_head : m_tail.back();
+    if (last.size() + suffix.size() <= kChunkSize) {
+      last.append(suffix.data(), suffix.size());
+    } else {
+      m_tail.emplace_back(suffix.data(), suffix.size());
+    }
+    m_size += suffix.size();
+  }
+
+  size_t size() const { return m_size; }
+  bool empty() const { return m_size == 0; }
+  size_t segments() const { return 1 + m_tail.size(); }
+
+  // 拼成一个连续的字符串，追加到 out 末尾
+  void appendTo(std::string *out) const {
+    out->reserve(out->size() + m_size);
+    out->append(m_head);
+    for (const auto &segment : m_tail) {
+      out->append(segment);
+    }
+  }
+
+  // 逐段与 other 比较，不需要先拼成连续的字符串
+  bool equals(std::string_view other) const {
+    if (other.size() != m_size) return false;
+    if (other.compare(0, m_head.size(), m_head) != 0) return false;
+    size_t offset = m_head.size();
+    for (const auto &segment : m_tail) {
+      if (other.compare(offset, segment.size(), segment) != 0) return false;
+      offset += segment.size();
+    }
+    return true;
+  }
+
+  std::string str() const {
+    if (m_tail.empty()) return m_head;
+    std::string out;
+    appendTo(&out);
+    return out;
+  }
+
+  operator std::string() const { return str(); }    // NOLINT: 读取时隐式展平
+
+  friend std::ostream &operator<<(std::ostream &os, const SegmentedValue &value) {
+    os << value.m_head;
+    for (const auto &segment : value.m_tail) {
+      os << segment;
+    }
+    return os;
+  }
+
+private:
+  std::string m_head;   // 第一段，没有追加过的值只用到它
+  std::vector<std::string> m_tail;    // 之后的各段，除最后一段外每段都接近 kChunkSize
+  size_t m_size = 0;    // 所有段的总长度
+};
+
+#endif
@@ -6,71 +6,235 @@
 #ifndef SKIPLIST_H
 #define SKIPLIST_H
 
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <new>
+#include <numeric>
 #include <string>
+#include <string_view>
+#include <utility>
 #include <fstream>
 #include <iostream>
+#include <vector>
+#include "NodeArena.h"
+#include "SegmentedValue.h"
 
 #define STORE_FILE "store/dumpFile"   // 宏定义，表示存储文件的路径
 
 static std::string delimiter = ":";   // 静态字符串，用于分隔键值对的分隔符
 
+/*
+SkipListKeyLayout 类模板
+主要功能：描述键在节点内存中的存放方式和比较方式。通用的键类型把 K 对象整个放进节点，直接用 < 和 == 比较；
+        std::string 的键只把字符内容放进节点，不再有单独的堆内存，get_key 返回指向节点内字符的 std::string_view，
+        并且在节点头部缓存8字节的前缀指纹，大部分比较只需要比较一次整数
+*/
+template <typename K>
+struct SkipListKeyLayout {
+  struct prefix_storage {};   // 没有前缀指纹，不占空间
+  using view_type = const K &;
+  static constexpr size_t alignment = alignof(K);
+  static constexpr bool has_prefix = false;
+
+  template <typename Key>
+  static uint64_t prefix(const Key &) { return 0; }
+
+  template <typename Key>
+  static bool less(view_type a, const Key &b) { return a < b; }
+
+  template <typename Key>
+  static bool equal(view_type a, const Key &b) { return a == b; }
+
+  template <typename Arg>
+  static size_t bytes(const Arg &) { return sizeof(K); }
+
+  template <typename Arg>
+  static void construct(char *p, Arg &&key) { new (p) K(std::forward<Arg>(key)); }
+
+  static view_type view(const char *p, size_t) { return *std::launder(reinterpret_cast<const K *>(p)); }
+
+  static void destroy(char *p) { std::launder(reinterpret_cast<K *>(p))->~K(); }
+};
+
+template <>
+struct SkipListKeyLayout<std::string> {
+  using prefix_storage = uint64_t;
+  using view_type = std::string_view;
+  static constexpr size_t alignment = 1;
+  static constexpr bool has_prefix = true;
+
+  // 前缀指纹：前8个字节按大端序拼成的整数，不足8字节的补0。两个键的指纹不同时，指纹的大小关系就是键的字典序
+  static uint64_t prefix(std::string_view key) {
+    uint64_t value = 0;
+    memcpy(&value, key.data(), std::min<size_t>(key.size(), 8));
+    if constexpr (std::endian::native == std::endian::little) {
+      value = __builtin_bswap64(value);
+    }
+    return value;
+  }
+
+  // 以下两个函数只在指纹相同时调用：两个键共同长度内的前（最多）8个字节已知相等，从后面开始比较
+  static bool less(std::string_view a, std::string_view b) {
+    size_t skip = std::min({a.size(), b.size(), size_t(8)});
+    return std::string_view(a.data() + skip, a.size() - skip) < std::string_view(b.data() + skip, b.size() - skip);
+  }
+
+  static bool equal(std::string_view a, std::string_view b) {
+    size_t skip = std::min({a.size(), b.size(), size_t(8)});
+    return a.size() == b.size() && memcmp(a.data() + skip, b.data() + skip, a.size() - skip) == 0;
+  }
+
+  static size_t bytes(std::string_view key) { return key.size(); }
+
+  static void construct(char *p, std::string_view key) { memcpy(p, key.data(), key.size()); }
+
+  static view_type view(const char *p, size_t size) { return std::string_view(p, size); }
+
+  static void destroy(char *) {}
+};
+
 /*
 Node 类模板
 主要功能：表示跳表中的节点，K 是键的类型，V 是值的类型。
+内存布局：一个节点只占一块连续的内存，从所属跳表的 NodeArena 中分配
+    | key_prefix | key_size | node_level | forward[0..node_level] | 键 | 值 |
+    指针数组不再单独 new，查找时比较的键紧跟在指针数组后面，访问一个节点通常只碰一到两个缓存行；
+    std::string 的键还在头部缓存了前缀指纹，和 forward 在同一个缓存行，指纹不同时不用读键
+注意：只能通过 Create 和 Destroy 创建和销毁
 */
 template <typename K, typename V>
 class Node {
+  using KeyLayout = SkipListKeyLayout<K>;
+
 public:
-  Node() {}
+  // 在 arena 中分配一个层级为 level 的节点，键和值的参数直接转发给 K 和 V 的构造函数（例如用 std::string_view 作为键）
+  template <typename KArg, typename... VArgs>
+  static Node *Create(NodeArena &arena, int level, KArg &&k, VArgs &&...v);
+
+  static void Destroy(NodeArena &arena, Node *node);
 
-  Node(K k, V v, int);
+  Node(const Node &) = delete;
+  Node &operator=(const Node &) = delete;
 
-  ~Node();
+  // 返回引用（std::string 的键返回 std::string_view），比较键的时候不再拷贝
+  typename KeyLayout::view_type get_key() const { return KeyLayout::view(key_ptr(), key_size); }
 
-  K get_key() const;
+  // 计算 key 的前缀指纹，查找前算一次，之后和每个节点比较时传入
+  template <typename Key>
+  static uint64_t prefix_of(const Key &key) { return KeyLayout::prefix(key); }
 
-  V get_value() const;
+  // 节点的键是否小于 key，prefix 为 prefix_of(key)；指纹不同时只比较一次整数，相同时才比较完整的键
+  template <typename Key>
+  bool key_less(const Key &key, uint64_t prefix) const {
+    if constexpr (KeyLayout::has_prefix) {
+      if (key_prefix != prefix) {
+        return key_prefix < prefix;
+      }
+    }
+    return KeyLayout::less(get_key(), key);
+  }
 
-  void set_value(V);
+  // 节点的键是否等于 key，prefix 为 prefix_of(key)
+  template <typename Key>
+  bool key_equals(const Key &key, uint64_t prefix) const {
+    if constexpr (KeyLayout::has_prefix) {
+      if (key_prefix != prefix) {
+        return false;
+      }
+    }
+    return KeyLayout::equal(get_key(), key);
+  }
+
+  const V &get_value() const { return *value_ptr(); }
+
+  void set_value(V value) { *value_ptr() = std::move(value); }
+
+  V &mutable_value() { return *value_ptr(); }    // 原地修改值，例如 Append
 
-public:
-  Node<K, V> **forward;   // 指向不同级别的下一个节点的指针数组（跳表的核心）
-  int node_level;   // 节点的级别
-  
 private:
-  K key;
-  V value;
-};
+  Node(int level, size_t keyBytes) : key_size(static_cast<uint32_t>(keyBytes)), node_level(level) {}
 
-template <typename K, typename V>
-Node<K, V>::Node(const K k, const V v, int level) {   // 构造函数
-  this->key = k;
-  this->value = v;
-  this->node_level = level;
-
-  // 指针数组Node<K, V> *[level + 1]
-  this->forward = new Node<K, V> *[level + 1];    // 为什么数组的尺寸是level + 1？  因为在第level层，则从level到0层都存在该节点，所以该节点可以指向level + 1个节点
-  memset(this->forward, 0, sizeof(Node<K, V> *) * (level + 1));   // 所有字节填充为0
-};
+  // forward 是最后一个成员，sizeof(Node) 已经包含了 forward[0]
+  static size_t key_offset(int level) {
+    size_t offset = sizeof(Node) + sizeof(Node *) * level;
+    return (offset + KeyLayout::alignment - 1) & ~(KeyLayout::alignment - 1);
+  }
 
-template <typename K, typename V>
-Node<K, V>::~Node() {     // 析构函数，释放动态开辟的内存
-  delete[] forward;
+  static size_t value_offset(int level, size_t keyBytes) {
+    size_t offset = key_offset(level) + keyBytes;
+    return (offset + alignof(V) - 1) & ~(alignof(V) - 1);
+  }
+
+  static size_t allocation_size(int level, size_t keyBytes) { return value_offset(level, keyBytes) + sizeof(V); }
+
+  char *key_ptr() { return reinterpret_cast<char *>(this) + key_offset(node_level); }
+  const char *key_ptr() const { return reinterpret_cast<const char *>(this) + key_offset(node_level); }
+
+  V *value_ptr() { return std::launder(reinterpret_cast<V *>(reinterpret_cast<char *>(this) + value_offset(node_level, key_size))); }
+  const V *value_ptr() const {
+    return std::launder(reinterpret_cast<const V *>(reinterpret_cast<const char *>(this) + value_offset(node_level, key_size)));
+  }
+
+private:
+  [[no_unique_address]] typename KeyLayout::prefix_storage key_prefix;   // 键的前缀指纹，只有 std::string 的键有
+  uint32_t key_size;   // 键在节点中占的字节数
+
+public:
+  int node_level;   // 节点的级别
+  // 指向不同级别的下一个节点的指针数组（跳表的核心）。实际长度为 node_level + 1，和节点分配在同一块内存中
+  Node<K, V> *forward[1];
 };
 
 template <typename K, typename V>
-K Node<K, V>::get_key() const {
-  return key;
-};
+template <typename KArg, typename... VArgs>
+Node<K, V> *Node<K, V>::Create(NodeArena &arena, int level, KArg &&k, VArgs &&...v) {
+  static_assert(alignof(V) <= NodeArena::kAlignment && KeyLayout::alignment <= NodeArena::kAlignment,
+                "node members must fit the arena alignment");
+  size_t keyBytes = KeyLayout::bytes(k);
+  size_t size = allocation_size(level, keyBytes);
+  void *memory = arena.Allocate(size);
+  auto *node = new (memory) Node(level, keyBytes);
+  if constexpr (KeyLayout::has_prefix) {
+    node->key_prefix = KeyLayout::prefix(k);
+  }
+  // 为什么数组的尺寸是level + 1？  因为在第level层，则从level到0层都存在该节点，所以该节点可以指向level + 1个节点
+  memset(node->forward, 0, sizeof(Node<K, V> *) * (level + 1));
+  KeyLayout::construct(node->key_ptr(), std::forward<KArg>(k));
+  try {
+    new (reinterpret_cast<char *>(node) + value_offset(level, keyBytes)) V(std::forward<VArgs>(v)...);
+  } catch (...) {
+    KeyLayout::destroy(node->key_ptr());
+    arena.Deallocate(memory, size);
+    throw;
+  }
+  return node;
+}
 
 template <typename K, typename V>
-V Node<K, V>::get_value() const {
-  return value;
+void Node<K, V>::Destroy(NodeArena &arena, Node *node) {
+  size_t size = allocation_size(node->node_level, node->key_size);
+  node->value_ptr()->~V();
+  KeyLayout::destroy(node->key_ptr());
+  node->~Node();
+  arena.Deallocate(node, size);
+}
+
+/*
+SkipListDumpValue 类模板
+主要功能：导出时值的类型。分段的值导出为普通字符串，快照中不出现分段结构，格式与值类型为 std::string 时完全相同
+*/
+template <typename V>
+struct SkipListDumpValue {
+  using type = V;
 };
 
-template <typename K, typename V>
-void Node<K, V>::set_value(V value) {
-  this->value = value;
+template <>
+struct SkipListDumpValue<SegmentedValue> {
+  using type = std::string;
 };
 
 /*
@@ -91,7 +255,7 @@ public:
   
   // 用于存储节点的键和值的向量
   std::vector<K> keyDumpVt_;
-  std::vector<V> valDumpVt_;
+  std::vector<typename SkipListDumpValue<V>::type> valDumpVt_;
 public:
   void insert(const Node<K, V> &node);
 };
@@ -113,7 +277,10 @@ SkipList 跳表类模板
 template <typename K, typename V>
 class SkipList {
 public:
-  SkipList(int);
+  static constexpr int kMaxLevelLimit = 32;   // 层级的上限，头节点按这个高度分配
+
+  // max_level 为初始的最大层级，之后随元素数量自动增长；branching 为每层晋升概率的倒数，只支持 2（p=1/2）和 4（p=1/4）
+  explicit SkipList(int max_level, int branching = 2);
   ~SkipList();
 
   int get_random_level();   // 获取一个随机层级，用于确定新节点的层数
@@ -124,28 +291,81 @@ public:
 
   void display_list();    // 显示跳表中的所有元素，主要用于调试
 
-  bool search_element(K, V &value);   // 查找一个指定键值的元素，返回是否找到，并将值赋给传入参数 value。
+  // 查找一个指定键值的元素，返回是否找到，并将值赋给传入参数 value（可以是任何能从 V 赋值的类型，例如把分段的值展平为字符串）
+  // key 可以是任何能和 K 比较的类型（例如 std::string_view），不需要先构造一个 K；不加锁，并发读写需要调用者保证
+  template <typename Key, typename Out>
+  bool search_element(const Key &key, Out &value);
+
+  template <typename Key>
+  bool delete_element(const Key &key);    //  删除一个指定键的元素，返回键是否存在
 
-  void delete_element(K);    //  删除一个指定键的元素
+  // 以下接口都只遍历一次跳表。键和值可以是右值（移动进节点）或者能构造 K、V 的类型（例如 std::string_view）
+
+  // 插入或覆盖，键已存在时原地替换值，不重新分配节点；返回是否插入了新键
+  template <typename Key, typename Value>
+  bool upsert(Key &&key, Value &&value);
+
+  // 键不存在时用 args 在节点中原地构造值；键已存在时不构造值、不修改。返回值的指针（直到键被删除前有效）和是否插入
+  template <typename Key, typename... Args>
+  std::pair<V *, bool> try_emplace(Key &&key, Args &&...args);
+
+  // 查找键，不存在时插入 value；返回值的指针和是否插入
+  template <typename Key, typename Value>
+  std::pair<V *, bool> find_or_insert(Key &&key, Value &&value);
+
+  // 键存在时调用 fn(V &) 原地修改值，返回键是否存在；键不存在时什么也不做
+  template <typename Key, typename F>
+  bool update_in_place(const Key &key, F &&fn);
 
   void insert_set_element(K &, V &);    //  插入或设置元素
 
+  void insert_set_element(const K &, V &&);   // 插入或设置元素，值被移动进跳表，只遍历一次
+
+  template <typename U>
+  void insert_set_elements(const std::vector<K> &keys, const std::vector<U> &values);   // 批量插入或设置元素，只遍历一次跳表
+
+  template <typename U>
+  void search_elements(const std::vector<K> &keys, std::vector<U> *values, std::vector<bool> *exists);   // 批量查找
+
+  // 在键已有的值后面追加 suffix（原地调用值的 append），键不存在时以 suffix 为值插入，只遍历一次
+  template <typename S>
+  void append_element(const K &key, const S &suffix);
+
+  // 范围查找：从第一个不小于 start 的键开始，沿第0层顺序取出最多 limit 个键小于 end 的元素（hasEnd 为 false 时不限上界）
+  // 返回范围内是否还有剩余的元素，有的话 next 为下一个元素的键，下次从它开始继续
+  template <typename U>
+  bool scan_elements(const K &start, const K &end, bool hasEnd, size_t limit, std::vector<K> *keys,
+                     std::vector<U> *values, K *next);
+
   std::string dump_file();      // 将跳表数据导出为字符串，便于持久化存储
 
+  void dump_to(SkipListDump<K, V> *dumper);   // 把所有元素按键的顺序追加到 dumper 中，多个跳表可以导出到同一个 dumper
+
   void load_file(const std::string &dumpStr);   // 从字符串加载跳表数据
 
-  void clear(Node<K, V> *);     // 递归删除节点
+  void clear(Node<K, V> *);     // 删除 cur 及其之后的所有节点
 
   int size();     // 返回跳表中元素的数量
 
-private: 
+private:
+  // 从高层向低层查找，返回第0层第一个不小于 key 的节点，update[i] 保存第 i 层最后一个小于 key 的节点
+  template <typename Key>
+  Node<K, V> *find_position(const Key &key, Node<K, V> **update);
+
+  // 在 find_position 找到的位置插入一个新节点，参数转发给节点的原地构造函数
+  template <typename KArg, typename... VArgs>
+  Node<K, V> *link_node(Node<K, V> **update, KArg &&key, VArgs &&...value);
+
   // 从字符串中解析键值对
   void get_key_value_from_string(const std::string &str, std::string *key, std::string *value);
   // 判断字符串是否有效
   bool is_valid_string(const std::string &str);
 
 private:
-  int _max_level;   // 跳表的最大层数
+  NodeArena _arena;   // 节点的内存池；析构函数先销毁所有节点，成员析构时再归还内存块
+  int _max_level;   // 跳表当前的最大层数，元素增多时自动增长，不超过 kMaxLevelLimit
+  int _level_shift;   // 每升一层需要的随机比特数：p=1/2 时为1，p=1/4 时为2
+  uint64_t _rng_state;    // 生成层级的 xorshift64* 随机数状态，在 _mtx 保护下使用
   int _skip_list_level;   // 当前跳表的层数
   Node<K, V> *_header;    // 指向跳表头节点的指针
   std::ofstream _file_writer;   // 文件输出流，用于导出数据
@@ -160,9 +380,8 @@ create_node 函数
 主要功能：创建一个新的跳表节点，指定键值对和层级
 */
 template <typename K, typename V>
-Node<K, V> *SkipList<K, V>::create_node(const K k, const V v, int level) {
-  Node<K, V> *n = new Node<K, V>(k, v, level);
-  return n;
+Node<K, V> *SkipList<K, V>::create_node(K k, V v, int level) {
+  return Node<K, V>::Create(_arena, level, std::move(k), std::move(v));
 }
 
 /*
@@ -194,11 +413,12 @@ int SkipList<K, V>::insert_element(const K key, const V value) {
   
   // 1. 初始化
   Node<K, V> *current = this->_header;    // current 指针初始化为跳表的头节点 _header
-  Node<K, V> *update[_max_level + 1];     // 创建并初始化 update 数组，用于存储每一层需要更新的前驱节点。
+  Node<K, V> *update[kMaxLevelLimit + 1];     // 创建并初始化 update 数组，用于存储每一层需要更新的前驱节点。
+  uint64_t prefix = Node<K, V>::prefix_of(key);   // 键的前缀指纹，和每个节点比较时先比较指纹
 
   // 2. 查找插入位置：从最高层开始逐层向下
   for (int i = _skip_list_level; i >= 0; i--) {
-    while (current->forward[i] != NULL & current->forward[i]->get_key() < key) {    // 从current开始遍历第i层的节点，直到找到第一个比要插入的key更大或相等的，或者找到末尾。（注意，这里current还是上一个，这是由于要把新节点插入到current后面，所以需要保存current）
+    while (current->forward[i] != NULL && current->forward[i]->key_less(key, prefix)) {    // 从current开始遍历第i层的节点，直到找到第一个比要插入的key更大或相等的，或者找到末尾。（注意，这里current还是上一个，这是由于要把新节点插入到current后面，所以需要保存current）
       current = current->forward[i];    
     }
     update[i] = current;    // 每一层中，新插入的节点的位置就是第一个比他大或相等的节点位置，update保存的为其目标地址的前一个节点
@@ -206,14 +426,14 @@ int SkipList<K, V>::insert_element(const K key, const V value) {
   current = current->forward[0];    // 将current指向节点在原始链表中的目标位置
 
   // 3. 检查是否存在相同的key
-  if (current != NULL && current->get_key() == key) {   // 如果存在相同的key，一定是相等的这一个
+  if (current != NULL && current->key_equals(key, prefix)) {   // 如果存在相同的key，一定是相等的这一个
     std::cout << "key: " << key << ", exists" << std::endl;
     _mtx.unlock();
     return 1;   // 键已存在，插入失败，返回 1
   }
 
   // 4. 插入新节点
-  if (current == NULL || current->get_key() != key) {
+  if (current == NULL || !current->key_equals(key, prefix)) {
     int random_level = get_random_level();    // 随机获得要插入的层级
 
     if (random_level > _skip_list_level) {    // 插入层级比当前跳表存在的层级还要大，则调整当前最大层级
@@ -264,14 +484,8 @@ dump_file 函数
 */
 template <typename K, typename V>
 std::string SkipList<K, V>::dump_file() {
-  Node<K, V> *node = this->_header->forward[0];    // 获取第 0 层（最底层）第一个节点的指针
   SkipListDump<K, V> dumper;    // SkipListDump对象，用于临时存储跳表中的键值对，以便进行序列化
-  
-  // 遍历所有节点
-  while (node != nullptr) {
-    dumper.insert(*node);   // 加入到dumper中
-    node = node->forward[0];
-  }
+  dump_to(&dumper);
 
   // 创建字符串流ss和文本输出档案oa
   std::stringstream ss;
@@ -283,6 +497,19 @@ std::string SkipList<K, V>::dump_file() {
   return ss.str();
 }
 
+/*
+dump_to 函数
+主要功能：沿第0层遍历所有节点，把键值对加入 dumper
+*/
+template <typename K, typename V>
+void SkipList<K, V>::dump_to(SkipListDump<K, V> *dumper) {
+  Node<K, V> *node = this->_header->forward[0];    // 获取第 0 层（最底层）第一个节点的指针
+  while (node != nullptr) {
+    dumper->insert(*node);   // 加入到dumper中
+    node = node->forward[0];
+  }
+}
+
 /*
 load_file 函数
 主要功能：从字符串加载跳表数据
@@ -293,7 +520,7 @@ void SkipList<K, V>::load_file(const std::string &dumpStr) {
     return;
   }
   // 创建 SkipListDump 对象
-  SkipListDump<K, V> dumper;
+  SkipListDump<K, V> dumper;    // 与 dump_file 使用相同的导出类型
   // 将字符串包装成输入字符串流
   std::stringstream iss(dumpStr);
 
@@ -303,7 +530,7 @@ void SkipList<K, V>::load_file(const std::string &dumpStr) {
 
   // 将数据插入到跳表
   for (int i = 0; i < dumper.keyDumpVt_.size(); ++i) {
-    insert_element(dumper.keyDumpVt_[i], dumper.valDumpVt_[i]);
+    insert_element(dumper.keyDumpVt_[i], V(std::move(dumper.valDumpVt_[i])));
   }
 }
 
@@ -350,17 +577,19 @@ delete_element 函数
 注意：删除本质上和插入一致，只不过是查到了要删除
 */
 template<typename K, typename V>
-void SkipList<K, V>::delete_element(K key) {
+template <typename Key>
+bool SkipList<K, V>::delete_element(const Key &key) {
   _mtx.lock();
 
   // 1. 初始化
   Node<K, V> *current = this->_header;
-  Node<K, V> *update[_max_level + 1];
-  memset(update, 0, sizeof(Node<K, V> *) * (_max_level + 1));
+  Node<K, V> *update[kMaxLevelLimit + 1];
+  memset(update, 0, sizeof(update));
+  uint64_t prefix = Node<K, V>::prefix_of(key);
 
   // 2. 从高层级逐层查找
   for (int i = _skip_list_level; i >= 0; i--) {
-    while (current->forward[i] != NULL && current->forward[i]->get_key() < key) {
+    while (current->forward[i] != NULL && current->forward[i]->key_less(key, prefix)) {
       current = current->forward[i];
     }
     update[i] = current;
@@ -368,7 +597,8 @@ void SkipList<K, V>::delete_element(K key) {
 
   current = current->forward[0];    // 此时，current为目标位置的节点
   // 检查当前节点是否是要删除的节点
-  if (current != NULL && current->get_key() == key) { 
+  bool deleted = current != NULL && current->key_equals(key, prefix);
+  if (deleted) { 
     // 是，则从下向上逐层删除
     for (int i = 0; i <= _skip_list_level; i++) {
       if (update[i]->forward[i] != current) {   // 说明当前层级已经没有了要删除的节点
@@ -382,25 +612,275 @@ void SkipList<K, V>::delete_element(K key) {
       _skip_list_level--;
     }
 
-    std::cout << "Successfully deleted key " << key << std::endl;
-    delete current;   // 注意销毁动态内存资源
+    Node<K, V>::Destroy(_arena, current);   // 注意销毁动态内存资源，节点内存回到内存池的空闲链表
     _element_count--;
   }
   _mtx.unlock();
-  return;
+  return deleted;
 }
 
 /*
 insert_set_element 函数
 主要功能：插入元素，如果元素存在则改变其值
+注意：原先是"查找+删除+插入"三次遍历，现在等价于 upsert，只遍历一次，已有的节点原地修改值
 */
 template <typename K, typename V>
 void SkipList<K, V>::insert_set_element(K &key, V &value) {
-  V oldValue;
-  if (search_element(key, oldValue)) {    // 如果已经有了这个元素
-    delete_element(key);    // 删除这个元素
+  upsert(key, value);
+}
+
+/*
+insert_set_element 函数（右值版本）
+主要功能：插入元素，如果元素存在则改变其值。值是右值，直接移动到节点中，整个过程不拷贝值
+*/
+template <typename K, typename V>
+void SkipList<K, V>::insert_set_element(const K &key, V &&value) {
+  upsert(key, std::move(value));
+}
+
+/*
+find_position 函数
+主要功能：单次遍历的定位，供各个写接口共用
+注意：调用者需持有 _mtx
+*/
+template <typename K, typename V>
+template <typename Key>
+Node<K, V> *SkipList<K, V>::find_position(const Key &key, Node<K, V> **update) {
+  uint64_t prefix = Node<K, V>::prefix_of(key);
+  Node<K, V> *current = _header;
+  for (int i = _skip_list_level; i >= 0; i--) {
+    while (current->forward[i] != NULL && current->forward[i]->key_less(key, prefix)) {
+      current = current->forward[i];
+    }
+    update[i] = current;
+  }
+  return current->forward[0];
+}
+
+/*
+link_node 函数
+主要功能：随机出层级，在 update 描述的位置原地构造并链接一个新节点
+注意：调用者需持有 _mtx，且刚用 find_position 确认键不存在
+*/
+template <typename K, typename V>
+template <typename KArg, typename... VArgs>
+Node<K, V> *SkipList<K, V>::link_node(Node<K, V> **update, KArg &&key, VArgs &&...value) {
+  int random_level = get_random_level();
+  if (random_level > _skip_list_level) {
+    for (int i = _skip_list_level + 1; i < random_level + 1; i++) {
+      update[i] = _header;
+    }
+    _skip_list_level = random_level;
+  }
+  Node<K, V> *inserted_node =
+      Node<K, V>::Create(_arena, random_level, std::forward<KArg>(key), std::forward<VArgs>(value)...);
+  for (int i = 0; i <= random_level; i++) {
+    inserted_node->forward[i] = update[i]->forward[i];
+    update[i]->forward[i] = inserted_node;
+  }
+  _element_count++;
+  return inserted_node;
+}
+
+/*
+upsert 函数
+主要功能：插入或覆盖。找到就把值移动（或拷贝）到已有节点中，找不到就在同一个位置插入，只遍历一次
+*/
+template <typename K, typename V>
+template <typename Key, typename Value>
+bool SkipList<K, V>::upsert(Key &&key, Value &&value) {
+  std::lock_guard<std::mutex> lg(_mtx);
+  Node<K, V> *update[kMaxLevelLimit + 1];
+  Node<K, V> *current = find_position(key, update);
+  if (current != NULL && current->key_equals(key, Node<K, V>::prefix_of(key))) {   // 已存在，原地修改
+    current->mutable_value() = std::forward<Value>(value);
+    return false;
+  }
+  link_node(update, std::forward<Key>(key), std::forward<Value>(value));
+  return true;
+}
+
+/*
+try_emplace 函数
+主要功能：键不存在时原地构造值插入；键已存在时 args 不会被使用（右值参数也不会被移动）
+*/
+template <typename K, typename V>
+template <typename Key, typename... Args>
+std::pair<V *, bool> SkipList<K, V>::try_emplace(Key &&key, Args &&...args) {
+  std::lock_guard<std::mutex> lg(_mtx);
+  Node<K, V> *update[kMaxLevelLimit + 1];
+  Node<K, V> *current = find_position(key, update);
+  if (current != NULL && current->key_equals(key, Node<K, V>::prefix_of(key))) {
+    return {&current->mutable_value(), false};
+  }
+  Node<K, V> *inserted_node = link_node(update, std::forward<Key>(key), std::forward<Args>(args)...);
+  return {&inserted_node->mutable_value(), true};
+}
+
+template <typename K, typename V>
+template <typename Key, typename Value>
+std::pair<V *, bool> SkipList<K, V>::find_or_insert(Key &&key, Value &&value) {
+  return try_emplace(std::forward<Key>(key), std::forward<Value>(value));
+}
+
+/*
+update_in_place 函数
+主要功能：键存在时对值调用 fn 原地修改，不删除、不分配节点
+*/
+template <typename K, typename V>
+template <typename Key, typename F>
+bool SkipList<K, V>::update_in_place(const Key &key, F &&fn) {
+  std::lock_guard<std::mutex> lg(_mtx);
+  Node<K, V> *update[kMaxLevelLimit + 1];
+  Node<K, V> *current = find_position(key, update);
+  if (current == NULL || !current->key_equals(key, Node<K, V>::prefix_of(key))) {
+    return false;
+  }
+  fn(current->mutable_value());
+  return true;
+}
+
+/*
+insert_set_elements 函数
+主要功能：批量插入或设置元素，整批只加一次锁、只从头遍历一次跳表
+实现：
+    先把键排序（重复的键以后出现的为准），然后按从小到大的顺序处理。
+    update[i] 保存上一个键在第 i 层的前驱，下一个键一定更大，所以每一层都可以从 update[i] 继续往后找，
+    不用每次都从头节点出发。已经存在的键直接原地修改值，不再删除再插入。
+*/
+template <typename K, typename V>
+template <typename U>
+void SkipList<K, V>::insert_set_elements(const std::vector<K> &keys, const std::vector<U> &values) {
+  // 1. 按键排序，重复的键只保留最后一次出现的
+  std::vector<size_t> order(keys.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [&keys](size_t a, size_t b) { return keys[a] < keys[b]; });
+
+  std::lock_guard<std::mutex> lg(_mtx);
+
+  Node<K, V> *update[kMaxLevelLimit + 1];
+  for (int i = 0; i <= kMaxLevelLimit; i++) {
+    update[i] = _header;
+  }
+
+  for (size_t n = 0; n < order.size(); n++) {
+    if (n + 1 < order.size() && keys[order[n + 1]] == keys[order[n]]) {
+      continue;   // 后面还有同样的键，以最后一个为准
+    }
+    const K &key = keys[order[n]];
+    const U &value = values[order[n]];
+    uint64_t prefix = Node<K, V>::prefix_of(key);
+
+    // 2. 从上一个键的前驱开始查找插入位置
+    Node<K, V> *current = _header;
+    for (int i = _skip_list_level; i >= 0; i--) {
+      if (current == _header || (update[i] != _header && current->get_key() < update[i]->get_key())) {
+        current = update[i];    // 选择本层更靠后的起点
+      }
+      while (current->forward[i] != NULL && current->forward[i]->key_less(key, prefix)) {
+        current = current->forward[i];
+      }
+      update[i] = current;
+    }
+    current = current->forward[0];
+
+    // 3. 键已存在则原地修改值，否则插入新节点
+    if (current != NULL && current->key_equals(key, prefix)) {
+      current->set_value(V(value));
+      continue;
+    }
+
+    int random_level = get_random_level();
+    if (random_level > _skip_list_level) {
+      for (int i = _skip_list_level + 1; i < random_level + 1; i++) {
+        update[i] = _header;
+      }
+      _skip_list_level = random_level;
+    }
+    Node<K, V> *inserted_node = create_node(key, V(value), random_level);
+    for (int i = 0; i <= random_level; i++) {
+      inserted_node->forward[i] = update[i]->forward[i];
+      update[i]->forward[i] = inserted_node;
+    }
+    _element_count++;
+  }
+}
+
+/*
+append_element 函数
+主要功能：追加写。与 insert_set_element 一样只遍历一次：找到就在节点的值上原地 append，找不到就在同一个位置插入新节点
+注意：值为 SegmentedValue 时追加只拷贝 suffix，不会拷贝整个值
+*/
+template <typename K, typename V>
+template <typename S>
+void SkipList<K, V>::append_element(const K &key, const S &suffix) {
+  std::lock_guard<std::mutex> lg(_mtx);
+  Node<K, V> *update[kMaxLevelLimit + 1];
+  Node<K, V> *current = find_position(key, update);
+  if (current != NULL && current->key_equals(key, Node<K, V>::prefix_of(key))) {
+    current->mutable_value().append(suffix);
+    return;
   }
-  insert_element(key, value);   // 再把这个新元素插入
+  link_node(update, key, V(suffix));
+}
+
+/*
+search_elements 函数
+主要功能：批量查找，values和exists与keys一一对应
+*/
+template <typename K, typename V>
+template <typename U>
+void SkipList<K, V>::search_elements(const std::vector<K> &keys, std::vector<U> *values, std::vector<bool> *exists) {
+  values->assign(keys.size(), U());
+  exists->assign(keys.size(), false);
+  for (size_t n = 0; n < keys.size(); n++) {
+    uint64_t prefix = Node<K, V>::prefix_of(keys[n]);
+    Node<K, V> *current = _header;
+    for (int i = _skip_list_level; i >= 0; i--) {
+      while (current->forward[i] != NULL && current->forward[i]->key_less(keys[n], prefix)) {
+        current = current->forward[i];
+      }
+    }
+    current = current->forward[0];
+    if (current != NULL && current->key_equals(keys[n], prefix)) {
+      (*values)[n] = current->get_value();
+      (*exists)[n] = true;
+    }
+  }
+}
+
+/*
+scan_elements 函数
+主要功能：范围查找，先像 search_element 一样逐层下降定位到第一个不小于 start 的节点，之后只在第0层向后遍历
+注意：不加锁，并发读写需要调用者保证；一次最多取 limit 个，调用者据此控制单页大小
+*/
+template <typename K, typename V>
+template <typename U>
+bool SkipList<K, V>::scan_elements(const K &start, const K &end, bool hasEnd, size_t limit, std::vector<K> *keys,
+                                   std::vector<U> *values, K *next) {
+  keys->clear();
+  values->clear();
+
+  uint64_t startPrefix = Node<K, V>::prefix_of(start);
+  uint64_t endPrefix = Node<K, V>::prefix_of(end);
+  Node<K, V> *current = _header;
+  for (int i = _skip_list_level; i >= 0; i--) {
+    while (current->forward[i] != NULL && current->forward[i]->key_less(start, startPrefix)) {
+      current = current->forward[i];
+    }
+  }
+  current = current->forward[0];    // 第一个不小于 start 的节点
+
+  while (current != NULL && (!hasEnd || current->key_less(end, endPrefix))) {
+    if (keys->size() >= limit) {    // 本页已满，范围内还有元素
+      *next = current->get_key();
+      return true;
+    }
+    keys->emplace_back(current->get_key());
+    values->push_back(current->get_value());
+    current = current->forward[0];
+  }
+  return false;
 }
 
 /*
@@ -424,13 +904,14 @@ level 1         1    4     10         30         50|           70       100
 level 0         1    4   9 10         30   40    50+-->60      70       100
 */
 template <typename K, typename V>
-bool SkipList<K, V>::search_element(K key, V &value) {
-  std::cout << "search_element-----------------" << std::endl;
+template <typename Key, typename Out>
+bool SkipList<K, V>::search_element(const Key &key, Out &value) {
+  uint64_t prefix = Node<K, V>::prefix_of(key);   // 先算出前缀指纹，大部分节点只需要比较一次整数
   Node<K, V> *current = _header;
 
   // 从最高层级开始向下寻找
   for (int i = _skip_list_level; i >= 0; i--) {
-    while (current->forward[i] != NULL && current->forward[i]->get_key() < key) {
+    while (current->forward[i] != NULL && current->forward[i]->key_less(key, prefix)) {
       current = current->forward[i];
     }
   }
@@ -438,14 +919,12 @@ bool SkipList<K, V>::search_element(K key, V &value) {
   current = current->forward[0];    // 目标位置的节点
 
   // 判断目标位置节点是否是想要的
-  if (current and current->get_key() == key) {   
+  if (current and current->key_equals(key, prefix)) {   
     // 找到了，则将value赋值，并返回成功
     value = current->get_value();
-    std::cout << "Found key: " << key << ", value: " << current->get_value() << std::endl;
     return true;
   }
 
-  std::cout << "Not Found Key:" << key << std::endl;
   return false;
 }
 
@@ -454,15 +933,20 @@ bool SkipList<K, V>::search_element(K key, V &value) {
 主要功能：初始化跳表
 */
 template <typename K, typename V>
-SkipList<K, V>::SkipList(int max_level) {
-  this->_max_level = max_level;
+SkipList<K, V>::SkipList(int max_level, int branching) {
+  this->_max_level = std::clamp(max_level, 1, kMaxLevelLimit);
+  this->_level_shift = branching == 4 ? 2 : 1;
   this->_skip_list_level = 0;
   this->_element_count = 0;
 
-  // 头节点，key和value都是null
-  K k;
-  V v;
-  this->_header = new Node<K, V>(k, v, _max_level);
+  // 随机数种子取自对象地址，不同的跳表得到不同的序列；splitmix64 打散，保证不为0
+  uint64_t seed = reinterpret_cast<uintptr_t>(this) + 0x9e3779b97f4a7c15ULL;
+  seed = (seed ^ (seed >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  seed = (seed ^ (seed >> 27)) * 0x94d049bb133111ebULL;
+  this->_rng_state = (seed ^ (seed >> 31)) | 1;
+
+  // 头节点，key和value都是null；按层级上限分配，最大层级增长时不需要重新分配
+  this->_header = Node<K, V>::Create(_arena, kMaxLevelLimit, K(), V());
 }
 
 /*
@@ -478,38 +962,54 @@ SkipList<K, V>::~SkipList() {
     _file_reader.close();
   }
 
-  // 递归删除跳表节点
+  // 删除跳表节点
   if (_header->forward[0] != nullptr) {
     clear(_header->forward[0]);   // 第0层包含所有节点
   }
 
-  delete (_header);
+  Node<K, V>::Destroy(_arena, _header);
+  // 节点占用的内存块随 _arena 一起归还
 }
 
 /*
 clear 函数
-主要功能：递归删除所有节点
+主要功能：沿第0层删除 cur 及其之后的所有节点
+注意：原先是递归删除，元素很多时会栈溢出，改为循环
 */
 template <typename K, typename V>
 void SkipList<K, V>::clear(Node<K, V> *cur) {
-  if (cur->forward[0] != nullptr) {
-    clear(cur->forward[0]);
+  while (cur != nullptr) {
+    Node<K, V> *next = cur->forward[0];
+    Node<K, V>::Destroy(_arena, cur);
+    cur = next;
   }
-  delete (cur);
 }
 
 /*
 get_random_level 函数
 主要功能：插入节点时，随机获取节点的最大层级
+实现：
+    1. 元素数量达到 (1/p)^_max_level 时最大层级加一，保证元素增长到上千万时查找仍然是 O(log n)
+    2. 层级服从几何分布：64位随机数开头连续的0的个数就是 p=1/2 下的层级，p=1/4 时每两个0升一层。
+       xorshift64* 输出的高位质量最好，所以数开头而不是末尾的0
+       用一条 clz 指令代替原先逐次调用 rand() 的循环，没有分支
+注意：调用者需持有 _mtx；原先的层级最小为1，现在最小为0，一半的节点只占第0层
 */
 template <typename K, typename V>
 int SkipList<K, V>::get_random_level() {
-  int k = 1;
-  while (rand() % 2) {
-    k++;
+  while (_max_level < kMaxLevelLimit &&
+         (static_cast<uint64_t>(_element_count) >> (_level_shift * _max_level)) != 0) {
+    _max_level++;
   }
-  k = (k < _max_level) ? k : _max_level;
-  return k;
-};
+
+  // xorshift64*
+  _rng_state ^= _rng_state >> 12;
+  _rng_state ^= _rng_state << 25;
+  _rng_state ^= _rng_state >> 27;
+  uint64_t random = _rng_state * 0x2545f4914f6cdd1dULL;
+
+  int level = std::countl_zero(random | 1) >> (_level_shift - 1);
+  return std::min(level, _max_level);
+}
 
 #endif
\ No newline at end of file